@@ -0,0 +1,672 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+#include "aes_kat.h"
+
+//Monte Carlo chains in the NIST ECB MCT procedure: outer iteration i
+//encrypts its plaintext 1000 times in a row with key i, the 1000th
+//ciphertext is the golden, and it becomes the plaintext of iteration i + 1.
+//Key i + 1 is key i xored with the last 128, 192 or 256 bits the chain
+//produced.  The records keep each key with its golden so a failed chain
+//does not carry into the next one; the _seed array is the plaintext of
+//iteration 0.  ECBMCT128 starts from the seed of the NIST ECBMCT128.rsp
+//file.
+
+const unsigned char ECBMCT128_seed[16] = { 0xb9, 0x14, 0x5a, 0x76, 0x8b, 0x7d, 0xc4, 0x89, 0xa0, 0x96, 0xb5, 0x46, 0xf4, 0x3b, 0x23, 0x1f };
+
+const aes_mct_record ECBMCT128[] = {
+	{ { 0x13, 0x9a, 0x35, 0x42, 0x2f, 0x1d, 0x61, 0xde, 0x3c, 0x91, 0x78, 0x7f, 0xe0, 0x50, 0x7a, 0xfd },
+	  { 0xd7, 0xc3, 0xff, 0xac, 0x90, 0x31, 0x23, 0x86, 0x50, 0x90, 0x1e, 0x15, 0x73, 0x64, 0xc3, 0x86 } },
+	{ { 0xc4, 0x59, 0xca, 0xee, 0xbf, 0x2c, 0x42, 0x58, 0x6c, 0x01, 0x66, 0x6a, 0x93, 0x34, 0xb9, 0x7b },
+	  { 0xbc, 0x36, 0x37, 0xda, 0x2d, 0xaf, 0x8f, 0xcf, 0x7c, 0x68, 0xbb, 0x28, 0xc1, 0x43, 0xa0, 0xa4 } },
+	{ { 0x78, 0x6f, 0xfd, 0x34, 0x92, 0x83, 0xcd, 0x97, 0x10, 0x69, 0xdd, 0x42, 0x52, 0x77, 0x19, 0xdf },
+	  { 0x9c, 0x88, 0xa8, 0xdb, 0x79, 0x8f, 0x48, 0xdf, 0x1a, 0xc4, 0x93, 0x6a, 0xfa, 0x95, 0x9e, 0xac } },
+	{ { 0xe4, 0xe7, 0x55, 0xef, 0xeb, 0x0c, 0x85, 0x48, 0x0a, 0xad, 0x4e, 0x28, 0xa8, 0xe2, 0x87, 0x73 },
+	  { 0xb8, 0x7a, 0xaa, 0x1c, 0x76, 0xa7, 0x75, 0xd9, 0x4c, 0x2d, 0xdf, 0x82, 0xab, 0xe5, 0xc6, 0x6e } },
+	{ { 0x5c, 0x9d, 0xff, 0xf3, 0x9d, 0xab, 0xf0, 0x91, 0x46, 0x80, 0x91, 0xaa, 0x03, 0x07, 0x41, 0x1d },
+	  { 0x79, 0xee, 0x21, 0x27, 0x34, 0xf1, 0x4d, 0x1b, 0xf5, 0xa5, 0x9d, 0x46, 0xe8, 0xc2, 0xfa, 0x34 } },
+	{ { 0x25, 0x73, 0xde, 0xd4, 0xa9, 0x5a, 0xbd, 0x8a, 0xb3, 0x25, 0x0c, 0xec, 0xeb, 0xc5, 0xbb, 0x29 },
+	  { 0x09, 0xdf, 0x49, 0x13, 0x5a, 0xeb, 0x8e, 0x37, 0x3a, 0x19, 0xfa, 0x45, 0x7a, 0xb2, 0x80, 0xa0 } },
+	{ { 0x2c, 0xac, 0x97, 0xc7, 0xf3, 0xb1, 0x33, 0xbd, 0x89, 0x3c, 0xf6, 0xa9, 0x91, 0x77, 0x3b, 0x89 },
+	  { 0xc5, 0x22, 0x63, 0xef, 0xa6, 0x37, 0x92, 0x09, 0xd1, 0x7e, 0x87, 0xac, 0x25, 0x06, 0x15, 0xcb } },
+	{ { 0xe9, 0x8e, 0xf4, 0x28, 0x55, 0x86, 0xa1, 0xb4, 0x58, 0x42, 0x71, 0x05, 0xb4, 0x71, 0x2e, 0x42 },
+	  { 0x33, 0x6b, 0xed, 0x01, 0x7e, 0x10, 0xa2, 0x47, 0xee, 0x92, 0x98, 0x98, 0x62, 0x43, 0x11, 0x63 } },
+	{ { 0xda, 0xe5, 0x19, 0x29, 0x2b, 0x96, 0x03, 0xf3, 0xb6, 0xd0, 0xe9, 0x9d, 0xd6, 0x32, 0x3f, 0x21 },
+	  { 0xb1, 0x33, 0x10, 0x58, 0x1f, 0xfe, 0x5b, 0x10, 0xaa, 0xef, 0xde, 0xb8, 0x99, 0x2a, 0xec, 0x18 } },
+	{ { 0x6b, 0xd6, 0x09, 0x71, 0x34, 0x68, 0x58, 0xe3, 0x1c, 0x3f, 0x37, 0x25, 0x4f, 0x18, 0xd3, 0x39 },
+	  { 0xb0, 0xea, 0xed, 0xe3, 0xf3, 0xee, 0xbf, 0xef, 0x88, 0x82, 0x2a, 0x6e, 0xde, 0x19, 0x50, 0xb1 } },
+	{ { 0xdb, 0x3c, 0xe4, 0x92, 0xc7, 0x86, 0xe7, 0x0c, 0x94, 0xbd, 0x1d, 0x4b, 0x91, 0x01, 0x83, 0x88 },
+	  { 0x37, 0x89, 0x1f, 0xc2, 0x53, 0xb0, 0x0d, 0xe1, 0x31, 0x55, 0xd5, 0x51, 0x7e, 0x1b, 0x78, 0x90 } },
+	{ { 0xec, 0xb5, 0xfb, 0x50, 0x94, 0x36, 0xea, 0xed, 0xa5, 0xe8, 0xc8, 0x1a, 0xef, 0x1a, 0xfb, 0x18 },
+	  { 0x8f, 0x57, 0x4c, 0x85, 0xfa, 0x44, 0xaf, 0x2d, 0x43, 0xc9, 0x5e, 0xe5, 0xf6, 0x27, 0xfc, 0x9d } },
+	{ { 0x63, 0xe2, 0xb7, 0xd5, 0x6e, 0x72, 0x45, 0xc0, 0xe6, 0x21, 0x96, 0xff, 0x19, 0x3d, 0x07, 0x85 },
+	  { 0x6c, 0x0a, 0xf6, 0x70, 0x92, 0x25, 0xf3, 0x28, 0xa0, 0x22, 0x5b, 0x22, 0x80, 0xef, 0xa3, 0xe3 } },
+	{ { 0x0f, 0xe8, 0x41, 0xa5, 0xfc, 0x57, 0xb6, 0xe8, 0x46, 0x03, 0xcd, 0xdd, 0x99, 0xd2, 0xa4, 0x66 },
+	  { 0xe2, 0xdc, 0x36, 0x07, 0x3f, 0xe1, 0x92, 0xe7, 0x12, 0x37, 0x3a, 0x87, 0x02, 0xe8, 0xad, 0xce } },
+	{ { 0xed, 0x34, 0x77, 0xa2, 0xc3, 0xb6, 0x24, 0x0f, 0x54, 0x34, 0xf7, 0x5a, 0x9b, 0x3a, 0x09, 0xa8 },
+	  { 0x1e, 0x91, 0xd1, 0xe1, 0xf8, 0x2f, 0x1d, 0x32, 0x01, 0x86, 0x21, 0x0a, 0x79, 0x2f, 0x7b, 0xa1 } },
+	{ { 0xf3, 0xa5, 0xa6, 0x43, 0x3b, 0x99, 0x39, 0x3d, 0x55, 0xb2, 0xd6, 0x50, 0xe2, 0x15, 0x72, 0x09 },
+	  { 0x22, 0x8e, 0xac, 0x74, 0x16, 0x6d, 0xa2, 0x61, 0xd7, 0xfa, 0x83, 0xf4, 0x3d, 0x9d, 0xdd, 0x2f } },
+	{ { 0xd1, 0x2b, 0x0a, 0x37, 0x2d, 0xf4, 0x9b, 0x5c, 0x82, 0x48, 0x55, 0xa4, 0xdf, 0x88, 0xaf, 0x26 },
+	  { 0x25, 0xd0, 0xde, 0x6a, 0x89, 0x43, 0x61, 0xa1, 0xb8, 0x3d, 0x5f, 0xa2, 0xfd, 0x60, 0x7f, 0x26 } },
+	{ { 0xf4, 0xfb, 0xd4, 0x5d, 0xa4, 0xb7, 0xfa, 0xfd, 0x3a, 0x75, 0x0a, 0x06, 0x22, 0xe8, 0xd0, 0x00 },
+	  { 0x36, 0x09, 0x5d, 0xc3, 0xe6, 0x59, 0xec, 0x50, 0xca, 0x7f, 0x6f, 0x82, 0x07, 0xd2, 0x00, 0x31 } },
+	{ { 0xc2, 0xf2, 0x89, 0x9e, 0x42, 0xee, 0x16, 0xad, 0xf0, 0x0a, 0x65, 0x84, 0x25, 0x3a, 0xd0, 0x31 },
+	  { 0x8d, 0xbf, 0xe9, 0x65, 0x07, 0x84, 0x68, 0x87, 0x5d, 0x86, 0x14, 0x51, 0x64, 0xc4, 0xab, 0x4f } },
+	{ { 0x4f, 0x4d, 0x60, 0xfb, 0x45, 0x6a, 0x7e, 0x2a, 0xad, 0x8c, 0x71, 0xd5, 0x41, 0xfe, 0x7b, 0x7e },
+	  { 0x40, 0x32, 0xbb, 0x81, 0x37, 0xd4, 0xb9, 0xeb, 0x93, 0x64, 0x43, 0x59, 0xa9, 0x95, 0xbb, 0x4e } },
+	{ { 0x0f, 0x7f, 0xdb, 0x7a, 0x72, 0xbe, 0xc7, 0xc1, 0x3e, 0xe8, 0x32, 0x8c, 0xe8, 0x6b, 0xc0, 0x30 },
+	  { 0x85, 0x30, 0x8a, 0xa9, 0x2c, 0x62, 0x5a, 0x25, 0xbd, 0x5f, 0x4a, 0x40, 0x37, 0x5c, 0x6b, 0xaa } },
+	{ { 0x8a, 0x4f, 0x51, 0xd3, 0x5e, 0xdc, 0x9d, 0xe4, 0x83, 0xb7, 0x78, 0xcc, 0xdf, 0x37, 0xab, 0x9a },
+	  { 0x73, 0x28, 0x3f, 0xc5, 0x9e, 0x04, 0xe8, 0x0a, 0x86, 0x7e, 0x47, 0x8d, 0x97, 0xa3, 0xf3, 0x88 } },
+	{ { 0xf9, 0x67, 0x6e, 0x16, 0xc0, 0xd8, 0x75, 0xee, 0x05, 0xc9, 0x3f, 0x41, 0x48, 0x94, 0x58, 0x12 },
+	  { 0x41, 0x8c, 0x1f, 0xe3, 0x77, 0xe4, 0xef, 0x98, 0x32, 0xf2, 0x02, 0x86, 0xb1, 0x67, 0xf9, 0x16 } },
+	{ { 0xb8, 0xeb, 0x71, 0xf5, 0xb7, 0x3c, 0x9a, 0x76, 0x37, 0x3b, 0x3d, 0xc7, 0xf9, 0xf3, 0xa1, 0x04 },
+	  { 0x60, 0xad, 0x13, 0x41, 0x52, 0x5e, 0x67, 0xcf, 0xfd, 0xd6, 0x8f, 0xf6, 0x71, 0x25, 0x3c, 0x77 } },
+	{ { 0xd8, 0x46, 0x62, 0xb4, 0xe5, 0x62, 0xfd, 0xb9, 0xca, 0xed, 0xb2, 0x31, 0x88, 0xd6, 0x9d, 0x73 },
+	  { 0x4e, 0xdf, 0x6e, 0x01, 0xa7, 0x6d, 0xe6, 0x15, 0x3d, 0x17, 0x71, 0x3a, 0x49, 0xd5, 0xb0, 0x28 } },
+	{ { 0x96, 0x99, 0x0c, 0xb5, 0x42, 0x0f, 0x1b, 0xac, 0xf7, 0xfa, 0xc3, 0x0b, 0xc1, 0x03, 0x2d, 0x5b },
+	  { 0x2c, 0x85, 0xeb, 0xf9, 0xe3, 0xd8, 0x05, 0x96, 0xf7, 0x87, 0x12, 0xdf, 0x56, 0xac, 0x77, 0xcd } },
+	{ { 0xba, 0x1c, 0xe7, 0x4c, 0xa1, 0xd7, 0x1e, 0x3a, 0x00, 0x7d, 0xd1, 0xd4, 0x97, 0xaf, 0x5a, 0x96 },
+	  { 0x8f, 0xc8, 0xef, 0x9a, 0xb7, 0x46, 0x27, 0x12, 0x97, 0x7e, 0x87, 0xc7, 0x41, 0x79, 0x5e, 0xce } },
+	{ { 0x35, 0xd4, 0x08, 0xd6, 0x16, 0x91, 0x39, 0x28, 0x97, 0x03, 0x56, 0x13, 0xd6, 0xd6, 0x04, 0x58 },
+	  { 0x37, 0xe9, 0xac, 0x80, 0x0c, 0xfb, 0x19, 0x13, 0x3b, 0x4e, 0x9b, 0x0c, 0x41, 0x8c, 0xa0, 0x98 } },
+	{ { 0x02, 0x3d, 0xa4, 0x56, 0x1a, 0x6a, 0x20, 0x3b, 0xac, 0x4d, 0xcd, 0x1f, 0x97, 0x5a, 0xa4, 0xc0 },
+	  { 0xcb, 0x7c, 0xd7, 0x61, 0x9c, 0xaa, 0x60, 0x5e, 0x45, 0xf9, 0x5f, 0x5b, 0x31, 0xa8, 0x54, 0x95 } },
+	{ { 0xc9, 0x41, 0x73, 0x37, 0x86, 0xc0, 0x40, 0x65, 0xe9, 0xb4, 0x92, 0x44, 0xa6, 0xf2, 0xf0, 0x55 },
+	  { 0x6e, 0x26, 0x5e, 0x5f, 0xd0, 0x30, 0x84, 0x7b, 0x88, 0x41, 0xbf, 0x66, 0x52, 0x99, 0x63, 0x92 } },
+	{ { 0xa7, 0x67, 0x2d, 0x68, 0x56, 0xf0, 0xc4, 0x1e, 0x61, 0xf5, 0x2d, 0x22, 0xf4, 0x6b, 0x93, 0xc7 },
+	  { 0x5c, 0x9a, 0x7d, 0x2c, 0xe1, 0xc8, 0x6f, 0x0b, 0x34, 0x25, 0xb3, 0xb6, 0xaa, 0xe1, 0x08, 0xe0 } },
+	{ { 0xfb, 0xfd, 0x50, 0x44, 0xb7, 0x38, 0xab, 0x15, 0x55, 0xd0, 0x9e, 0x94, 0x5e, 0x8a, 0x9b, 0x27 },
+	  { 0xc9, 0x11, 0xde, 0xe5, 0xff, 0x31, 0x8a, 0x7e, 0x79, 0x9f, 0x92, 0xda, 0xad, 0xcb, 0x3d, 0x9a } },
+	{ { 0x32, 0xec, 0x8e, 0xa1, 0x48, 0x09, 0x21, 0x6b, 0x2c, 0x4f, 0x0c, 0x4e, 0xf3, 0x41, 0xa6, 0xbd },
+	  { 0x7a, 0x3a, 0xfd, 0xf1, 0x04, 0x10, 0xf1, 0xc4, 0x7c, 0x7d, 0x92, 0x8d, 0x4a, 0x8d, 0x43, 0x2a } },
+	{ { 0x48, 0xd6, 0x73, 0x50, 0x4c, 0x19, 0xd0, 0xaf, 0x50, 0x32, 0x9e, 0xc3, 0xb9, 0xcc, 0xe5, 0x97 },
+	  { 0xc6, 0x81, 0xb7, 0xb6, 0xd3, 0xec, 0x9d, 0xc9, 0x10, 0x12, 0xe3, 0xb7, 0x42, 0x7c, 0x67, 0xad } },
+	{ { 0x8e, 0x57, 0xc4, 0xe6, 0x9f, 0xf5, 0x4d, 0x66, 0x40, 0x20, 0x7d, 0x74, 0xfb, 0xb0, 0x82, 0x3a },
+	  { 0xcd, 0x3f, 0x84, 0xbb, 0xe9, 0x58, 0x53, 0x6d, 0x50, 0x20, 0x65, 0xeb, 0x37, 0xae, 0x10, 0xb4 } },
+	{ { 0x43, 0x68, 0x40, 0x5d, 0x76, 0xad, 0x1e, 0x0b, 0x10, 0x00, 0x18, 0x9f, 0xcc, 0x1e, 0x92, 0x8e },
+	  { 0x87, 0x9d, 0xb7, 0x97, 0xe6, 0x86, 0xb9, 0x11, 0x6c, 0x25, 0xc0, 0x7f, 0x4a, 0xe6, 0x75, 0x93 } },
+	{ { 0xc4, 0xf5, 0xf7, 0xca, 0x90, 0x2b, 0xa7, 0x1a, 0x7c, 0x25, 0xd8, 0xe0, 0x86, 0xf8, 0xe7, 0x1d },
+	  { 0x59, 0x59, 0xeb, 0xd7, 0xa1, 0x16, 0x77, 0x13, 0x42, 0x9e, 0xda, 0x69, 0x53, 0x8c, 0x53, 0x6b } },
+	{ { 0x9d, 0xac, 0x1c, 0x1d, 0x31, 0x3d, 0xd0, 0x09, 0x3e, 0xbb, 0x02, 0x89, 0xd5, 0x74, 0xb4, 0x76 },
+	  { 0xf5, 0x71, 0x01, 0xd7, 0xfa, 0x19, 0xf9, 0x7a, 0x31, 0xd6, 0x0b, 0x27, 0x63, 0x12, 0x71, 0x7c } },
+	{ { 0x68, 0xdd, 0x1d, 0xca, 0xcb, 0x24, 0x29, 0x73, 0x0f, 0x6d, 0x09, 0xae, 0xb6, 0x66, 0xc5, 0x0a },
+	  { 0x6d, 0xfb, 0xbc, 0x2b, 0x14, 0x75, 0x68, 0xc5, 0x5a, 0xdb, 0xfd, 0xc3, 0xc7, 0x06, 0xed, 0xb0 } },
+	{ { 0x05, 0x26, 0xa1, 0xe1, 0xdf, 0x51, 0x41, 0xb6, 0x55, 0xb6, 0xf4, 0x6d, 0x71, 0x60, 0x28, 0xba },
+	  { 0x9c, 0x4e, 0xa9, 0x00, 0x23, 0x06, 0xd7, 0x5e, 0x7b, 0x0f, 0x03, 0xe2, 0xa7, 0x2b, 0x7a, 0x1d } },
+	{ { 0x99, 0x68, 0x08, 0xe1, 0xfc, 0x57, 0x96, 0xe8, 0x2e, 0xb9, 0xf7, 0x8f, 0xd6, 0x4b, 0x52, 0xa7 },
+	  { 0xcb, 0x99, 0x75, 0x33, 0x6c, 0xc0, 0x5f, 0x01, 0x14, 0xf2, 0x6b, 0xde, 0x4c, 0xc8, 0x4f, 0x8d } },
+	{ { 0x52, 0xf1, 0x7d, 0xd2, 0x90, 0x97, 0xc9, 0xe9, 0x3a, 0x4b, 0x9c, 0x51, 0x9a, 0x83, 0x1d, 0x2a },
+	  { 0x90, 0x2c, 0x42, 0x50, 0xcf, 0xf1, 0x10, 0xd7, 0x92, 0x93, 0x8e, 0x8d, 0xcd, 0x53, 0x4c, 0xf0 } },
+	{ { 0xc2, 0xdd, 0x3f, 0x82, 0x5f, 0x66, 0xd9, 0x3e, 0xa8, 0xd8, 0x12, 0xdc, 0x57, 0xd0, 0x51, 0xda },
+	  { 0x14, 0x02, 0x42, 0xf1, 0x95, 0xef, 0x2e, 0xf7, 0xf6, 0xee, 0x23, 0x57, 0x4c, 0x07, 0x13, 0x11 } },
+	{ { 0xd6, 0xdf, 0x7d, 0x73, 0xca, 0x89, 0xf7, 0xc9, 0x5e, 0x36, 0x31, 0x8b, 0x1b, 0xd7, 0x42, 0xcb },
+	  { 0x3c, 0x6d, 0x4f, 0xfa, 0xfd, 0xe8, 0x66, 0xf1, 0xe9, 0x94, 0x48, 0x0c, 0x47, 0xd2, 0x0a, 0x04 } },
+	{ { 0xea, 0xb2, 0x32, 0x89, 0x37, 0x61, 0x91, 0x38, 0xb7, 0xa2, 0x79, 0x87, 0x5c, 0x05, 0x48, 0xcf },
+	  { 0x1c, 0xa0, 0x4a, 0x21, 0xad, 0xdc, 0x38, 0xef, 0x8b, 0xfc, 0x89, 0x89, 0xd3, 0xd6, 0xb3, 0x3b } },
+	{ { 0xf6, 0x12, 0x78, 0xa8, 0x9a, 0xbd, 0xa9, 0xd7, 0x3c, 0x5e, 0xf0, 0x0e, 0x8f, 0xd3, 0xfb, 0xf4 },
+	  { 0xbb, 0x88, 0x75, 0xee, 0x3c, 0x3c, 0x8c, 0x09, 0x87, 0xb1, 0xc2, 0x0f, 0x99, 0x90, 0x28, 0xe9 } },
+	{ { 0x4d, 0x9a, 0x0d, 0x46, 0xa6, 0x81, 0x25, 0xde, 0xbb, 0xef, 0x32, 0x01, 0x16, 0x43, 0xd3, 0x1d },
+	  { 0x9d, 0x33, 0x72, 0x4d, 0x80, 0xa7, 0x6f, 0x20, 0x33, 0xa3, 0x7a, 0x85, 0x14, 0x03, 0xef, 0x28 } },
+	{ { 0xd0, 0xa9, 0x7f, 0x0b, 0x26, 0x26, 0x4a, 0xfe, 0x88, 0x4c, 0x48, 0x84, 0x02, 0x40, 0x3c, 0x35 },
+	  { 0x4c, 0x92, 0xfe, 0x15, 0x2d, 0x16, 0xda, 0x8e, 0xa5, 0x9b, 0x9f, 0x29, 0xc7, 0x5f, 0x20, 0xff } },
+	{ { 0x9c, 0x3b, 0x81, 0x1e, 0x0b, 0x30, 0x90, 0x70, 0x2d, 0xd7, 0xd7, 0xad, 0xc5, 0x1f, 0x1c, 0xca },
+	  { 0x65, 0x9c, 0x76, 0xf7, 0x30, 0x32, 0xb0, 0x19, 0x2b, 0x28, 0x10, 0x34, 0xb6, 0xa9, 0x9a, 0x3f } },
+	{ { 0xf9, 0xa7, 0xf7, 0xe9, 0x3b, 0x02, 0x20, 0x69, 0x06, 0xff, 0xc7, 0x99, 0x73, 0xb6, 0x86, 0xf5 },
+	  { 0x5d, 0x29, 0x66, 0x37, 0x69, 0x7c, 0xca, 0xd8, 0x4f, 0xc7, 0x79, 0x36, 0xa3, 0x1c, 0x26, 0x55 } },
+	{ { 0xa4, 0x8e, 0x91, 0xde, 0x52, 0x7e, 0xea, 0xb1, 0x49, 0x38, 0xbe, 0xaf, 0xd0, 0xaa, 0xa0, 0xa0 },
+	  { 0xa7, 0x2a, 0x59, 0x6a, 0x03, 0x0d, 0x55, 0x41, 0xbc, 0x4d, 0x0f, 0xc7, 0x39, 0x49, 0x1d, 0x5b } },
+	{ { 0x03, 0xa4, 0xc8, 0xb4, 0x51, 0x73, 0xbf, 0xf0, 0xf5, 0x75, 0xb1, 0x68, 0xe9, 0xe3, 0xbd, 0xfb },
+	  { 0x5f, 0x5e, 0xc5, 0x3c, 0x91, 0x22, 0x57, 0x17, 0xfc, 0xba, 0x47, 0x06, 0x88, 0xdf, 0xa3, 0x64 } },
+	{ { 0x5c, 0xfa, 0x0d, 0x88, 0xc0, 0x51, 0xe8, 0xe7, 0x09, 0xcf, 0xf6, 0x6e, 0x61, 0x3c, 0x1e, 0x9f },
+	  { 0x57, 0x19, 0xcb, 0x14, 0xeb, 0xa8, 0x20, 0xc0, 0xd5, 0x11, 0x09, 0xa0, 0xc7, 0xa4, 0x15, 0x4f } },
+	{ { 0x0b, 0xe3, 0xc6, 0x9c, 0x2b, 0xf9, 0xc8, 0x27, 0xdc, 0xde, 0xff, 0xce, 0xa6, 0x98, 0x0b, 0xd0 },
+	  { 0x3a, 0xbd, 0x18, 0x67, 0x12, 0xa9, 0xde, 0xf7, 0x3b, 0x63, 0x12, 0xb5, 0x30, 0x0f, 0x02, 0xaf } },
+	{ { 0x31, 0x5e, 0xde, 0xfb, 0x39, 0x50, 0x16, 0xd0, 0xe7, 0xbd, 0xed, 0x7b, 0x96, 0x97, 0x09, 0x7f },
+	  { 0xb1, 0xe9, 0x0c, 0x8c, 0x0d, 0x4c, 0x96, 0x51, 0xa6, 0xde, 0x7f, 0x52, 0xa6, 0x3a, 0xc4, 0x56 } },
+	{ { 0x80, 0xb7, 0xd2, 0x77, 0x34, 0x1c, 0x80, 0x81, 0x41, 0x63, 0x92, 0x29, 0x30, 0xad, 0xcd, 0x29 },
+	  { 0x5d, 0x26, 0xe3, 0x3a, 0xae, 0x14, 0x41, 0x55, 0x40, 0x34, 0xc7, 0x7b, 0xde, 0x45, 0x16, 0x79 } },
+	{ { 0xdd, 0x91, 0x31, 0x4d, 0x9a, 0x08, 0xc1, 0xd4, 0x01, 0x57, 0x55, 0x52, 0xee, 0xe8, 0xdb, 0x50 },
+	  { 0x93, 0xe4, 0x4c, 0xdc, 0xe1, 0x48, 0x03, 0x54, 0x4a, 0x53, 0xbc, 0x5b, 0x52, 0x0c, 0x15, 0x6f } },
+	{ { 0x4e, 0x75, 0x7d, 0x91, 0x7b, 0x40, 0xc2, 0x80, 0x4b, 0x04, 0xe9, 0x09, 0xbc, 0xe4, 0xce, 0x3f },
+	  { 0x8e, 0xe3, 0xb6, 0xfd, 0x95, 0x3b, 0x44, 0x10, 0x43, 0xf6, 0x9f, 0x37, 0x47, 0xe4, 0xcf, 0x63 } },
+	{ { 0xc0, 0x96, 0xcb, 0x6c, 0xee, 0x7b, 0x86, 0x90, 0x08, 0xf2, 0x76, 0x3e, 0xfb, 0x00, 0x01, 0x5c },
+	  { 0xcb, 0x2f, 0x54, 0x59, 0x70, 0x20, 0x06, 0x30, 0xe5, 0x14, 0x5f, 0x81, 0x7a, 0x01, 0x38, 0x07 } },
+	{ { 0x0b, 0xb9, 0x9f, 0x35, 0x9e, 0x5b, 0x80, 0xa0, 0xed, 0xe6, 0x29, 0xbf, 0x81, 0x01, 0x39, 0x5b },
+	  { 0x50, 0x04, 0x72, 0x76, 0x45, 0x1c, 0xe1, 0x9c, 0xb1, 0x4d, 0x8d, 0x2e, 0xf0, 0xb3, 0x85, 0x1b } },
+	{ { 0x5b, 0xbd, 0xed, 0x43, 0xdb, 0x47, 0x61, 0x3c, 0x5c, 0xab, 0xa4, 0x91, 0x71, 0xb2, 0xbc, 0x40 },
+	  { 0xd2, 0x43, 0x79, 0x1d, 0xde, 0x33, 0xc2, 0xa4, 0x33, 0x3e, 0xf4, 0xdc, 0xbc, 0xad, 0xbd, 0x3a } },
+	{ { 0x89, 0xfe, 0x94, 0x5e, 0x05, 0x74, 0xa3, 0x98, 0x6f, 0x95, 0x50, 0x4d, 0xcd, 0x1f, 0x01, 0x7a },
+	  { 0x34, 0x31, 0x81, 0x86, 0x00, 0x92, 0xa5, 0xe3, 0x3c, 0x2e, 0x1c, 0x44, 0x1a, 0x9f, 0x68, 0x04 } },
+	{ { 0xbd, 0xcf, 0x15, 0xd8, 0x05, 0xe6, 0x06, 0x7b, 0x53, 0xbb, 0x4c, 0x09, 0xd7, 0x80, 0x69, 0x7e },
+	  { 0x4e, 0x7c, 0xdd, 0x55, 0x3d, 0x73, 0x29, 0x09, 0xe2, 0x5a, 0x13, 0xa5, 0x21, 0xe0, 0x40, 0x78 } },
+	{ { 0xf3, 0xb3, 0xc8, 0x8d, 0x38, 0x95, 0x2f, 0x72, 0xb1, 0xe1, 0x5f, 0xac, 0xf6, 0x60, 0x29, 0x06 },
+	  { 0x9c, 0x16, 0xf3, 0xfd, 0xa4, 0x9b, 0xb6, 0xa2, 0xb6, 0xd7, 0x6a, 0x66, 0x96, 0xbd, 0x76, 0x8f } },
+	{ { 0x6f, 0xa5, 0x3b, 0x70, 0x9c, 0x0e, 0x99, 0xd0, 0x07, 0x36, 0x35, 0xca, 0x60, 0xdd, 0x5f, 0x89 },
+	  { 0x9e, 0xb6, 0x3f, 0x90, 0x99, 0x12, 0x35, 0x91, 0xa4, 0xca, 0x7a, 0xa0, 0xff, 0xf5, 0x5a, 0x49 } },
+	{ { 0xf1, 0x13, 0x04, 0xe0, 0x05, 0x1c, 0xac, 0x41, 0xa3, 0xfc, 0x4f, 0x6a, 0x9f, 0x28, 0x05, 0xc0 },
+	  { 0xaa, 0x6a, 0x9e, 0x40, 0xaa, 0xd6, 0x92, 0x55, 0x0b, 0x7c, 0x87, 0xb9, 0x2b, 0x20, 0x5a, 0xf0 } },
+	{ { 0x5b, 0x79, 0x9a, 0xa0, 0xaf, 0xca, 0x3e, 0x14, 0xa8, 0x80, 0xc8, 0xd3, 0xb4, 0x08, 0x5f, 0x30 },
+	  { 0xae, 0x92, 0xc2, 0x67, 0xf3, 0x8b, 0x9b, 0x46, 0x23, 0xdf, 0x36, 0x52, 0x3b, 0xb7, 0x39, 0xb6 } },
+	{ { 0xf5, 0xeb, 0x58, 0xc7, 0x5c, 0x41, 0xa5, 0x52, 0x8b, 0x5f, 0xfe, 0x81, 0x8f, 0xbf, 0x66, 0x86 },
+	  { 0x39, 0xc0, 0xde, 0x84, 0x37, 0x67, 0xdf, 0xa2, 0xd5, 0x63, 0xc0, 0x63, 0x24, 0x05, 0xd5, 0x95 } },
+	{ { 0xcc, 0x2b, 0x86, 0x43, 0x6b, 0x26, 0x7a, 0xf0, 0x5e, 0x3c, 0x3e, 0xe2, 0xab, 0xba, 0xb3, 0x13 },
+	  { 0x80, 0xa9, 0x44, 0x5b, 0xe7, 0x53, 0x73, 0xb0, 0x74, 0x76, 0x60, 0x8f, 0xeb, 0x1f, 0x1c, 0x7b } },
+	{ { 0x4c, 0x82, 0xc2, 0x18, 0x8c, 0x75, 0x09, 0x40, 0x2a, 0x4a, 0x5e, 0x6d, 0x40, 0xa5, 0xaf, 0x68 },
+	  { 0x53, 0x06, 0xf5, 0xa7, 0x7e, 0x42, 0xd9, 0xf4, 0xce, 0xe8, 0xf1, 0x34, 0xba, 0x14, 0x48, 0xc6 } },
+	{ { 0x1f, 0x84, 0x37, 0xbf, 0xf2, 0x37, 0xd0, 0xb4, 0xe4, 0xa2, 0xaf, 0x59, 0xfa, 0xb1, 0xe7, 0xae },
+	  { 0x8d, 0xb0, 0xc3, 0xfb, 0xa7, 0xdc, 0x79, 0x7c, 0xd1, 0x75, 0xd9, 0x75, 0x03, 0x75, 0x92, 0x60 } },
+	{ { 0x92, 0x34, 0xf4, 0x44, 0x55, 0xeb, 0xa9, 0xc8, 0x35, 0xd7, 0x76, 0x2c, 0xf9, 0xc4, 0x75, 0xce },
+	  { 0x04, 0xfc, 0xb0, 0xc7, 0x7a, 0xe0, 0xc9, 0x8d, 0x2a, 0xfb, 0x17, 0x8a, 0xb2, 0xc2, 0xb0, 0x2d } },
+	{ { 0x96, 0xc8, 0x44, 0x83, 0x2f, 0x0b, 0x60, 0x45, 0x1f, 0x2c, 0x61, 0xa6, 0x4b, 0x06, 0xc5, 0xe3 },
+	  { 0x1a, 0x15, 0x65, 0x81, 0xb3, 0x55, 0x70, 0x78, 0x97, 0x1c, 0xc6, 0x87, 0x7a, 0x3d, 0x93, 0x39 } },
+	{ { 0x8c, 0xdd, 0x21, 0x02, 0x9c, 0x5e, 0x10, 0x3d, 0x88, 0x30, 0xa7, 0x21, 0x31, 0x3b, 0x56, 0xda },
+	  { 0xe4, 0x70, 0x87, 0x28, 0x92, 0x90, 0xfa, 0x2b, 0x67, 0x34, 0xee, 0xaa, 0xb2, 0xfc, 0x81, 0x5d } },
+	{ { 0x68, 0xad, 0xa6, 0x2a, 0x0e, 0xce, 0xea, 0x16, 0xef, 0x04, 0x49, 0x8b, 0x83, 0xc7, 0xd7, 0x87 },
+	  { 0x00, 0xce, 0x64, 0x15, 0x25, 0x02, 0x0d, 0x35, 0x24, 0x4e, 0x22, 0x27, 0x28, 0x7b, 0x2a, 0x20 } },
+	{ { 0x68, 0x63, 0xc2, 0x3f, 0x2b, 0xcc, 0xe7, 0x23, 0xcb, 0x4a, 0x6b, 0xac, 0xab, 0xbc, 0xfd, 0xa7 },
+	  { 0xec, 0xf6, 0x23, 0xce, 0xf1, 0xe4, 0x20, 0xd0, 0x99, 0x40, 0x70, 0xc0, 0x78, 0x59, 0x2c, 0x97 } },
+	{ { 0x84, 0x95, 0xe1, 0xf1, 0xda, 0x28, 0xc7, 0xf3, 0x52, 0x0a, 0x1b, 0x6c, 0xd3, 0xe5, 0xd1, 0x30 },
+	  { 0x25, 0x6c, 0x8f, 0x28, 0xdf, 0x4a, 0x28, 0x6f, 0xb0, 0x55, 0x14, 0xfc, 0xfa, 0x8c, 0xbc, 0xaf } },
+	{ { 0xa1, 0xf9, 0x6e, 0xd9, 0x05, 0x62, 0xef, 0x9c, 0xe2, 0x5f, 0x0f, 0x90, 0x29, 0x69, 0x6d, 0x9f },
+	  { 0xfd, 0x4a, 0xed, 0x4b, 0x5a, 0x2b, 0x8e, 0xde, 0xfe, 0x3c, 0xc2, 0xae, 0xf6, 0xec, 0xd2, 0x98 } },
+	{ { 0x5c, 0xb3, 0x83, 0x92, 0x5f, 0x49, 0x61, 0x42, 0x1c, 0x63, 0xcd, 0x3e, 0xdf, 0x85, 0xbf, 0x07 },
+	  { 0xdf, 0xe0, 0xe5, 0x71, 0xf7, 0x7f, 0x0b, 0x46, 0xc5, 0x2f, 0x00, 0x3e, 0x77, 0x49, 0x18, 0xac } },
+	{ { 0x83, 0x53, 0x66, 0xe3, 0xa8, 0x36, 0x6a, 0x04, 0xd9, 0x4c, 0xcd, 0x00, 0xa8, 0xcc, 0xa7, 0xab },
+	  { 0xe4, 0x21, 0xfb, 0xeb, 0x4c, 0x23, 0x74, 0x5b, 0x97, 0x57, 0x81, 0x62, 0xf8, 0x9e, 0x68, 0xfc } },
+	{ { 0x67, 0x72, 0x9d, 0x08, 0xe4, 0x15, 0x1e, 0x5f, 0x4e, 0x1b, 0x4c, 0x62, 0x50, 0x52, 0xcf, 0x57 },
+	  { 0xc3, 0x8c, 0x0b, 0xbd, 0xe0, 0x31, 0xd1, 0xa7, 0x94, 0x38, 0xf7, 0x9f, 0xf7, 0xcc, 0x68, 0xa5 } },
+	{ { 0xa4, 0xfe, 0x96, 0xb5, 0x04, 0x24, 0xcf, 0xf8, 0xda, 0x23, 0xbb, 0xfd, 0xa7, 0x9e, 0xa7, 0xf2 },
+	  { 0x86, 0x11, 0x31, 0x33, 0x96, 0x8a, 0xa3, 0x05, 0x27, 0x09, 0x87, 0x5b, 0xf0, 0x33, 0xd8, 0x04 } },
+	{ { 0x22, 0xef, 0xa7, 0x86, 0x92, 0xae, 0x6c, 0xfd, 0xfd, 0x2a, 0x3c, 0xa6, 0x57, 0xad, 0x7f, 0xf6 },
+	  { 0xfd, 0x70, 0x6b, 0xef, 0x1b, 0xf3, 0x0c, 0x8d, 0x1e, 0x95, 0x54, 0x3b, 0x75, 0x62, 0x9e, 0x02 } },
+	{ { 0xdf, 0x9f, 0xcc, 0x69, 0x89, 0x5d, 0x60, 0x70, 0xe3, 0xbf, 0x68, 0x9d, 0x22, 0xcf, 0xe1, 0xf4 },
+	  { 0x9a, 0x5b, 0xbb, 0x61, 0x25, 0x15, 0x2f, 0x13, 0x52, 0xb1, 0x0e, 0x1c, 0x1a, 0x17, 0x2a, 0xa6 } },
+	{ { 0x45, 0xc4, 0x77, 0x08, 0xac, 0x48, 0x4f, 0x63, 0xb1, 0x0e, 0x66, 0x81, 0x38, 0xd8, 0xcb, 0x52 },
+	  { 0x3e, 0xe6, 0x97, 0x36, 0x48, 0x8c, 0x51, 0xfa, 0x72, 0x78, 0x4a, 0xa2, 0x63, 0x61, 0x8f, 0x45 } },
+	{ { 0x7b, 0x22, 0xe0, 0x3e, 0xe4, 0xc4, 0x1e, 0x99, 0xc3, 0x76, 0x2c, 0x23, 0x5b, 0xb9, 0x44, 0x17 },
+	  { 0xfc, 0x66, 0xda, 0xa2, 0x46, 0xeb, 0xcc, 0x32, 0x0c, 0x7c, 0x89, 0xb5, 0x99, 0x01, 0x46, 0x33 } },
+	{ { 0x87, 0x44, 0x3a, 0x9c, 0xa2, 0x2f, 0xd2, 0xab, 0xcf, 0x0a, 0xa5, 0x96, 0xc2, 0xb8, 0x02, 0x24 },
+	  { 0x35, 0x64, 0x58, 0x85, 0xed, 0x20, 0x5d, 0x67, 0xe5, 0xca, 0xef, 0xf2, 0x66, 0x46, 0xc3, 0x8c } },
+	{ { 0xb2, 0x20, 0x62, 0x19, 0x4f, 0x0f, 0x8f, 0xcc, 0x2a, 0xc0, 0x4a, 0x64, 0xa4, 0xfe, 0xc1, 0xa8 },
+	  { 0xda, 0xea, 0xa8, 0x66, 0xaa, 0x4e, 0xac, 0xdb, 0x75, 0x2c, 0xac, 0xcb, 0x2c, 0x0a, 0xe6, 0xc1 } },
+	{ { 0x68, 0xca, 0xca, 0x7f, 0xe5, 0x41, 0x23, 0x17, 0x5f, 0xec, 0xe6, 0xaf, 0x88, 0xf4, 0x27, 0x69 },
+	  { 0x29, 0xe8, 0x8b, 0x1a, 0xe6, 0x15, 0xfc, 0xd0, 0x6b, 0x09, 0xe7, 0x67, 0x45, 0x9d, 0x60, 0x89 } },
+	{ { 0x41, 0x22, 0x41, 0x65, 0x03, 0x54, 0xdf, 0xc7, 0x34, 0xe5, 0x01, 0xc8, 0xcd, 0x69, 0x47, 0xe0 },
+	  { 0x63, 0x47, 0x0b, 0xff, 0x05, 0x2e, 0x7f, 0x5c, 0x7a, 0x73, 0x5c, 0xc2, 0xe6, 0xeb, 0x61, 0xac } },
+	{ { 0x22, 0x65, 0x4a, 0x9a, 0x06, 0x7a, 0xa0, 0x9b, 0x4e, 0x96, 0x5d, 0x0a, 0x2b, 0x82, 0x26, 0x4c },
+	  { 0xf4, 0xfa, 0x6a, 0x35, 0x49, 0xcd, 0x2b, 0x33, 0xaf, 0x9c, 0xac, 0x13, 0x4d, 0x7b, 0x14, 0x02 } },
+	{ { 0xd6, 0x9f, 0x20, 0xaf, 0x4f, 0xb7, 0x8b, 0xa8, 0xe1, 0x0a, 0xf1, 0x19, 0x66, 0xf9, 0x32, 0x4e },
+	  { 0x5b, 0x22, 0xa8, 0x2c, 0xcb, 0xae, 0x9b, 0x9c, 0x75, 0xf7, 0x97, 0xe7, 0x4e, 0x6d, 0xa5, 0x3d } },
+	{ { 0x8d, 0xbd, 0x88, 0x83, 0x84, 0x19, 0x10, 0x34, 0x94, 0xfd, 0x66, 0xfe, 0x28, 0x94, 0x97, 0x73 },
+	  { 0x87, 0xb5, 0x16, 0x92, 0xf8, 0xf2, 0x87, 0x43, 0xbd, 0x8d, 0xc8, 0x43, 0x27, 0x6f, 0x35, 0x1a } },
+	{ { 0x0a, 0x08, 0x9e, 0x11, 0x7c, 0xeb, 0x97, 0x77, 0x29, 0x70, 0xae, 0xbd, 0x0f, 0xfb, 0xa2, 0x69 },
+	  { 0x15, 0x0f, 0xb2, 0x18, 0x07, 0x04, 0xa7, 0x62, 0x3a, 0x1f, 0xab, 0x8b, 0xf1, 0x7f, 0xba, 0x18 } },
+	{ { 0x1f, 0x07, 0x2c, 0x09, 0x7b, 0xef, 0x30, 0x15, 0x13, 0x6f, 0x05, 0x36, 0xfe, 0x84, 0x18, 0x71 },
+	  { 0x80, 0x88, 0x87, 0x4e, 0x7f, 0x3f, 0x09, 0xa9, 0x8f, 0xd3, 0xf0, 0xa5, 0x9f, 0x2a, 0x0b, 0x4b } },
+	{ { 0x9f, 0x8f, 0xab, 0x47, 0x04, 0xd0, 0x39, 0xbc, 0x9c, 0xbc, 0xf5, 0x93, 0x61, 0xae, 0x13, 0x3a },
+	  { 0x08, 0xe0, 0x2c, 0x09, 0x10, 0x57, 0xd8, 0x1c, 0x05, 0xd9, 0x17, 0xea, 0x5c, 0x07, 0xcd, 0xd0 } },
+	{ { 0x97, 0x6f, 0x87, 0x4e, 0x14, 0x87, 0xe1, 0xa0, 0x99, 0x65, 0xe2, 0x79, 0x3d, 0xa9, 0xde, 0xea },
+	  { 0xb9, 0x63, 0x6b, 0x3e, 0x27, 0x52, 0x69, 0x4c, 0x36, 0x85, 0x87, 0x2f, 0xd0, 0xa9, 0xa0, 0xea } },
+	{ { 0x2e, 0x0c, 0xec, 0x70, 0x33, 0xd5, 0x88, 0xec, 0xaf, 0xe0, 0x65, 0x56, 0xed, 0x00, 0x7e, 0x00 },
+	  { 0x26, 0x10, 0xda, 0xe2, 0xb6, 0x4d, 0x74, 0xa8, 0xcb, 0xb4, 0xf4, 0x3f, 0xa2, 0xd0, 0xa6, 0x03 } },
+	{ { 0x08, 0x1c, 0x36, 0x92, 0x85, 0x98, 0xfc, 0x44, 0x64, 0x54, 0x91, 0x69, 0x4f, 0xd0, 0xd8, 0x03 },
+	  { 0x9c, 0xc9, 0x94, 0xed, 0xa6, 0x97, 0xfb, 0x55, 0x45, 0xea, 0xa5, 0x02, 0xb2, 0xa3, 0x0f, 0xd3 } },
+	{ { 0x94, 0xd5, 0xa2, 0x7f, 0x23, 0x0f, 0x07, 0x11, 0x21, 0xbe, 0x34, 0x6b, 0xfd, 0x73, 0xd7, 0xd0 },
+	  { 0xfb, 0x26, 0x49, 0x69, 0x47, 0x83, 0xb5, 0x51, 0xea, 0xcd, 0x9d, 0x5d, 0xb6, 0x12, 0x6d, 0x47 } },
+};
+
+const unsigned char ECBMCT192_seed[16] = { 0x85, 0xa1, 0xf7, 0xa5, 0x81, 0x67, 0xb3, 0x89, 0xcd, 0xdc, 0x8a, 0x9f, 0xf1, 0x75, 0xee, 0x26 };
+
+const aes_mct_record192 ECBMCT192[] = {
+	{ { 0xb9, 0xa6, 0x3e, 0x09, 0xe1, 0xdf, 0xc4, 0x2e, 0x93, 0xa9, 0x0d, 0x9b, 0xad, 0x73, 0x9e, 0x59, 0x67, 0xae, 0xf6, 0x72, 0xee, 0xdd, 0x5d, 0xa9 },
+	  { 0xee, 0x83, 0xd8, 0x52, 0x79, 0xe0, 0x22, 0xd2, 0x04, 0x80, 0x31, 0xab, 0xee, 0xfb, 0xc4, 0xa4 } },
+	{ { 0x3a, 0xaa, 0x45, 0x81, 0x60, 0xee, 0x54, 0xc9, 0x7d, 0x2a, 0xd5, 0xc9, 0xd4, 0x93, 0xbc, 0x8b, 0x63, 0x2e, 0xc7, 0xd9, 0x00, 0x26, 0x99, 0x0d },
+	  { 0xa8, 0xf9, 0x95, 0x17, 0xb4, 0xbd, 0x14, 0xa1, 0x6c, 0x26, 0xba, 0xe9, 0x01, 0x41, 0x74, 0x98 } },
+	{ { 0x1d, 0x17, 0xd1, 0xbc, 0xc7, 0x4a, 0x85, 0x84, 0xd5, 0xd3, 0x40, 0xde, 0x60, 0x2e, 0xa8, 0x2a, 0x0f, 0x08, 0x7d, 0x30, 0x01, 0x67, 0xed, 0x95 },
+	  { 0x80, 0x28, 0x6e, 0x71, 0x93, 0x73, 0x34, 0xfd, 0x6e, 0x90, 0xc7, 0x06, 0xab, 0xba, 0xf0, 0xff } },
+	{ { 0xc0, 0x02, 0x5c, 0xd0, 0xeb, 0x1f, 0x23, 0xc0, 0x55, 0xfb, 0x2e, 0xaf, 0xf3, 0x5d, 0x9c, 0xd7, 0x61, 0x98, 0xba, 0x36, 0xaa, 0xdd, 0x1d, 0x6a },
+	  { 0xc8, 0xb8, 0xc1, 0x53, 0xbc, 0xb2, 0x31, 0xe9, 0x42, 0x4d, 0x65, 0xf3, 0x7b, 0xff, 0x75, 0xb8 } },
+	{ { 0xaf, 0xb4, 0x5c, 0x10, 0x97, 0x55, 0x3d, 0x58, 0x9d, 0x43, 0xef, 0xfc, 0x4f, 0xef, 0xad, 0x3e, 0x23, 0xd5, 0xdf, 0xc5, 0xd1, 0x22, 0x68, 0xd2 },
+	  { 0x81, 0x08, 0xfb, 0xfd, 0xe1, 0xcf, 0xf0, 0xd9, 0x4b, 0x88, 0xb1, 0x07, 0x31, 0x14, 0xc6, 0x57 } },
+	{ { 0x8b, 0x81, 0xe2, 0x41, 0x8f, 0x67, 0x6a, 0x5b, 0x1c, 0x4b, 0x14, 0x01, 0xae, 0x20, 0x5d, 0xe7, 0x68, 0x5d, 0x6e, 0xc2, 0xe0, 0x36, 0xae, 0x85 },
+	  { 0x79, 0xaf, 0x44, 0xf2, 0x49, 0x0e, 0xfc, 0x90, 0xd2, 0x17, 0xaf, 0x55, 0xdd, 0x10, 0xfd, 0x2e } },
+	{ { 0x43, 0x46, 0x3b, 0xbf, 0x95, 0x28, 0xc3, 0xbc, 0x65, 0xe4, 0x50, 0xf3, 0xe7, 0x2e, 0xa1, 0x77, 0xba, 0x4a, 0xc1, 0x97, 0x3d, 0x26, 0x53, 0xab },
+	  { 0xd0, 0xc2, 0xda, 0x38, 0x60, 0xc3, 0x67, 0xe1, 0xfd, 0x68, 0xcf, 0x04, 0xbb, 0x6b, 0x41, 0xcd } },
+	{ { 0x0e, 0x3e, 0xfc, 0xa8, 0xca, 0x3f, 0xd4, 0x5b, 0xb5, 0x26, 0x8a, 0xcb, 0x87, 0xed, 0xc6, 0x96, 0x47, 0x22, 0x0e, 0x93, 0x86, 0x4d, 0x12, 0x66 },
+	  { 0xe5, 0xd3, 0x9a, 0x5d, 0x7c, 0xa8, 0xc4, 0xf4, 0xaa, 0xfd, 0x3d, 0x85, 0x1c, 0x40, 0xc0, 0x16 } },
+	{ { 0x29, 0x08, 0x44, 0x59, 0x68, 0xd0, 0xa1, 0x8f, 0x50, 0xf5, 0x10, 0x96, 0xfb, 0x45, 0x02, 0x62, 0xed, 0xdf, 0x33, 0x16, 0x9a, 0x0d, 0xd2, 0x70 },
+	  { 0x98, 0x65, 0x70, 0x51, 0xb2, 0x3c, 0x69, 0x74, 0x1b, 0x2a, 0xb5, 0x06, 0xf8, 0x18, 0xfd, 0x3f } },
+	{ { 0x00, 0xfe, 0xb8, 0xbf, 0xfd, 0x6b, 0x4b, 0xcb, 0xc8, 0x90, 0x60, 0xc7, 0x49, 0x79, 0x6b, 0x16, 0xf6, 0xf5, 0x86, 0x10, 0x62, 0x15, 0x2f, 0x4f },
+	  { 0xc9, 0xb6, 0xe9, 0x5f, 0xb5, 0x4b, 0x54, 0x0a, 0xdc, 0x1f, 0xaa, 0x8c, 0xec, 0xe0, 0x02, 0x86 } },
+	{ { 0xbe, 0x96, 0xe1, 0x6f, 0xff, 0xe0, 0xa2, 0xdb, 0x01, 0x26, 0x89, 0x98, 0xfc, 0x32, 0x3f, 0x1c, 0x2a, 0xea, 0x2c, 0x9c, 0x8e, 0xf5, 0x2d, 0xc9 },
+	  { 0x5c, 0xf9, 0xf6, 0x1a, 0x3d, 0xd3, 0xa2, 0xf7, 0x6d, 0x57, 0x13, 0x84, 0xc8, 0x31, 0xae, 0x88 } },
+	{ { 0x41, 0xba, 0xf8, 0x17, 0x49, 0x0b, 0xf4, 0x9c, 0x5d, 0xdf, 0x7f, 0x82, 0xc1, 0xe1, 0x9d, 0xeb, 0x47, 0xbd, 0x3f, 0x18, 0x46, 0xc4, 0x83, 0x41 },
+	  { 0xdc, 0x6e, 0x6c, 0x13, 0x67, 0x99, 0x58, 0x96, 0x3b, 0x86, 0x48, 0x45, 0x7e, 0xb8, 0xa4, 0x15 } },
+	{ { 0xa4, 0xaf, 0xa1, 0xac, 0x95, 0x7b, 0x31, 0xfe, 0x81, 0xb1, 0x13, 0x91, 0xa6, 0x78, 0xc5, 0x7d, 0x7c, 0x3b, 0x77, 0x5d, 0x38, 0x7c, 0x27, 0x54 },
+	  { 0x03, 0x3f, 0x2b, 0x71, 0x89, 0xec, 0x7f, 0x2e, 0xf0, 0xc4, 0x96, 0xa8, 0x3f, 0x5c, 0x50, 0x51 } },
+	{ { 0x6a, 0x5b, 0x44, 0x86, 0x0a, 0x26, 0xa4, 0xff, 0x82, 0x8e, 0x38, 0xe0, 0x2f, 0x94, 0xba, 0x53, 0x8c, 0xff, 0xe1, 0xf5, 0x07, 0x20, 0x77, 0x05 },
+	  { 0x03, 0x27, 0x27, 0x20, 0x4d, 0x9b, 0x16, 0x96, 0x79, 0xef, 0xf2, 0xff, 0xe5, 0xf7, 0x1e, 0xfb } },
+	{ { 0xc8, 0x0d, 0x5e, 0xbc, 0x48, 0x69, 0x3f, 0xdc, 0x81, 0xa9, 0x1f, 0xc0, 0x62, 0x0f, 0xac, 0xc5, 0xf5, 0x10, 0x13, 0x0a, 0xe2, 0xd7, 0x69, 0xfe },
+	  { 0xd1, 0x98, 0x84, 0xaa, 0xae, 0x71, 0x0c, 0x58, 0x61, 0xff, 0xf7, 0x25, 0x1e, 0xa1, 0x43, 0xc8 } },
+	{ { 0xb9, 0xd3, 0x62, 0x90, 0xd5, 0x32, 0x4a, 0x83, 0x50, 0x31, 0x9b, 0x6a, 0xcc, 0x7e, 0xa0, 0x9d, 0x94, 0xef, 0xe4, 0x2f, 0xfc, 0x76, 0x2a, 0x36 },
+	  { 0x30, 0x97, 0xd3, 0x22, 0x45, 0x16, 0x3f, 0xcf, 0x4c, 0x57, 0x8e, 0x5a, 0x7d, 0xd2, 0x34, 0x9a } },
+	{ { 0x3d, 0x00, 0x40, 0x3b, 0xc3, 0xa0, 0xff, 0x5b, 0x60, 0xa6, 0x48, 0x48, 0x89, 0x68, 0x9f, 0x52, 0xd8, 0xb8, 0x6a, 0x75, 0x81, 0xa4, 0x1e, 0xac },
+	  { 0x39, 0xb6, 0x61, 0x5b, 0x1e, 0x04, 0x7b, 0x94, 0x69, 0xb3, 0xcf, 0xd7, 0x25, 0x19, 0x87, 0xc9 } },
+	{ { 0xbb, 0x85, 0xf6, 0x57, 0xf0, 0xd5, 0x24, 0x16, 0x59, 0x10, 0x29, 0x13, 0x97, 0x6c, 0xe4, 0xc6, 0xb1, 0x0b, 0xa5, 0xa2, 0xa4, 0xbd, 0x99, 0x65 },
+	  { 0x86, 0x81, 0x94, 0xc4, 0x4a, 0x68, 0xd8, 0xb4, 0x8e, 0x0e, 0xd4, 0xdb, 0xac, 0xde, 0xd1, 0x28 } },
+	{ { 0x7d, 0xb3, 0x63, 0x5b, 0xf7, 0xd5, 0x2f, 0x66, 0xdf, 0x91, 0xbd, 0xd7, 0xdd, 0x04, 0x3c, 0x72, 0x3f, 0x05, 0x71, 0x79, 0x08, 0x63, 0x48, 0x4d },
+	  { 0xd3, 0x24, 0xfd, 0x7d, 0xb1, 0xcf, 0xaa, 0x86, 0x51, 0x12, 0x80, 0xda, 0xfa, 0x53, 0x40, 0xe6 } },
+	{ { 0x14, 0x49, 0xe3, 0x2d, 0x51, 0xb3, 0x68, 0x0f, 0x0c, 0xb5, 0x40, 0xaa, 0x6c, 0xcb, 0x96, 0xf4, 0x6e, 0x17, 0xf1, 0xa3, 0xf2, 0x30, 0x08, 0xab },
+	  { 0x40, 0x9a, 0xa2, 0x5d, 0xcb, 0x51, 0xd8, 0x83, 0x1a, 0x2f, 0x56, 0x27, 0x74, 0x6c, 0x2b, 0xc9 } },
+	{ { 0x63, 0xd4, 0xb3, 0x3e, 0x24, 0xbf, 0x3f, 0x7c, 0x4c, 0x2f, 0xe2, 0xf7, 0xa7, 0x9a, 0x4e, 0x77, 0x74, 0x38, 0xa7, 0x84, 0x86, 0x5c, 0x23, 0x62 },
+	  { 0xbf, 0xa0, 0x34, 0x83, 0x98, 0xb9, 0xbc, 0x4e, 0x07, 0xeb, 0x17, 0x39, 0xc5, 0x89, 0xb2, 0x25 } },
+	{ { 0x03, 0xf2, 0x11, 0x69, 0xaa, 0xd2, 0x1a, 0xf3, 0xf3, 0x8f, 0xd6, 0x74, 0x3f, 0x23, 0xf2, 0x39, 0x73, 0xd3, 0xb0, 0xbd, 0x43, 0xd5, 0x91, 0x47 },
+	  { 0x13, 0x58, 0x2b, 0x48, 0x81, 0xe6, 0xb7, 0xf6, 0x39, 0x8f, 0x41, 0xb5, 0x7d, 0x61, 0x72, 0x01 } },
+	{ { 0x54, 0x18, 0x79, 0xf8, 0x77, 0x0a, 0xd3, 0x5d, 0xe0, 0xd7, 0xfd, 0x3c, 0xbe, 0xc5, 0x45, 0xcf, 0x4a, 0x5c, 0xf1, 0x08, 0x3e, 0xb4, 0xe3, 0x46 },
+	  { 0xd9, 0xd5, 0x80, 0x82, 0xc3, 0xa9, 0x76, 0x85, 0x2a, 0x35, 0x0b, 0xa5, 0x51, 0x86, 0x23, 0x62 } },
+	{ { 0xd0, 0xc6, 0x10, 0x0d, 0x7f, 0x8f, 0xdd, 0x87, 0x39, 0x02, 0x7d, 0xbe, 0x7d, 0x6c, 0x33, 0x4a, 0x60, 0x69, 0xfa, 0xad, 0x6f, 0x32, 0xc0, 0x24 },
+	  { 0x3c, 0xaf, 0xa1, 0x75, 0x06, 0xa9, 0x23, 0x59, 0xc2, 0x36, 0x00, 0x40, 0x4a, 0xd6, 0x15, 0x13 } },
+	{ { 0x05, 0x34, 0x56, 0x51, 0xac, 0x0d, 0x23, 0xb3, 0x05, 0xad, 0xdc, 0xcb, 0x7b, 0xc5, 0x10, 0x13, 0xa2, 0x5f, 0xfa, 0xed, 0x25, 0xe4, 0xd5, 0x37 },
+	  { 0xa4, 0xa3, 0x04, 0x18, 0x03, 0xfe, 0x9b, 0xf7, 0xd3, 0x55, 0xb3, 0x4d, 0x21, 0x29, 0x3e, 0xcf } },
+	{ { 0x4c, 0xe9, 0xe1, 0x10, 0x2c, 0xcb, 0xa4, 0x88, 0xa1, 0x0e, 0xd8, 0xd3, 0x78, 0x3b, 0x8b, 0xe4, 0x71, 0x0a, 0x49, 0xa0, 0x04, 0xcd, 0xeb, 0xf8 },
+	  { 0xcf, 0xa6, 0x74, 0xab, 0xa2, 0x2c, 0x17, 0x03, 0x6d, 0xa4, 0x37, 0x83, 0x2c, 0x63, 0x5b, 0x30 } },
+	{ { 0x08, 0xfe, 0xd0, 0xe9, 0x35, 0x0a, 0xc7, 0x38, 0x6e, 0xa8, 0xac, 0x78, 0xda, 0x17, 0x9c, 0xe7, 0x1c, 0xae, 0x7e, 0x23, 0x28, 0xae, 0xb0, 0xc8 },
+	  { 0xf4, 0xde, 0x16, 0x4a, 0x6c, 0xa9, 0x3e, 0x96, 0xdf, 0xc9, 0x14, 0x26, 0xd6, 0x36, 0xe4, 0x81 } },
+	{ { 0xcc, 0x56, 0x43, 0xba, 0x70, 0x4f, 0x96, 0x1c, 0x9a, 0x76, 0xba, 0x32, 0xb6, 0xbe, 0xa2, 0x71, 0xc3, 0x67, 0x6a, 0x05, 0xfe, 0x98, 0x54, 0x49 },
+	  { 0x1d, 0xeb, 0x55, 0x3a, 0xc9, 0x1e, 0xc3, 0x46, 0x20, 0x11, 0x54, 0xdb, 0xbd, 0xac, 0x9b, 0x14 } },
+	{ { 0xd4, 0x13, 0xa3, 0x79, 0x43, 0x9b, 0x2c, 0xaf, 0x87, 0x9d, 0xef, 0x08, 0x7f, 0xa0, 0x61, 0x37, 0xe3, 0x76, 0x3e, 0xde, 0x43, 0x34, 0xcf, 0x5d },
+	  { 0x52, 0x37, 0x24, 0x15, 0x20, 0x88, 0x49, 0xa2, 0x22, 0xac, 0xf6, 0xf2, 0x7e, 0x14, 0x5f, 0x75 } },
+	{ { 0x57, 0x5a, 0x3e, 0x57, 0x73, 0x6f, 0xe9, 0x6d, 0xd5, 0xaa, 0xcb, 0x1d, 0x5f, 0x28, 0x28, 0x95, 0xc1, 0xda, 0xc8, 0x2c, 0x3d, 0x20, 0x90, 0x28 },
+	  { 0x71, 0x0f, 0x70, 0x8e, 0x40, 0x23, 0x25, 0xc6, 0x76, 0x3c, 0xa4, 0x61, 0xf6, 0xf8, 0x55, 0xe0 } },
+	{ { 0x7d, 0x59, 0x3f, 0x39, 0x9f, 0x19, 0x8b, 0x9d, 0xa4, 0xa5, 0xbb, 0x93, 0x1f, 0x0b, 0x0d, 0x53, 0xb7, 0xe6, 0x6c, 0x4d, 0xcb, 0xd8, 0xc5, 0xc8 },
+	  { 0x8f, 0xae, 0x56, 0x69, 0x9e, 0x3a, 0xf5, 0x3b, 0x86, 0xd4, 0x84, 0xbe, 0x24, 0x63, 0xb6, 0x02 } },
+	{ { 0x40, 0x1e, 0x3d, 0x45, 0x9d, 0x72, 0x54, 0xa8, 0x2b, 0x0b, 0xed, 0xfa, 0x81, 0x31, 0xf8, 0x68, 0x31, 0x32, 0xe8, 0xf3, 0xef, 0xbb, 0x73, 0xca },
+	  { 0xaa, 0x44, 0x67, 0x8e, 0xfb, 0x43, 0x32, 0x67, 0x27, 0xd5, 0x20, 0x4e, 0xdc, 0x94, 0x2f, 0xe2 } },
+	{ { 0x99, 0x6d, 0x36, 0xde, 0x69, 0x4d, 0xc3, 0xcb, 0x81, 0x4f, 0x8a, 0x74, 0x7a, 0x72, 0xca, 0x0f, 0x16, 0xe7, 0xc8, 0xbd, 0x33, 0x2f, 0x5c, 0x28 },
+	  { 0xfb, 0x04, 0xca, 0xba, 0x31, 0x2e, 0x38, 0x75, 0x28, 0xa3, 0x55, 0xd3, 0x9d, 0xb1, 0x5d, 0xb6 } },
+	{ { 0xbb, 0xa2, 0xdd, 0xbf, 0x7c, 0xc0, 0x63, 0x95, 0x7a, 0x4b, 0x40, 0xce, 0x4b, 0x5c, 0xf2, 0x7a, 0x3e, 0x44, 0x9d, 0x6e, 0xae, 0x9e, 0x01, 0x9e },
+	  { 0x5d, 0x81, 0x56, 0x33, 0x52, 0x10, 0xcc, 0x39, 0x88, 0x5a, 0xb6, 0x52, 0xd8, 0xcc, 0xfd, 0x33 } },
+	{ { 0x5f, 0xdb, 0xf5, 0xf7, 0xb3, 0xb3, 0x89, 0xc7, 0x27, 0xca, 0x16, 0xfd, 0x19, 0x4c, 0x3e, 0x43, 0xb6, 0x1e, 0x2b, 0x3c, 0x76, 0x52, 0xfc, 0xad },
+	  { 0x8b, 0x8d, 0x34, 0x55, 0x18, 0x8a, 0xd9, 0x61, 0x5a, 0x2c, 0x3a, 0x34, 0xc4, 0xbf, 0xb8, 0xdf } },
+	{ { 0xfa, 0x87, 0x6e, 0xc6, 0x4e, 0x22, 0xb1, 0x6b, 0xac, 0x47, 0x22, 0xa8, 0x01, 0xc6, 0xe7, 0x22, 0xec, 0x32, 0x11, 0x08, 0xb2, 0xed, 0x44, 0x72 },
+	  { 0x1c, 0x5b, 0xab, 0x7b, 0x91, 0x03, 0x2f, 0xfa, 0xc3, 0xa8, 0xe4, 0xd4, 0x1a, 0x3a, 0x53, 0x38 } },
+	{ { 0xce, 0xed, 0xa6, 0x42, 0x21, 0xae, 0x37, 0xd3, 0xb0, 0x1c, 0x89, 0xd3, 0x90, 0xc5, 0xc8, 0xd8, 0x2f, 0x9a, 0xf5, 0xdc, 0xa8, 0xd7, 0x17, 0x4a },
+	  { 0xad, 0x98, 0xde, 0xf9, 0xc2, 0x4e, 0x9d, 0x0d, 0xe0, 0xe6, 0xa9, 0x54, 0x1c, 0x86, 0xc3, 0x4c } },
+	{ { 0xb2, 0xb6, 0xb9, 0x07, 0x47, 0x95, 0xf6, 0x50, 0x1d, 0x84, 0x57, 0x2a, 0x52, 0x8b, 0x55, 0xd5, 0xcf, 0x7c, 0x5c, 0x88, 0xb4, 0x51, 0xd4, 0x06 },
+	  { 0xee, 0x54, 0xa4, 0x10, 0xd2, 0xe4, 0x10, 0xe7, 0x21, 0xbf, 0x9b, 0x12, 0xf9, 0xa8, 0xbb, 0x04 } },
+	{ { 0x42, 0xe6, 0x92, 0x73, 0x95, 0xe5, 0xd3, 0xdb, 0xf3, 0xd0, 0xf3, 0x3a, 0x80, 0x6f, 0x45, 0x32, 0xee, 0xc3, 0xc7, 0x9a, 0x4d, 0xf9, 0x6f, 0x02 },
+	  { 0x7b, 0x89, 0x4a, 0x4e, 0x55, 0x14, 0x24, 0x90, 0x29, 0xaf, 0x11, 0x18, 0x57, 0x60, 0x93, 0xcc } },
+	{ { 0x07, 0x37, 0x3c, 0x87, 0x10, 0x02, 0xda, 0xaf, 0x88, 0x59, 0xb9, 0x74, 0xd5, 0x7b, 0x61, 0xa2, 0xc7, 0x6c, 0xd6, 0x82, 0x1a, 0x99, 0xfc, 0xce },
+	  { 0xf5, 0x55, 0xd9, 0x3e, 0x38, 0x13, 0x7c, 0x9b, 0x93, 0x1b, 0x45, 0x83, 0xde, 0x36, 0x7f, 0xf2 } },
+	{ { 0x8e, 0xeb, 0xc3, 0x22, 0xf6, 0x66, 0x30, 0x68, 0x7d, 0x0c, 0x60, 0x4a, 0xed, 0x68, 0x1d, 0x39, 0x54, 0x77, 0x93, 0x01, 0xc4, 0xaf, 0x83, 0x3c },
+	  { 0xf5, 0xad, 0xbb, 0x37, 0xc9, 0x96, 0x46, 0x91, 0x3d, 0x16, 0x70, 0xcc, 0xd8, 0x20, 0x3c, 0x04 } },
+	{ { 0x56, 0xd7, 0x0f, 0x07, 0xf9, 0x0e, 0x11, 0xab, 0x88, 0xa1, 0xdb, 0x7d, 0x24, 0xfe, 0x5b, 0xa8, 0x69, 0x61, 0xe3, 0xcd, 0x1c, 0x8f, 0xbf, 0x38 },
+	  { 0x12, 0x2f, 0x21, 0x49, 0x00, 0xff, 0xcf, 0xd5, 0x96, 0x52, 0xc1, 0xaf, 0x64, 0xb1, 0x0c, 0x71 } },
+	{ { 0xcf, 0x4e, 0xc9, 0xb7, 0xf5, 0x2c, 0xd2, 0xd9, 0x9a, 0x8e, 0xfa, 0x34, 0x24, 0x01, 0x94, 0x7d, 0xff, 0x33, 0x22, 0x62, 0x78, 0x3e, 0xb3, 0x49 },
+	  { 0xbe, 0x1b, 0x5d, 0x5a, 0xc7, 0xb6, 0x1b, 0x73, 0xc4, 0x79, 0xd7, 0xb1, 0xfc, 0x65, 0xea, 0x35 } },
+	{ { 0x8c, 0xa5, 0xb0, 0xfe, 0x10, 0x53, 0xb3, 0x98, 0x24, 0x95, 0xa7, 0x6e, 0xe3, 0xb7, 0x8f, 0x0e, 0x3b, 0x4a, 0xf5, 0xd3, 0x84, 0x5b, 0x59, 0x7c },
+	  { 0xf9, 0x86, 0x8b, 0x44, 0xc1, 0xce, 0x21, 0xb0, 0x40, 0xb8, 0xff, 0xf3, 0x71, 0x6b, 0x01, 0x1a } },
+	{ { 0x34, 0xf2, 0xce, 0x0d, 0xbb, 0x3f, 0xa2, 0xd2, 0xdd, 0x13, 0x2c, 0x2a, 0x22, 0x79, 0xae, 0xbe, 0x7b, 0xf2, 0x0a, 0x20, 0xf5, 0x30, 0x58, 0x66 },
+	  { 0x9c, 0xac, 0x4e, 0xfb, 0x17, 0x0d, 0xc8, 0xde, 0xd3, 0xfc, 0x6a, 0x30, 0x9f, 0xd7, 0xac, 0xa7 } },
+	{ { 0x60, 0x3b, 0xbb, 0x7b, 0xf5, 0x4b, 0x36, 0x5d, 0x41, 0xbf, 0x62, 0xd1, 0x35, 0x74, 0x66, 0x60, 0xa8, 0x0e, 0x60, 0x10, 0x6a, 0xe7, 0xf4, 0xc1 },
+	  { 0xe5, 0x2a, 0x42, 0xe7, 0x80, 0x48, 0xc6, 0xdd, 0xa6, 0x3f, 0x98, 0xfc, 0x6c, 0x5f, 0x47, 0xf9 } },
+	{ { 0xa1, 0x46, 0xac, 0x00, 0x0c, 0xb1, 0xf1, 0x4b, 0xa4, 0x95, 0x20, 0x36, 0xb5, 0x3c, 0xa0, 0xbd, 0x0e, 0x31, 0xf8, 0xec, 0x06, 0xb8, 0xb3, 0x38 },
+	  { 0x82, 0x6a, 0xf4, 0x73, 0xc6, 0x0d, 0x61, 0xbd, 0x74, 0x6a, 0x8d, 0x8b, 0xda, 0x3b, 0x41, 0x0c } },
+	{ { 0x97, 0x9e, 0x02, 0x46, 0xf7, 0x5d, 0x08, 0xe2, 0x26, 0xff, 0xd4, 0x45, 0x73, 0x31, 0xc1, 0x00, 0x7a, 0x5b, 0x75, 0x67, 0xdc, 0x83, 0xf2, 0x34 },
+	  { 0x9f, 0xa4, 0xeb, 0xdc, 0xca, 0xce, 0x90, 0x33, 0xa5, 0x6e, 0x3a, 0x5a, 0xac, 0xe7, 0x4d, 0xba } },
+	{ { 0x3c, 0x34, 0xcf, 0x05, 0x82, 0x1c, 0x9d, 0x17, 0xb9, 0x5b, 0x3f, 0x99, 0xb9, 0xff, 0x51, 0x33, 0xdf, 0x35, 0x4f, 0x3d, 0x70, 0x64, 0xbf, 0x8e },
+	  { 0xe0, 0xac, 0x5d, 0xee, 0x9d, 0x62, 0x47, 0xd5, 0x0b, 0x37, 0x95, 0x89, 0xc2, 0x41, 0x54, 0x44 } },
+	{ { 0x3e, 0x42, 0xac, 0x26, 0xf6, 0xc0, 0x97, 0x7a, 0x59, 0xf7, 0x62, 0x77, 0x24, 0x9d, 0x16, 0xe6, 0xd4, 0x02, 0xda, 0xb4, 0xb2, 0x25, 0xeb, 0xca },
+	  { 0x46, 0x25, 0x62, 0xda, 0x72, 0xea, 0x6b, 0x5c, 0x37, 0x15, 0x30, 0xc7, 0x16, 0x87, 0x9d, 0xcd } },
+	{ { 0xed, 0x7e, 0xdf, 0xf1, 0x58, 0x90, 0xf7, 0x84, 0x1f, 0xd2, 0x00, 0xad, 0x56, 0x77, 0x7d, 0xba, 0xe3, 0x17, 0xea, 0x73, 0xa4, 0xa2, 0x76, 0x07 },
+	  { 0x78, 0xa0, 0x40, 0x00, 0x9e, 0x18, 0xef, 0x20, 0x72, 0x53, 0xef, 0x99, 0x2e, 0x7e, 0x2c, 0x91 } },
+	{ { 0x41, 0x40, 0x88, 0x20, 0x41, 0x91, 0x21, 0x62, 0x67, 0x72, 0x40, 0xad, 0xc8, 0x6f, 0x92, 0x9a, 0x91, 0x44, 0x05, 0xea, 0x8a, 0xdc, 0x5a, 0x96 },
+	  { 0xf8, 0xc7, 0xa7, 0x9f, 0x10, 0xc9, 0x2e, 0xc4, 0x9e, 0x1e, 0xc5, 0x9b, 0x08, 0x49, 0x8d, 0x64 } },
+	{ { 0x2c, 0xbc, 0x00, 0xf6, 0x0f, 0x66, 0x69, 0x5a, 0x9f, 0xb5, 0xe7, 0x32, 0xd8, 0xa6, 0xbc, 0x5e, 0x0f, 0x5a, 0xc0, 0x71, 0x82, 0x95, 0xd7, 0xf2 },
+	  { 0x2f, 0x9a, 0x5f, 0x2c, 0xfd, 0x51, 0x5a, 0x68, 0x78, 0xec, 0xd9, 0x23, 0xc3, 0x6b, 0x1b, 0x4e } },
+	{ { 0xce, 0x98, 0x54, 0xaa, 0x7b, 0x6e, 0x18, 0x4a, 0xb0, 0x2f, 0xb8, 0x1e, 0x25, 0xf7, 0xe6, 0x36, 0x77, 0xb6, 0x19, 0x52, 0x41, 0xfe, 0xcc, 0xbc },
+	  { 0xf7, 0xd3, 0xb3, 0x75, 0x8e, 0xcf, 0x53, 0x59, 0xab, 0x52, 0x3b, 0xea, 0xa1, 0x7a, 0x03, 0x06 } },
+	{ { 0x93, 0x16, 0x3a, 0xe2, 0x8f, 0x22, 0x57, 0x0b, 0x47, 0xfc, 0x0b, 0x6b, 0xab, 0x38, 0xb5, 0x6f, 0xdc, 0xe4, 0x22, 0xb8, 0xe0, 0x84, 0xcf, 0xba },
+	  { 0x6c, 0x9d, 0xd0, 0x76, 0x75, 0x0b, 0xd1, 0xd2, 0xc0, 0xb8, 0xf2, 0x03, 0xca, 0x14, 0xee, 0x1e } },
+	{ { 0xca, 0x2a, 0x78, 0x82, 0xdb, 0x1c, 0xb3, 0xb5, 0x2b, 0x61, 0xdb, 0x1d, 0xde, 0x33, 0x64, 0xbd, 0x1c, 0x5c, 0xd0, 0xbb, 0x2a, 0x90, 0x21, 0xa4 },
+	  { 0x28, 0x9c, 0xf1, 0xab, 0x3b, 0x9e, 0xac, 0x26, 0xcd, 0xd0, 0x2d, 0xf2, 0x44, 0x41, 0x2d, 0x4e } },
+	{ { 0x90, 0xdc, 0x3a, 0x02, 0xba, 0x5b, 0x5f, 0x2b, 0x03, 0xfd, 0x2a, 0xb6, 0xe5, 0xad, 0xc8, 0x9b, 0xd1, 0x8c, 0xfd, 0x49, 0x6e, 0xd1, 0x0c, 0xea },
+	  { 0x8e, 0xe4, 0xca, 0x3c, 0x6c, 0x9c, 0xc5, 0xf2, 0x7d, 0xdb, 0x79, 0xae, 0x7c, 0xfc, 0xc4, 0x7e } },
+	{ { 0x11, 0xb2, 0x6d, 0x4f, 0x3e, 0xb7, 0x7d, 0x21, 0x8d, 0x19, 0xe0, 0x8a, 0x89, 0x31, 0x0d, 0x69, 0xac, 0x57, 0x84, 0xe7, 0x12, 0x2d, 0xc8, 0x94 },
+	  { 0x6c, 0xbf, 0x94, 0xfc, 0xdc, 0xad, 0xfd, 0x9a, 0x39, 0xd4, 0xc4, 0xf7, 0x02, 0xd7, 0xb1, 0x01 } },
+	{ { 0x71, 0x59, 0xcd, 0x86, 0x84, 0xc2, 0x80, 0x39, 0xe1, 0xa6, 0x74, 0x76, 0x55, 0x9c, 0xf0, 0xf3, 0x95, 0x83, 0x40, 0x10, 0x10, 0xfa, 0x79, 0x95 },
+	  { 0x50, 0x47, 0x27, 0x0d, 0xb2, 0x33, 0xf7, 0x5e, 0x84, 0xc7, 0x34, 0xb5, 0xcb, 0x56, 0xf7, 0x65 } },
+	{ { 0x76, 0xbb, 0xdc, 0x75, 0xf5, 0x30, 0xec, 0x0a, 0xb1, 0xe1, 0x53, 0x7b, 0xe7, 0xaf, 0x07, 0xad, 0x11, 0x44, 0x74, 0xa5, 0xdb, 0xac, 0x8e, 0xf0 },
+	  { 0xb8, 0x26, 0x02, 0xcd, 0x22, 0xe7, 0x82, 0x1b, 0xe6, 0x2e, 0x5f, 0xf6, 0x7c, 0xb1, 0x93, 0xc6 } },
+	{ { 0x30, 0x6a, 0x47, 0x20, 0x86, 0x7e, 0xca, 0x70, 0x09, 0xc7, 0x51, 0xb6, 0xc5, 0x48, 0x85, 0xb6, 0xf7, 0x6a, 0x2b, 0x53, 0xa7, 0x1d, 0x1d, 0x36 },
+	  { 0x5a, 0x24, 0x1f, 0xbc, 0xb4, 0xa0, 0xf7, 0x69, 0xc3, 0x74, 0x08, 0xab, 0xe6, 0x58, 0xda, 0x25 } },
+	{ { 0x30, 0x63, 0x23, 0xbb, 0xf5, 0x3b, 0xd8, 0x4f, 0x53, 0xe3, 0x4e, 0x0a, 0x71, 0xe8, 0x72, 0xdf, 0x34, 0x1e, 0x23, 0xf8, 0x41, 0x45, 0xc7, 0x13 },
+	  { 0x9a, 0x63, 0xd9, 0x56, 0xa9, 0xc7, 0x19, 0x46, 0x5e, 0x30, 0xcd, 0xc1, 0x60, 0x99, 0x10, 0x42 } },
+	{ { 0x89, 0x7b, 0x6f, 0x11, 0xec, 0xb9, 0x78, 0x62, 0xc9, 0x80, 0x97, 0x5c, 0xd8, 0x2f, 0x6b, 0x99, 0x6a, 0x2e, 0xee, 0x39, 0x21, 0xdc, 0xd7, 0x51 },
+	  { 0x2a, 0x73, 0x3f, 0x40, 0x7d, 0x80, 0x80, 0x47, 0x0c, 0x5f, 0x22, 0xa6, 0xcf, 0x83, 0x58, 0xcd } },
+	{ { 0x14, 0xfa, 0x0e, 0x99, 0x78, 0x67, 0x2a, 0xd5, 0xe3, 0xf3, 0xa8, 0x1c, 0xa5, 0xaf, 0xeb, 0xde, 0x66, 0x71, 0xcc, 0x9f, 0xee, 0x5f, 0x8f, 0x9c },
+	  { 0x24, 0xdb, 0x9f, 0x77, 0xf6, 0x10, 0x60, 0xac, 0xcf, 0x6d, 0x41, 0xe7, 0x63, 0x9c, 0x1e, 0xc6 } },
+	{ { 0xc1, 0x12, 0x5a, 0x27, 0xa8, 0x5e, 0x38, 0x26, 0xc7, 0x28, 0x37, 0x6b, 0x53, 0xbf, 0x8b, 0x72, 0xa9, 0x1c, 0x8d, 0x78, 0x8d, 0xc3, 0x91, 0x5a },
+	  { 0xa8, 0x9e, 0xcc, 0xce, 0x6e, 0xe8, 0xc9, 0xd4, 0xd3, 0x4c, 0xf5, 0xba, 0x8b, 0x29, 0xcb, 0xa7 } },
+	{ { 0x1c, 0xe3, 0x85, 0xac, 0x9c, 0x70, 0xd4, 0xe2, 0x6f, 0xb6, 0xfb, 0xa5, 0x3d, 0x57, 0x42, 0xa6, 0x7a, 0x50, 0x78, 0xc2, 0x06, 0xea, 0x5a, 0xfd },
+	  { 0xe4, 0xef, 0x08, 0xe8, 0x61, 0x41, 0x94, 0x0e, 0xf8, 0x7d, 0x6b, 0x38, 0x5d, 0x19, 0x10, 0x8c } },
+	{ { 0x9a, 0x39, 0x67, 0xa8, 0xff, 0x01, 0xd3, 0x5f, 0x8b, 0x59, 0xf3, 0x4d, 0x5c, 0x16, 0xd6, 0xa8, 0x82, 0x2d, 0x13, 0xfa, 0x5b, 0xf3, 0x4a, 0x71 },
+	  { 0x10, 0x39, 0xc4, 0x41, 0x00, 0x7d, 0x68, 0x05, 0x55, 0x1a, 0x87, 0xe8, 0x20, 0xc6, 0x3d, 0xca } },
+	{ { 0x7d, 0x0a, 0xf1, 0xcd, 0x0d, 0x64, 0x1f, 0x20, 0x9b, 0x60, 0x37, 0x0c, 0x5c, 0x6b, 0xbe, 0xad, 0xd7, 0x37, 0x94, 0x12, 0x7b, 0x35, 0x77, 0xbb },
+	  { 0x25, 0x84, 0xb5, 0x5b, 0x21, 0x4a, 0x94, 0xee, 0x98, 0x94, 0xb1, 0x04, 0x17, 0x8a, 0x6d, 0xd5 } },
+	{ { 0x3f, 0x78, 0xd2, 0x95, 0x44, 0x99, 0x08, 0xe6, 0xbe, 0xe4, 0x82, 0x57, 0x7d, 0x21, 0x2a, 0x43, 0x4f, 0xa3, 0x25, 0x16, 0x6c, 0xbf, 0x1a, 0x6e },
+	  { 0x9d, 0x32, 0xbd, 0x63, 0x57, 0x55, 0x10, 0x91, 0xca, 0x65, 0x9f, 0x7b, 0xd4, 0x50, 0x9f, 0xc2 } },
+	{ { 0x9c, 0xd2, 0x8f, 0x26, 0x5a, 0x13, 0x55, 0x61, 0x23, 0xd6, 0x3f, 0x34, 0x2a, 0x74, 0x3a, 0xd2, 0x85, 0xc6, 0xba, 0x6d, 0xb8, 0xef, 0x85, 0xac },
+	  { 0x9a, 0xc4, 0x6e, 0xb8, 0xe2, 0x53, 0xbb, 0x37, 0x30, 0x43, 0x94, 0xff, 0x00, 0x42, 0xd3, 0x06 } },
+	{ { 0x34, 0xca, 0xf5, 0x80, 0x01, 0x41, 0x64, 0xd4, 0xb9, 0x12, 0x51, 0x8c, 0xc8, 0x27, 0x81, 0xe5, 0xb5, 0x85, 0x2e, 0x92, 0xb8, 0xad, 0x56, 0xaa },
+	  { 0x3b, 0x89, 0x9f, 0x1f, 0x2d, 0x93, 0xe3, 0x89, 0x04, 0x18, 0x76, 0x3f, 0xdd, 0x35, 0x94, 0x3a } },
+	{ { 0x7c, 0x19, 0xa5, 0x0f, 0xa9, 0x36, 0x00, 0x41, 0x82, 0x9b, 0xce, 0x93, 0xe5, 0xb4, 0x62, 0x6c, 0xb1, 0x9d, 0x58, 0xad, 0x65, 0x98, 0xc2, 0x90 },
+	  { 0xea, 0x89, 0xd4, 0x53, 0x77, 0x84, 0xf2, 0x53, 0xea, 0xe2, 0xd6, 0xce, 0xbd, 0xd6, 0x3a, 0x4c } },
+	{ { 0x21, 0x09, 0xb2, 0x88, 0x04, 0x79, 0xbb, 0x4f, 0x68, 0x12, 0x1a, 0xc0, 0x92, 0x30, 0x90, 0x3f, 0x5b, 0x7f, 0x8e, 0x63, 0xd8, 0x4e, 0xf8, 0xdc },
+	  { 0x80, 0x71, 0x1a, 0x42, 0xf6, 0x68, 0x7a, 0x62, 0x59, 0x0a, 0x8a, 0x0d, 0x16, 0x5b, 0x2f, 0xb8 } },
+	{ { 0x83, 0xfe, 0x68, 0x2b, 0x1f, 0xcd, 0xb5, 0x7b, 0xe8, 0x63, 0x00, 0x82, 0x64, 0x58, 0xea, 0x5d, 0x02, 0x75, 0x04, 0x6e, 0xce, 0x15, 0xd7, 0x64 },
+	  { 0xb2, 0x17, 0x4f, 0xfa, 0xb7, 0x55, 0xe3, 0xe0, 0xc6, 0x66, 0xce, 0xcb, 0x07, 0x52, 0x56, 0xec } },
+	{ { 0x63, 0x43, 0x4f, 0x6c, 0x69, 0xc0, 0x41, 0x73, 0x5a, 0x74, 0x4f, 0x78, 0xd3, 0x0d, 0x09, 0xbd, 0xc4, 0x13, 0xca, 0xa5, 0xc9, 0x47, 0x81, 0x88 },
+	  { 0x57, 0x12, 0x03, 0x86, 0xbd, 0x56, 0x6d, 0x31, 0x80, 0x7a, 0x6f, 0xe7, 0xb0, 0xe7, 0x80, 0x41 } },
+	{ { 0xdf, 0xa4, 0xb3, 0xf9, 0x9e, 0xda, 0x96, 0x42, 0x0d, 0x66, 0x4c, 0xfe, 0x6e, 0x5b, 0x64, 0x8c, 0x44, 0x69, 0xa5, 0x42, 0x79, 0xa0, 0x01, 0xc9 },
+	  { 0x3b, 0x12, 0x8f, 0xcd, 0xb7, 0xbb, 0x42, 0x52, 0xb5, 0xe5, 0xe0, 0x0d, 0xf5, 0x62, 0x95, 0x08 } },
+	{ { 0x24, 0xfa, 0x37, 0xbb, 0x6d, 0x70, 0xbd, 0x94, 0x36, 0x74, 0xc3, 0x33, 0xd9, 0xe0, 0x26, 0xde, 0xf1, 0x8c, 0x45, 0x4f, 0x8c, 0xc2, 0x94, 0xc1 },
+	  { 0x48, 0x26, 0xcf, 0x69, 0xd8, 0x3c, 0x7f, 0x47, 0x52, 0x30, 0x67, 0x9b, 0x61, 0xca, 0x8e, 0x0a } },
+	{ { 0x24, 0x6a, 0x74, 0x08, 0xf7, 0x39, 0xd1, 0xd3, 0x7e, 0x52, 0x0c, 0x5a, 0x01, 0xdc, 0x59, 0x99, 0xa3, 0xbc, 0x22, 0xd4, 0xed, 0x08, 0x1a, 0xcb },
+	  { 0x25, 0xa2, 0x3c, 0x7f, 0xb7, 0x98, 0xa5, 0x0f, 0x59, 0x29, 0xe9, 0x0e, 0x74, 0x3d, 0xa1, 0x1c } },
+	{ { 0x9f, 0x18, 0x27, 0xbe, 0x83, 0x51, 0x8d, 0xbc, 0x5b, 0xf0, 0x30, 0x25, 0xb6, 0x44, 0xfc, 0x96, 0xfa, 0x95, 0xcb, 0xda, 0x99, 0x35, 0xbb, 0xd7 },
+	  { 0x76, 0x39, 0xe9, 0xf9, 0x02, 0xd6, 0x5f, 0xeb, 0x6b, 0xc5, 0xcb, 0xc4, 0x4b, 0x5e, 0x12, 0xed } },
+	{ { 0xfd, 0xa6, 0xb0, 0xd1, 0x64, 0xb7, 0xfd, 0x98, 0x2d, 0xc9, 0xd9, 0xdc, 0xb4, 0x92, 0xa3, 0x7d, 0x91, 0x50, 0x00, 0x1e, 0xd2, 0x6b, 0xa9, 0x3a },
+	  { 0x85, 0xa7, 0x1e, 0xe4, 0x57, 0xe9, 0x4f, 0xc8, 0x5c, 0xb9, 0xac, 0x46, 0x1f, 0xff, 0x1c, 0x4f } },
+	{ { 0x07, 0x55, 0xb8, 0x6a, 0x47, 0x0b, 0xb9, 0x3a, 0xa8, 0x6e, 0xc7, 0x38, 0xe3, 0x7b, 0xec, 0xb5, 0xcd, 0xe9, 0xac, 0x58, 0xcd, 0x94, 0xb5, 0x75 },
+	  { 0xc9, 0xef, 0x84, 0xa2, 0x68, 0x87, 0x7e, 0xce, 0xf8, 0x8b, 0xb5, 0x54, 0xea, 0x63, 0xc3, 0x36 } },
+	{ { 0x8f, 0x13, 0xf2, 0xd9, 0x08, 0x50, 0x91, 0x81, 0x61, 0x81, 0x43, 0x9a, 0x8b, 0xfc, 0x92, 0x7b, 0x35, 0x62, 0x19, 0x0c, 0x27, 0xf7, 0x76, 0x43 },
+	  { 0x26, 0x0d, 0xd6, 0xbf, 0x13, 0x66, 0xc0, 0x29, 0xb5, 0xfd, 0x64, 0xe7, 0x28, 0x53, 0xd2, 0xd7 } },
+	{ { 0xfd, 0xd7, 0x1c, 0x52, 0x4c, 0x37, 0x43, 0x45, 0x47, 0x8c, 0x95, 0x25, 0x98, 0x9a, 0x52, 0x52, 0x80, 0x9f, 0x7d, 0xeb, 0x0f, 0xa4, 0xa4, 0x94 },
+	  { 0x39, 0xcc, 0x3e, 0x22, 0x47, 0x38, 0xef, 0xaa, 0xf4, 0x5f, 0xab, 0x52, 0x5f, 0xc1, 0x31, 0x27 } },
+	{ { 0x8b, 0xd4, 0x3e, 0x3f, 0x44, 0x87, 0x78, 0xea, 0x7e, 0x40, 0xab, 0x07, 0xdf, 0xa2, 0xbd, 0xf8, 0x74, 0xc0, 0xd6, 0xb9, 0x50, 0x65, 0x95, 0xb3 },
+	  { 0x4d, 0x5a, 0xc8, 0x50, 0x6c, 0x0a, 0x13, 0xb1, 0xc2, 0x09, 0x27, 0x31, 0xc6, 0xfe, 0x5f, 0xbc } },
+	{ { 0x69, 0xb7, 0x44, 0x9d, 0xc8, 0x11, 0xb1, 0x9c, 0x33, 0x1a, 0x63, 0x57, 0xb3, 0xa8, 0xae, 0x49, 0xb6, 0xc9, 0xf1, 0x88, 0x96, 0x9b, 0xca, 0x0f },
+	  { 0xed, 0xe6, 0x9b, 0xd8, 0x0f, 0x87, 0x9d, 0x57, 0x64, 0x0c, 0x77, 0xbc, 0x13, 0x12, 0xf0, 0x64 } },
+	{ { 0x40, 0xe1, 0x69, 0x2d, 0x44, 0xe3, 0xb4, 0x41, 0xde, 0xfc, 0xf8, 0x8f, 0xbc, 0x2f, 0x33, 0x1e, 0xd2, 0xc5, 0x86, 0x34, 0x85, 0x89, 0x3a, 0x6b },
+	  { 0x31, 0xdc, 0x85, 0x4d, 0x85, 0x52, 0xe6, 0x68, 0x49, 0x04, 0xbc, 0x65, 0x02, 0x68, 0x24, 0x34 } },
+	{ { 0xc1, 0xde, 0x7d, 0x92, 0x85, 0x75, 0x11, 0x38, 0xef, 0x20, 0x7d, 0xc2, 0x39, 0x7d, 0xd5, 0x76, 0x9b, 0xc1, 0x3a, 0x51, 0x87, 0xe1, 0x1e, 0x5f },
+	  { 0xc7, 0xbd, 0xc5, 0x7a, 0xaa, 0x44, 0x5e, 0x48, 0x96, 0x55, 0x15, 0x4b, 0x25, 0xd3, 0x90, 0x6d } },
+	{ { 0xd8, 0x68, 0x9f, 0xdc, 0xc9, 0xb7, 0x72, 0x27, 0x28, 0x9d, 0xb8, 0xb8, 0x93, 0x39, 0x8b, 0x3e, 0x0d, 0x94, 0x2f, 0x1a, 0xa2, 0x32, 0x8e, 0x32 },
+	  { 0xc4, 0xb4, 0x98, 0x47, 0x0a, 0x24, 0x11, 0x3b, 0x6b, 0x18, 0x26, 0x74, 0xc0, 0x36, 0x61, 0x31 } },
+	{ { 0x82, 0x93, 0xa9, 0x98, 0x63, 0x3a, 0x40, 0x5d, 0xec, 0x29, 0x20, 0xff, 0x99, 0x1d, 0x9a, 0x05, 0x66, 0x8c, 0x09, 0x6e, 0x62, 0x04, 0xef, 0x03 },
+	  { 0x75, 0x75, 0x10, 0x4d, 0xa6, 0xd5, 0xb4, 0xe0, 0xfb, 0x21, 0xd6, 0x82, 0xf9, 0x3d, 0x0d, 0x24 } },
+	{ { 0xe7, 0x1e, 0x9c, 0x09, 0x18, 0xc9, 0x08, 0xae, 0x99, 0x5c, 0x30, 0xb2, 0x3f, 0xc8, 0x2e, 0xe5, 0x9d, 0xad, 0xdf, 0xec, 0x9b, 0x39, 0xe2, 0x27 },
+	  { 0xc5, 0xac, 0xdc, 0x31, 0x83, 0x53, 0xc4, 0xef, 0x3f, 0x6f, 0x45, 0xbf, 0x4a, 0x84, 0xc6, 0x59 } },
+	{ { 0xa5, 0xf1, 0x9f, 0x39, 0x2e, 0xb2, 0xaf, 0xd1, 0x5c, 0xf0, 0xec, 0x83, 0xbc, 0x9b, 0xea, 0x0a, 0xa2, 0xc2, 0x9a, 0x53, 0xd1, 0xbd, 0x24, 0x7e },
+	  { 0xaf, 0x6a, 0x60, 0xf6, 0x0f, 0xc0, 0x85, 0x65, 0x6e, 0x30, 0x5a, 0x4c, 0x05, 0x0c, 0xc9, 0xc3 } },
+	{ { 0x18, 0x0b, 0x05, 0xbf, 0xf1, 0x3a, 0x1a, 0xd3, 0xf3, 0x9a, 0x8c, 0x75, 0xb3, 0x5b, 0x6f, 0x6f, 0xcc, 0xf2, 0xc0, 0x1f, 0xd4, 0xb1, 0xed, 0xbd },
+	  { 0x9d, 0x5f, 0x30, 0xe4, 0x88, 0xc3, 0x24, 0x3a, 0xd2, 0x07, 0x67, 0xb3, 0x9e, 0xc9, 0xee, 0x4e } },
+	{ { 0x1f, 0xb7, 0xff, 0x20, 0xca, 0xb8, 0xa5, 0x18, 0x6e, 0xc5, 0xbc, 0x91, 0x3b, 0x98, 0x4b, 0x55, 0x1e, 0xf5, 0xa7, 0xac, 0x4a, 0x78, 0x03, 0xf3 },
+	  { 0x5c, 0x3a, 0x1d, 0x14, 0x4e, 0x5e, 0xfe, 0x7c, 0xed, 0xe8, 0x8e, 0x21, 0xdc, 0xbc, 0x27, 0x77 } },
+	{ { 0x3e, 0x99, 0x97, 0x61, 0xc9, 0xd1, 0x5f, 0x39, 0x32, 0xff, 0xa1, 0x85, 0x75, 0xc6, 0xb5, 0x29, 0xf3, 0x1d, 0x29, 0x8d, 0x96, 0xc4, 0x24, 0x84 },
+	  { 0x4f, 0x16, 0x3c, 0x25, 0xa6, 0xd5, 0x45, 0xcc, 0xff, 0xc5, 0x45, 0x11, 0xb2, 0xa5, 0x60, 0x5d } },
+	{ { 0x8b, 0xc1, 0xe5, 0x31, 0xe9, 0xd3, 0xf8, 0x4f, 0x7d, 0xe9, 0x9d, 0xa0, 0xd3, 0x13, 0xf0, 0xe5, 0x0c, 0xd8, 0x6c, 0x9c, 0x24, 0x61, 0x44, 0xd9 },
+	  { 0x3e, 0xed, 0x65, 0xda, 0xb0, 0xbd, 0x7a, 0xe8, 0xc8, 0xb1, 0x15, 0xfa, 0x18, 0x5e, 0x31, 0x0a } },
+	{ { 0x4e, 0xfa, 0xae, 0x2e, 0x7e, 0xca, 0xdc, 0xd2, 0x43, 0x04, 0xf8, 0x7a, 0x63, 0xae, 0x8a, 0x0d, 0xc4, 0x69, 0x79, 0x66, 0x3c, 0x3f, 0x75, 0xd3 },
+	  { 0xfe, 0xfc, 0xe0, 0xda, 0x5a, 0xf3, 0x88, 0x5d, 0x02, 0x26, 0x36, 0xf1, 0x9a, 0xda, 0xb9, 0xb8 } },
+	{ { 0x44, 0xe1, 0x22, 0x4d, 0x08, 0x47, 0x6e, 0x9c, 0xbd, 0xf8, 0x18, 0xa0, 0x39, 0x5d, 0x02, 0x50, 0xc6, 0x4f, 0x4f, 0x97, 0xa6, 0xe5, 0xcc, 0x6b },
+	  { 0x3a, 0x0c, 0x3d, 0x80, 0x6a, 0xff, 0x32, 0xfd, 0xe8, 0x68, 0x34, 0x3b, 0x0b, 0x58, 0xc7, 0x7a } },
+	{ { 0xef, 0x93, 0xff, 0xb9, 0xeb, 0x0b, 0x9f, 0x17, 0x87, 0xf4, 0x25, 0x20, 0x53, 0xa2, 0x30, 0xad, 0x2e, 0x27, 0x7b, 0xac, 0xad, 0xbd, 0x0b, 0x11 },
+	  { 0x66, 0x10, 0xee, 0x19, 0x97, 0x0e, 0xe6, 0x06, 0x08, 0x39, 0x68, 0xe5, 0x23, 0xaf, 0x23, 0x70 } },
+	{ { 0xfc, 0x7c, 0x2c, 0x3d, 0x27, 0x51, 0x90, 0x36, 0xe1, 0xe4, 0xcb, 0x39, 0xc4, 0xac, 0xd6, 0xab, 0x26, 0x1e, 0x13, 0x49, 0x8e, 0x12, 0x28, 0x61 },
+	  { 0x2f, 0x71, 0x4d, 0xdb, 0xd4, 0xad, 0xf8, 0x32, 0x7d, 0xc9, 0x3c, 0x72, 0x3a, 0xeb, 0xff, 0xfa } },
+	{ { 0xf2, 0xf8, 0xa8, 0x24, 0x77, 0x24, 0xe2, 0x89, 0xce, 0x95, 0x86, 0xe2, 0x10, 0x01, 0x2e, 0x99, 0x5b, 0xd7, 0x2f, 0x3b, 0xb4, 0xf9, 0xd7, 0x9b },
+	  { 0x5d, 0x11, 0x96, 0xda, 0x8f, 0x18, 0x49, 0x75, 0xe2, 0x40, 0x94, 0x9a, 0x25, 0x10, 0x45, 0x54 } },
+};
+
+const unsigned char ECBMCT256_seed[16] = { 0xb3, 0x79, 0x77, 0x7f, 0x90, 0x50, 0xe2, 0xa8, 0x18, 0xf2, 0x94, 0x0c, 0xbb, 0xd9, 0xab, 0xa4 };
+
+const aes_mct_record256 ECBMCT256[] = {
+	{ { 0xf9, 0xe8, 0x38, 0x9f, 0x5b, 0x80, 0x71, 0x2e, 0x38, 0x86, 0xcc, 0x1f, 0xa2, 0xd2, 0x8a, 0x3b, 0x8c, 0x9c, 0xd8, 0x8a, 0x2d, 0x4a, 0x54, 0xc6, 0xaa, 0x86, 0xce, 0x0f, 0xef, 0x94, 0x4b, 0xe0 },
+	  { 0x68, 0x93, 0xeb, 0xaf, 0x0a, 0x1f, 0xcc, 0xc7, 0x04, 0x32, 0x65, 0x29, 0xfd, 0xfb, 0x60, 0xdb } },
+	{ { 0xdb, 0x9e, 0xa5, 0xa2, 0x28, 0x4f, 0xa1, 0x7f, 0xb6, 0x3e, 0x13, 0xbf, 0x89, 0x1c, 0x8e, 0x42, 0xe4, 0x0f, 0x33, 0x25, 0x27, 0x55, 0x98, 0x01, 0xae, 0xb4, 0xab, 0x26, 0x12, 0x6f, 0x2b, 0x3b },
+	  { 0xf3, 0xc7, 0x8a, 0x5e, 0x85, 0xe5, 0x43, 0x9b, 0xf2, 0x6d, 0x58, 0x18, 0x71, 0x81, 0x57, 0xd6 } },
+	{ { 0x70, 0x99, 0xed, 0x88, 0xe8, 0x27, 0x44, 0x22, 0x8a, 0x53, 0x03, 0xae, 0x2e, 0xf6, 0xc0, 0xd0, 0x17, 0xc8, 0xb9, 0x7b, 0xa2, 0xb0, 0xdb, 0x9a, 0x5c, 0xd9, 0xf3, 0x3e, 0x63, 0xee, 0x7c, 0xed },
+	  { 0x23, 0x26, 0xb9, 0x58, 0xb0, 0x0b, 0x30, 0x50, 0x69, 0x7e, 0xed, 0xb0, 0x8c, 0xc2, 0x05, 0x04 } },
+	{ { 0x5e, 0x9e, 0x65, 0xea, 0x96, 0xe7, 0x8d, 0xd4, 0xfb, 0x78, 0xea, 0x11, 0x84, 0xf6, 0xeb, 0xde, 0x34, 0xee, 0x00, 0x23, 0x12, 0xbb, 0xeb, 0xca, 0x35, 0xa7, 0x1e, 0x8e, 0xef, 0x2c, 0x79, 0xe9 },
+	  { 0xec, 0x43, 0x32, 0xd5, 0xe3, 0xce, 0xbd, 0x3e, 0x0f, 0x5f, 0xc5, 0x14, 0x52, 0xf4, 0x56, 0x0d } },
+	{ { 0x33, 0xac, 0xf1, 0xca, 0xfc, 0x82, 0x26, 0x46, 0xdc, 0x86, 0x9e, 0x90, 0x5b, 0xd2, 0x6f, 0x9a, 0xd8, 0xad, 0x32, 0xf6, 0xf1, 0x75, 0x56, 0xf4, 0x3a, 0xf8, 0xdb, 0x9a, 0xbd, 0xd8, 0x2f, 0xe4 },
+	  { 0x5d, 0xa5, 0x8b, 0x5e, 0xf2, 0x07, 0x63, 0x40, 0xd5, 0x55, 0xf8, 0x61, 0xc3, 0x44, 0x9a, 0x77 } },
+	{ { 0xeb, 0x0a, 0xe8, 0x5c, 0x1b, 0x44, 0xd5, 0xdb, 0x47, 0x29, 0xd2, 0x68, 0xf4, 0x9b, 0xe2, 0xa0, 0x85, 0x08, 0xb9, 0xa8, 0x03, 0x72, 0x35, 0xb4, 0xef, 0xad, 0x23, 0xfb, 0x7e, 0x9c, 0xb5, 0x93 },
+	  { 0x30, 0x7d, 0x50, 0xc1, 0x8a, 0x0b, 0x6a, 0x08, 0x40, 0x2f, 0xf1, 0x31, 0xd7, 0x2c, 0xb7, 0xec } },
+	{ { 0xfa, 0xc9, 0x3b, 0x56, 0x1a, 0x9b, 0x6a, 0x0e, 0x80, 0x9d, 0x71, 0xec, 0xdb, 0x98, 0x0a, 0xfa, 0xb5, 0x75, 0xe9, 0x69, 0x89, 0x79, 0x5f, 0xbc, 0xaf, 0x82, 0xd2, 0xca, 0xa9, 0xb0, 0x02, 0x7f },
+	  { 0x92, 0xc3, 0x41, 0x65, 0xa2, 0x96, 0x3e, 0x77, 0xe0, 0x5e, 0x2d, 0x6f, 0xc2, 0xd9, 0x31, 0xd5 } },
+	{ { 0xa0, 0x55, 0x9e, 0x41, 0xd5, 0x8a, 0xf3, 0x61, 0x74, 0xa6, 0x72, 0x46, 0xdf, 0x87, 0x54, 0x1b, 0x27, 0xb6, 0xa8, 0x0c, 0x2b, 0xef, 0x61, 0xcb, 0x4f, 0xdc, 0xff, 0xa5, 0x6b, 0x69, 0x33, 0xaa },
+	  { 0xcb, 0x33, 0xd5, 0x19, 0xa1, 0xfd, 0xb1, 0xd5, 0xfb, 0xb1, 0x85, 0xc4, 0x78, 0x70, 0xc1, 0xed } },
+	{ { 0xe4, 0x88, 0x24, 0xd6, 0xc2, 0x25, 0x1d, 0x3a, 0x27, 0xf3, 0x8f, 0xb5, 0x43, 0xc3, 0x1f, 0xc1, 0xec, 0x85, 0x7d, 0x15, 0x8a, 0x12, 0xd0, 0x1e, 0xb4, 0x6d, 0x7a, 0x61, 0x13, 0x19, 0xf2, 0x47 },
+	  { 0x78, 0xfb, 0x45, 0x2f, 0x38, 0x4c, 0x8f, 0x87, 0x0e, 0x57, 0x28, 0x90, 0x58, 0x8f, 0x37, 0x28 } },
+	{ { 0x7a, 0x33, 0x44, 0x0a, 0xd7, 0xc6, 0x9d, 0x58, 0x33, 0x55, 0xc7, 0x45, 0xe5, 0xc8, 0x8c, 0x47, 0x94, 0x7e, 0x38, 0x3a, 0xb2, 0x5e, 0x5f, 0x99, 0xba, 0x3a, 0x52, 0xf1, 0x4b, 0x96, 0xc5, 0x6f },
+	  { 0x12, 0x37, 0x5e, 0x02, 0xa8, 0xbb, 0xc8, 0x4b, 0x00, 0xfe, 0xaa, 0xb5, 0x4a, 0x66, 0xdb, 0x43 } },
+	{ { 0x0e, 0x68, 0x77, 0xc7, 0xfd, 0xc2, 0x34, 0xef, 0xb9, 0xaf, 0xcd, 0x96, 0xb4, 0xeb, 0xdb, 0x83, 0x86, 0x49, 0x66, 0x38, 0x1a, 0xe5, 0x97, 0xd2, 0xba, 0xc4, 0xf8, 0x44, 0x01, 0xf0, 0x1e, 0x2c },
+	  { 0xea, 0xb1, 0x60, 0x66, 0x10, 0xb5, 0x5c, 0x85, 0x7f, 0x2b, 0x4b, 0xf1, 0xcf, 0x3f, 0xeb, 0xa0 } },
+	{ { 0xec, 0x91, 0xd3, 0x55, 0x0c, 0x79, 0xab, 0x49, 0x14, 0xa2, 0x69, 0x87, 0x72, 0x5a, 0xb1, 0x39, 0x6c, 0xf8, 0x06, 0x5e, 0x0a, 0x50, 0xcb, 0x57, 0xc5, 0xef, 0xb3, 0xb5, 0xce, 0xcf, 0xf5, 0x8c },
+	  { 0x6c, 0x73, 0x38, 0x11, 0x47, 0xde, 0x97, 0x96, 0x1c, 0xc2, 0x6a, 0xd2, 0x66, 0x02, 0xa4, 0x5a } },
+	{ { 0x83, 0xca, 0xed, 0x5a, 0x49, 0x57, 0x9b, 0x3a, 0x55, 0xa7, 0x1e, 0x5e, 0xce, 0x59, 0x66, 0xe5, 0x00, 0x8b, 0x3e, 0x4f, 0x4d, 0x8e, 0x5c, 0xc1, 0xd9, 0x2d, 0xd9, 0x67, 0xa8, 0xcd, 0x51, 0xd6 },
+	  { 0xe7, 0x6c, 0x08, 0xfd, 0x29, 0xbf, 0x01, 0x53, 0x52, 0x00, 0x3c, 0x63, 0x6f, 0xee, 0x5f, 0xf9 } },
+	{ { 0x91, 0xb9, 0xb5, 0x09, 0x08, 0x96, 0x83, 0x61, 0xdc, 0xd8, 0xf4, 0xba, 0x23, 0x6f, 0xa1, 0x99, 0xe7, 0xe7, 0x36, 0xb2, 0x64, 0x31, 0x5d, 0x92, 0x8b, 0x2d, 0xe5, 0x04, 0xc7, 0x23, 0x0e, 0x2f },
+	  { 0x6f, 0x26, 0xb8, 0x19, 0x1a, 0x2b, 0x05, 0x9d, 0xcd, 0xeb, 0x3d, 0xba, 0xbc, 0x43, 0x7c, 0x29 } },
+	{ { 0x94, 0xfc, 0x46, 0x21, 0x3c, 0x87, 0x0f, 0x79, 0x65, 0xb8, 0x87, 0x73, 0xaf, 0xe9, 0x3b, 0x13, 0x88, 0xc1, 0x8e, 0xab, 0x7e, 0x1a, 0x58, 0x0f, 0x46, 0xc6, 0xd8, 0xbe, 0x7b, 0x60, 0x72, 0x06 },
+	  { 0xe9, 0x1e, 0x2f, 0xce, 0xf1, 0x4d, 0xd4, 0x25, 0x1c, 0xae, 0xc9, 0x7c, 0x45, 0x22, 0x3f, 0xef } },
+	{ { 0xb0, 0xde, 0xff, 0x00, 0x9a, 0xff, 0x61, 0xf6, 0x57, 0x63, 0xb0, 0xb9, 0xfd, 0xd3, 0x9a, 0x90, 0x61, 0xdf, 0xa1, 0x65, 0x8f, 0x57, 0x8c, 0x2a, 0x5a, 0x68, 0x11, 0xc2, 0x3e, 0x42, 0x4d, 0xe9 },
+	  { 0x98, 0xfb, 0x21, 0x22, 0x91, 0x23, 0x60, 0xf0, 0x79, 0x16, 0xe4, 0x80, 0x2c, 0x0e, 0xa1, 0xe5 } },
+	{ { 0x96, 0x8f, 0x3c, 0x88, 0xd2, 0x7f, 0x1b, 0xe8, 0xde, 0xcb, 0x00, 0xc4, 0xd4, 0x64, 0xd3, 0x69, 0xf9, 0x24, 0x80, 0x47, 0x1e, 0x74, 0xec, 0xda, 0x23, 0x7e, 0xf5, 0x42, 0x12, 0x4c, 0xec, 0x0c },
+	  { 0xb4, 0xa1, 0x5c, 0x59, 0x97, 0x6b, 0x39, 0xda, 0x50, 0xda, 0x8e, 0xd3, 0x93, 0xf2, 0x7a, 0x62 } },
+	{ { 0x35, 0xfe, 0x06, 0xa6, 0x03, 0x09, 0x58, 0x15, 0x65, 0xa9, 0x72, 0x32, 0x14, 0x06, 0x68, 0x46, 0x4d, 0x85, 0xdc, 0x1e, 0x89, 0x1f, 0xd5, 0x00, 0x73, 0xa4, 0x7b, 0x91, 0x81, 0xbe, 0x96, 0x6e },
+	  { 0xd8, 0xb5, 0x7d, 0x7a, 0x72, 0xef, 0x92, 0x40, 0x9c, 0x51, 0xd4, 0x0b, 0xb8, 0xc4, 0xcb, 0xc5 } },
+	{ { 0x47, 0x39, 0x04, 0x3d, 0x77, 0x50, 0xbc, 0xf4, 0xa6, 0xf2, 0x69, 0xa3, 0xd5, 0x40, 0x83, 0xca, 0x95, 0x30, 0xa1, 0x64, 0xfb, 0xf0, 0x47, 0x40, 0xef, 0xf5, 0xaf, 0x9a, 0x39, 0x7a, 0x5d, 0xab },
+	  { 0x54, 0x8c, 0xc8, 0x93, 0xe8, 0x0c, 0xaf, 0x5a, 0x60, 0x1c, 0x23, 0x81, 0x51, 0x7f, 0x8c, 0x5b } },
+	{ { 0x4b, 0x06, 0x5b, 0x51, 0x95, 0xf2, 0xdd, 0xf6, 0xf5, 0xd0, 0xae, 0xd7, 0x2f, 0xf7, 0xa1, 0xe3, 0xc1, 0xbc, 0x69, 0xf7, 0x13, 0xfc, 0xe8, 0x1a, 0x8f, 0xe9, 0x8c, 0x1b, 0x68, 0x05, 0xd1, 0xf0 },
+	  { 0x1c, 0x22, 0x38, 0xc5, 0x60, 0xd6, 0x78, 0xd4, 0x0b, 0x48, 0xcc, 0x80, 0x34, 0xad, 0xd0, 0xc4 } },
+	{ { 0x1a, 0x94, 0x91, 0x29, 0xe1, 0x4c, 0x59, 0x63, 0xd9, 0x97, 0xc8, 0x6a, 0x63, 0x52, 0xea, 0x53, 0xdd, 0x9e, 0x51, 0x32, 0x73, 0x2a, 0x90, 0xce, 0x84, 0xa1, 0x40, 0x9b, 0x5c, 0xa8, 0x01, 0x34 },
+	  { 0x27, 0x71, 0xff, 0x80, 0x6e, 0x06, 0x1d, 0xf8, 0xad, 0x4a, 0xa8, 0x77, 0x71, 0x7b, 0xf3, 0x09 } },
+	{ { 0x91, 0xcd, 0x3e, 0x48, 0xf4, 0xb4, 0x2c, 0x43, 0x2b, 0xed, 0x98, 0x48, 0x58, 0x3e, 0x6d, 0xc7, 0xfa, 0xef, 0xae, 0xb2, 0x1d, 0x2c, 0x8d, 0x36, 0x29, 0xeb, 0xe8, 0xec, 0x2d, 0xd3, 0xf2, 0x3d },
+	  { 0x06, 0x55, 0x93, 0xfa, 0x1f, 0xcd, 0xb4, 0x81, 0xbb, 0x27, 0xf3, 0x34, 0x50, 0x55, 0x43, 0xf5 } },
+	{ { 0x42, 0xd6, 0xf7, 0xb5, 0x85, 0xa0, 0xa0, 0xd3, 0x56, 0xc5, 0x9b, 0xe3, 0xd0, 0x7d, 0x4d, 0x41, 0xfc, 0xba, 0x3d, 0x48, 0x02, 0xe1, 0x39, 0xb7, 0x92, 0xcc, 0x1b, 0xd8, 0x7d, 0x86, 0xb1, 0xc8 },
+	  { 0xd3, 0xf3, 0x09, 0xc0, 0x03, 0x9b, 0x15, 0xd1, 0x4e, 0xb8, 0xb7, 0x39, 0xa9, 0x4b, 0x94, 0xfa } },
+	{ { 0x72, 0x90, 0x0f, 0x0e, 0xcb, 0xf9, 0x0f, 0xa0, 0x58, 0x80, 0x5d, 0xeb, 0x43, 0x08, 0x15, 0x07, 0x2f, 0x49, 0x34, 0x88, 0x01, 0x7a, 0x2c, 0x66, 0xdc, 0x74, 0xac, 0xe1, 0xd4, 0xcd, 0x25, 0x32 },
+	  { 0x4e, 0x44, 0x1a, 0x3f, 0xb2, 0x77, 0xd6, 0xfb, 0xe0, 0xed, 0x7c, 0x6e, 0x08, 0x0d, 0x9a, 0x9f } },
+	{ { 0x12, 0xef, 0x87, 0x89, 0xb9, 0x1a, 0x8e, 0x35, 0xfd, 0x0a, 0xc7, 0x94, 0x57, 0xa9, 0x06, 0xf0, 0x61, 0x0d, 0x2e, 0xb7, 0xb3, 0x0d, 0xfa, 0x9d, 0x3c, 0x99, 0xd0, 0x8f, 0xdc, 0xc0, 0xbf, 0xad },
+	  { 0xcb, 0x92, 0x41, 0xbc, 0x96, 0x4c, 0xbc, 0x98, 0x23, 0x53, 0x1f, 0x68, 0xe3, 0xa0, 0x3b, 0x7c } },
+	{ { 0x2c, 0xbe, 0x59, 0x80, 0xad, 0x54, 0xc5, 0xdb, 0xf2, 0xee, 0x3d, 0xb1, 0xe9, 0x87, 0x57, 0x33, 0xaa, 0x9f, 0x6f, 0x0b, 0x25, 0x41, 0x46, 0x05, 0x1f, 0xca, 0xcf, 0xe7, 0x3f, 0x60, 0x84, 0xd1 },
+	  { 0x70, 0xb1, 0x7c, 0x3e, 0x86, 0x9a, 0xca, 0x60, 0x76, 0x61, 0x7a, 0x2c, 0xf7, 0x5e, 0x9f, 0x4a } },
+	{ { 0xdc, 0x4d, 0xa3, 0x81, 0x27, 0x36, 0xa2, 0xa6, 0x03, 0xbc, 0xc6, 0x39, 0x07, 0x63, 0xc5, 0xc5, 0xda, 0x2e, 0x13, 0x35, 0xa3, 0xdb, 0x8c, 0x65, 0x69, 0xab, 0xb5, 0xcb, 0xc8, 0x3e, 0x1b, 0x9b },
+	  { 0xf4, 0xb8, 0xa6, 0xed, 0x6d, 0x6d, 0x72, 0xaf, 0xf5, 0x94, 0x84, 0x31, 0x4f, 0x21, 0x0b, 0xb9 } },
+	{ { 0x2e, 0x4e, 0x21, 0xa6, 0xeb, 0x77, 0xbb, 0x39, 0xa1, 0xcb, 0x5c, 0xd2, 0x0c, 0xc5, 0xfd, 0x3b, 0x2e, 0x96, 0xb5, 0xd8, 0xce, 0xb6, 0xfe, 0xca, 0x9c, 0x3f, 0x31, 0xfa, 0x87, 0x1f, 0x10, 0x22 },
+	  { 0xf5, 0x6a, 0x45, 0x97, 0xbe, 0xae, 0xaf, 0xc0, 0xc1, 0x4e, 0xe7, 0x39, 0x88, 0xbc, 0xbe, 0xe8 } },
+	{ { 0x54, 0xd5, 0xc0, 0x37, 0xe6, 0x1f, 0xd0, 0x9e, 0x5c, 0xf5, 0x7f, 0xd3, 0x4c, 0x5e, 0x01, 0x92, 0xdb, 0xfc, 0xf0, 0x4f, 0x70, 0x18, 0x51, 0x0a, 0x5d, 0x71, 0xd6, 0xc3, 0x0f, 0xa3, 0xae, 0xca },
+	  { 0x04, 0x33, 0x30, 0x79, 0xd5, 0x35, 0x22, 0x36, 0xe1, 0xc7, 0x92, 0x13, 0xf3, 0xf3, 0x8d, 0xbe } },
+	{ { 0x3a, 0x5d, 0xa2, 0x03, 0xe0, 0x3f, 0xa3, 0x99, 0xca, 0xeb, 0x1f, 0xac, 0x63, 0x67, 0x9b, 0x56, 0xdf, 0xcf, 0xc0, 0x36, 0xa5, 0x2d, 0x73, 0x3c, 0xbc, 0xb6, 0x44, 0xd0, 0xfc, 0x50, 0x23, 0x74 },
+	  { 0x22, 0xc9, 0x7e, 0xcd, 0xf4, 0xaf, 0x83, 0x0f, 0x94, 0xb1, 0x19, 0x51, 0xf4, 0x1e, 0x4d, 0x29 } },
+	{ { 0x5c, 0x84, 0x14, 0x7d, 0x6a, 0xb2, 0x05, 0x1b, 0x56, 0xb0, 0x99, 0x3a, 0x7c, 0xbf, 0xa3, 0x06, 0xfd, 0x06, 0xbe, 0xfb, 0x51, 0x82, 0xf0, 0x33, 0x28, 0x07, 0x5d, 0x81, 0x08, 0x4e, 0x6e, 0x5d },
+	  { 0xde, 0xf4, 0x6a, 0x3b, 0x39, 0xc8, 0x04, 0x84, 0x31, 0xd2, 0x49, 0x1d, 0x97, 0xda, 0xa6, 0xea } },
+	{ { 0x7a, 0xf7, 0x7a, 0xa1, 0x55, 0xa3, 0x3f, 0x65, 0x82, 0x83, 0xeb, 0xc3, 0xe9, 0xeb, 0x70, 0x89, 0x23, 0xf2, 0xd4, 0xc0, 0x68, 0x4a, 0xf4, 0xb7, 0x19, 0xd5, 0x14, 0x9c, 0x9f, 0x94, 0xc8, 0xb7 },
+	  { 0x4c, 0x63, 0x67, 0xad, 0x8a, 0x21, 0x90, 0x36, 0x6c, 0x3d, 0x73, 0x0f, 0xe5, 0xee, 0xb6, 0xee } },
+	{ { 0xed, 0xab, 0xba, 0x9d, 0xc9, 0xd8, 0x73, 0x57, 0xbb, 0x91, 0xda, 0x69, 0x31, 0xc7, 0x43, 0xe1, 0x6f, 0x91, 0xb3, 0x6d, 0xe2, 0x6b, 0x64, 0x81, 0x75, 0xe8, 0x67, 0x93, 0x7a, 0x7a, 0x7e, 0x59 },
+	  { 0x90, 0xbd, 0x09, 0xb4, 0xeb, 0x0f, 0x7d, 0x83, 0x97, 0xc0, 0x02, 0x6c, 0xef, 0xea, 0x8f, 0xb3 } },
+	{ { 0xab, 0x7e, 0xf1, 0xb4, 0xa1, 0xe4, 0x37, 0x71, 0xde, 0x88, 0xe1, 0x58, 0xad, 0x26, 0xa4, 0x19, 0xff, 0x2c, 0xba, 0xd9, 0x09, 0x64, 0x19, 0x02, 0xe2, 0x28, 0x65, 0xff, 0x95, 0x90, 0xf1, 0xea },
+	  { 0x25, 0xae, 0xfc, 0xfa, 0x6e, 0xc9, 0x8f, 0xae, 0x81, 0xb9, 0x3a, 0xfa, 0xd7, 0x76, 0x17, 0x11 } },
+	{ { 0x6b, 0x01, 0x45, 0xc6, 0xcb, 0xea, 0xae, 0x32, 0x0b, 0xe8, 0x6c, 0x29, 0x09, 0xc8, 0xd6, 0x43, 0xda, 0x82, 0x46, 0x23, 0x67, 0xad, 0x96, 0xac, 0x63, 0x91, 0x5f, 0x05, 0x42, 0xe6, 0xe6, 0xfb },
+	  { 0x60, 0x7b, 0x26, 0xf4, 0xeb, 0x35, 0x85, 0xe3, 0xe8, 0x86, 0xe7, 0x5c, 0x0f, 0x3a, 0x01, 0xcf } },
+	{ { 0xb4, 0x6d, 0x28, 0xc2, 0x0a, 0x61, 0x4b, 0x6d, 0x98, 0x6e, 0x92, 0x79, 0x52, 0x58, 0x63, 0x1c, 0xba, 0xf9, 0x60, 0xd7, 0x8c, 0x98, 0x13, 0x4f, 0x8b, 0x17, 0xb8, 0x59, 0x4d, 0xdc, 0xe7, 0x34 },
+	  { 0xfe, 0x35, 0xfe, 0x16, 0xa3, 0x29, 0x00, 0x42, 0xc2, 0x8c, 0x02, 0x1e, 0xe9, 0xed, 0xe7, 0x3f } },
+	{ { 0x93, 0xc5, 0xc8, 0x40, 0x34, 0x10, 0x76, 0x47, 0x17, 0xe5, 0x47, 0xe3, 0xd0, 0x7b, 0x0e, 0xc3, 0x44, 0xcc, 0x9e, 0xc1, 0x2f, 0xb1, 0x13, 0x0d, 0x49, 0x9b, 0xba, 0x47, 0xa4, 0x31, 0x00, 0x0b },
+	  { 0x01, 0x41, 0x87, 0x1c, 0x35, 0x7a, 0x00, 0xad, 0x37, 0xae, 0x65, 0x59, 0x78, 0x30, 0xca, 0xc8 } },
+	{ { 0xcf, 0x85, 0xea, 0x60, 0xe0, 0xc9, 0x4e, 0x61, 0x1f, 0xed, 0xba, 0x48, 0xe1, 0x9e, 0x96, 0x93, 0x45, 0x8d, 0x19, 0xdd, 0x1a, 0xcb, 0x13, 0xa0, 0x7e, 0x35, 0xdf, 0x1e, 0xdc, 0x01, 0xca, 0xc3 },
+	  { 0xdf, 0x8b, 0xc7, 0x78, 0x2a, 0xe1, 0x0e, 0xb2, 0xc1, 0xbd, 0xfd, 0xc8, 0x88, 0x7e, 0x49, 0x07 } },
+	{ { 0xd4, 0x07, 0x35, 0x93, 0x2e, 0xa2, 0x69, 0xae, 0xb5, 0x1f, 0xa3, 0xca, 0xf0, 0xc1, 0x76, 0xd8, 0x9a, 0x06, 0xde, 0xa5, 0x30, 0x2a, 0x1d, 0x12, 0xbf, 0x88, 0x22, 0xd6, 0x54, 0x7f, 0x83, 0xc4 },
+	  { 0x1a, 0xc6, 0x5c, 0x65, 0xb6, 0xcd, 0x8a, 0xb7, 0x51, 0xf1, 0xd9, 0x08, 0xeb, 0xd9, 0x62, 0xab } },
+	{ { 0x9a, 0x71, 0x20, 0x34, 0x18, 0x19, 0xfe, 0x54, 0xfc, 0x8a, 0x75, 0x0d, 0x17, 0xec, 0xf2, 0x0f, 0x80, 0xc0, 0x82, 0xc0, 0x86, 0xe7, 0x97, 0xa5, 0xee, 0x79, 0xfb, 0xde, 0xbf, 0xa6, 0xe1, 0x6f },
+	  { 0x9f, 0x10, 0xb5, 0x3f, 0xb6, 0xad, 0xf7, 0x18, 0x9e, 0x27, 0x7d, 0x04, 0xe3, 0x51, 0xaa, 0x9d } },
+	{ { 0x8c, 0x19, 0x64, 0x2c, 0x17, 0x2c, 0xdb, 0x80, 0x40, 0x59, 0xf7, 0x51, 0xb3, 0xf2, 0x5c, 0xff, 0x1f, 0xd0, 0x37, 0xff, 0x30, 0x4a, 0x60, 0xbd, 0x70, 0x5e, 0x86, 0xda, 0x5c, 0xf7, 0x4b, 0xf2 },
+	  { 0xc9, 0x4e, 0xcc, 0x94, 0x3d, 0xdc, 0x8d, 0x1e, 0xea, 0xfa, 0xdd, 0x17, 0x3c, 0xf7, 0x3f, 0xdc } },
+	{ { 0xe1, 0xcc, 0x95, 0x75, 0xe5, 0x1d, 0x6a, 0x82, 0x40, 0xe6, 0xf3, 0xcd, 0x89, 0x58, 0xe1, 0xa6, 0xd6, 0x9e, 0xfb, 0x6b, 0x0d, 0x96, 0xed, 0xa3, 0x9a, 0xa4, 0x5b, 0xcd, 0x60, 0x00, 0x74, 0x2e },
+	  { 0x5d, 0xd5, 0x13, 0xd7, 0x4b, 0x72, 0xf9, 0xd4, 0x6b, 0x06, 0xb4, 0xb9, 0x6a, 0x94, 0xc3, 0xbd } },
+	{ { 0xce, 0x41, 0xff, 0x2d, 0x70, 0xb2, 0x16, 0x9f, 0xad, 0x6a, 0x5f, 0x9e, 0xad, 0x44, 0x71, 0xe8, 0x8b, 0x4b, 0xe8, 0xbc, 0x46, 0xe4, 0x14, 0x77, 0xf1, 0xa2, 0xef, 0x74, 0x0a, 0x94, 0xb7, 0x93 },
+	  { 0x15, 0x94, 0xa3, 0x1c, 0xc2, 0x2c, 0xdb, 0xaf, 0x20, 0x11, 0xa9, 0xa3, 0x17, 0x53, 0x86, 0x08 } },
+	{ { 0x7b, 0x46, 0x7b, 0x87, 0x18, 0x07, 0x72, 0x67, 0x79, 0x03, 0xa0, 0x43, 0xbc, 0x63, 0xc3, 0xef, 0x9e, 0xdf, 0x4b, 0xa0, 0x84, 0xc8, 0xcf, 0xd8, 0xd1, 0xb3, 0x46, 0xd7, 0x1d, 0xc7, 0x31, 0x9b },
+	  { 0x4d, 0x5e, 0x8d, 0x6f, 0xa3, 0xe2, 0xea, 0x34, 0x3b, 0x5a, 0xfb, 0x77, 0x12, 0x45, 0x29, 0xaa } },
+	{ { 0xca, 0x06, 0x8b, 0x3a, 0xfc, 0x71, 0x7d, 0x1f, 0x6e, 0x8d, 0xc7, 0xe4, 0xec, 0xa0, 0xf5, 0x6f, 0xd3, 0x81, 0xc6, 0xcf, 0x27, 0x2a, 0x25, 0xec, 0xea, 0xe9, 0xbd, 0xa0, 0x0f, 0x82, 0x18, 0x31 },
+	  { 0x1b, 0xbf, 0x65, 0x1c, 0xf6, 0x1c, 0x29, 0x5c, 0x96, 0xe7, 0x3a, 0x21, 0x04, 0x83, 0xd7, 0xa1 } },
+	{ { 0xd0, 0x4d, 0x80, 0x99, 0x8a, 0x97, 0x1e, 0xc5, 0x2d, 0x53, 0x90, 0xfa, 0x7e, 0xaf, 0x78, 0xea, 0xc8, 0x3e, 0xa3, 0xd3, 0xd1, 0x36, 0x0c, 0xb0, 0x7c, 0x0e, 0x87, 0x81, 0x0b, 0x01, 0xcf, 0x90 },
+	  { 0x84, 0xb4, 0x2f, 0x75, 0xc3, 0xb6, 0x2b, 0xbf, 0x21, 0x70, 0x7b, 0xa6, 0x6c, 0xca, 0x39, 0x9f } },
+	{ { 0x2c, 0xfb, 0x1c, 0x71, 0xe8, 0xca, 0xc8, 0x72, 0xe6, 0xa6, 0xdc, 0x90, 0xb0, 0x19, 0x5a, 0xcf, 0x4c, 0x8a, 0x8c, 0xa6, 0x12, 0x80, 0x27, 0x0f, 0x5d, 0x7e, 0xfc, 0x27, 0x67, 0xcb, 0xf6, 0x0f },
+	  { 0xa0, 0xc5, 0x14, 0xe1, 0xe6, 0xa9, 0xc6, 0x59, 0xf6, 0x05, 0xef, 0xf4, 0xcf, 0x49, 0x51, 0xa0 } },
+	{ { 0x40, 0x5b, 0xc4, 0x50, 0xa1, 0x9e, 0x6d, 0xae, 0x76, 0x84, 0x7b, 0x8e, 0xac, 0x85, 0x8c, 0x8b, 0xec, 0x4f, 0x98, 0x47, 0xf4, 0x29, 0xe1, 0x56, 0xab, 0x7b, 0x13, 0xd3, 0xa8, 0x82, 0xa7, 0xaf },
+	  { 0x1d, 0xcc, 0x38, 0x30, 0x7c, 0x6b, 0x3c, 0x31, 0xe2, 0x5f, 0x86, 0x8b, 0x27, 0x9b, 0x37, 0x11 } },
+	{ { 0x35, 0x75, 0x5f, 0xe9, 0x7d, 0x9a, 0xeb, 0x1e, 0x67, 0xc1, 0xf4, 0xca, 0x5a, 0x40, 0xce, 0x1f, 0xf1, 0x83, 0xa0, 0x77, 0x88, 0x42, 0xdd, 0x67, 0x49, 0x24, 0x95, 0x58, 0x8f, 0x19, 0x90, 0xbe },
+	  { 0xcd, 0xd7, 0x44, 0x57, 0x46, 0x64, 0xbe, 0x7b, 0x22, 0x1d, 0x7a, 0x29, 0x21, 0xb4, 0xf0, 0xb2 } },
+	{ { 0x7e, 0x9d, 0x8b, 0x4b, 0xbd, 0x2a, 0xad, 0x70, 0xd2, 0x29, 0x24, 0x7d, 0x58, 0x80, 0xa0, 0xcb, 0x3c, 0x54, 0xe4, 0x20, 0xce, 0x26, 0x63, 0x1c, 0x6b, 0x39, 0xef, 0x71, 0xae, 0xad, 0x60, 0x0c },
+	  { 0xe6, 0x02, 0xef, 0x85, 0x18, 0x4a, 0xd4, 0xa8, 0x6e, 0xd3, 0x39, 0xe9, 0x40, 0x3f, 0x54, 0x1c } },
+	{ { 0x73, 0xbe, 0x0b, 0xb5, 0xb7, 0x4a, 0x8f, 0x63, 0x24, 0xf8, 0xa5, 0xf0, 0xac, 0xbf, 0x5f, 0xaa, 0xda, 0x56, 0x0b, 0xa5, 0xd6, 0x6c, 0xb7, 0xb4, 0x05, 0xea, 0xd6, 0x98, 0xee, 0x92, 0x34, 0x10 },
+	  { 0x7c, 0x22, 0x7f, 0x03, 0xe6, 0x05, 0xff, 0x14, 0xc4, 0x2f, 0xb9, 0xf8, 0xe8, 0x78, 0x6e, 0x84 } },
+	{ { 0xc8, 0x2e, 0x22, 0xfa, 0xec, 0xa5, 0x1a, 0x38, 0x04, 0x5f, 0x2a, 0x3a, 0x04, 0xa0, 0xe6, 0xe2, 0xa6, 0x74, 0x74, 0xa6, 0x30, 0x69, 0x48, 0xa0, 0xc1, 0xc5, 0x6f, 0x60, 0x06, 0xea, 0x5a, 0x94 },
+	  { 0x94, 0xc0, 0x46, 0x6b, 0x27, 0xaa, 0x4d, 0x36, 0x1b, 0x19, 0xc2, 0x50, 0x32, 0x9c, 0x14, 0xa0 } },
+	{ { 0x7c, 0x1d, 0xd4, 0x2b, 0xdf, 0xf4, 0x14, 0xe3, 0x73, 0x3b, 0x84, 0x6c, 0xbb, 0x00, 0xc4, 0x34, 0x32, 0xb4, 0x32, 0xcd, 0x17, 0xc3, 0x05, 0x96, 0xda, 0xdc, 0xad, 0x30, 0x34, 0x76, 0x4e, 0x34 },
+	  { 0xfd, 0x6b, 0x28, 0x1c, 0x93, 0xc1, 0xfd, 0x8e, 0x9b, 0x83, 0xb6, 0x9e, 0xcf, 0x72, 0x2f, 0x3b } },
+	{ { 0xaa, 0x7e, 0xc0, 0x03, 0xef, 0xbc, 0xa8, 0x6f, 0xe5, 0xad, 0x02, 0x8d, 0x05, 0x71, 0xcf, 0x3a, 0xcf, 0xdf, 0x1a, 0xd1, 0x84, 0x02, 0xf8, 0x18, 0x41, 0x5f, 0x1b, 0xae, 0xfb, 0x04, 0x61, 0x0f },
+	  { 0xa7, 0x5b, 0x28, 0xbe, 0x92, 0xdc, 0x53, 0xde, 0x9d, 0x44, 0x71, 0x49, 0x18, 0xe3, 0xc5, 0x41 } },
+	{ { 0x14, 0xba, 0x26, 0xba, 0xfb, 0x6c, 0x84, 0x10, 0x10, 0x4d, 0x70, 0xec, 0x23, 0x87, 0x6d, 0xb5, 0x68, 0x84, 0x32, 0x6f, 0x16, 0xde, 0xab, 0xc6, 0xdc, 0x1b, 0x6a, 0xe7, 0xe3, 0xe7, 0xa4, 0x4e },
+	  { 0x48, 0x69, 0x30, 0x25, 0xba, 0x68, 0xf3, 0xfa, 0x35, 0x15, 0xe7, 0x11, 0x2b, 0x6e, 0x32, 0xaa } },
+	{ { 0x33, 0xb4, 0x07, 0x38, 0xb3, 0x9e, 0xbe, 0x39, 0x11, 0x89, 0x38, 0xc6, 0x46, 0x1e, 0xbd, 0x78, 0x20, 0xed, 0x02, 0x4a, 0xac, 0xb6, 0x58, 0x3c, 0xe9, 0x0e, 0x8d, 0xf6, 0xc8, 0x89, 0x96, 0xe4 },
+	  { 0x6b, 0xfa, 0x37, 0xcc, 0x5e, 0xd6, 0xe5, 0xd4, 0xdd, 0xf4, 0x0b, 0x13, 0x01, 0x95, 0x7f, 0x73 } },
+	{ { 0x0d, 0x16, 0xea, 0xb1, 0xb5, 0x6e, 0x2a, 0x46, 0x8b, 0xf1, 0xba, 0x10, 0x35, 0x12, 0x9d, 0x57, 0x4b, 0x17, 0x35, 0x86, 0xf2, 0x60, 0xbd, 0xe8, 0x34, 0xfa, 0x86, 0xe5, 0xc9, 0x1c, 0xe9, 0x97 },
+	  { 0xca, 0x18, 0xb8, 0x9c, 0x32, 0x25, 0x87, 0x7e, 0x02, 0xe2, 0x10, 0x42, 0xaf, 0x98, 0x36, 0xa8 } },
+	{ { 0x44, 0xb5, 0x55, 0x14, 0xa5, 0xb4, 0xa5, 0xa4, 0x29, 0x4f, 0x3c, 0xf8, 0xe7, 0x5f, 0xf7, 0x3c, 0x81, 0x0f, 0x8d, 0x1a, 0xc0, 0x45, 0x3a, 0x96, 0x36, 0x18, 0x96, 0xa7, 0x66, 0x84, 0xdf, 0x3f },
+	  { 0xc3, 0xeb, 0xc0, 0x83, 0x68, 0xbe, 0x58, 0xf8, 0xf5, 0x14, 0xcf, 0xbd, 0x5f, 0x98, 0xed, 0x52 } },
+	{ { 0x26, 0x5f, 0x1a, 0x7a, 0x53, 0x15, 0x1b, 0xc5, 0x15, 0x26, 0xfe, 0x47, 0x6e, 0x8c, 0x63, 0xad, 0x42, 0xe4, 0x4d, 0x99, 0xa8, 0xfb, 0x62, 0x6e, 0xc3, 0x0c, 0x59, 0x1a, 0x39, 0x1c, 0x32, 0x6d },
+	  { 0x78, 0x85, 0x52, 0x39, 0x7d, 0xdf, 0x2d, 0x58, 0x41, 0xdb, 0xc0, 0xe7, 0x3d, 0xd1, 0x11, 0x50 } },
+	{ { 0x23, 0xfa, 0x46, 0x30, 0x93, 0x70, 0x15, 0x58, 0x5a, 0xc0, 0x65, 0xe6, 0xa7, 0xbd, 0x93, 0x02, 0x3a, 0x61, 0x1f, 0xa0, 0xd5, 0x24, 0x4f, 0x36, 0x82, 0xd7, 0x99, 0xfd, 0x04, 0xcd, 0x23, 0x3d },
+	  { 0xe9, 0xd7, 0x28, 0xbc, 0x19, 0xb5, 0x08, 0x09, 0xbc, 0x12, 0x45, 0x55, 0x20, 0x91, 0xd0, 0xb2 } },
+	{ { 0x9d, 0xd3, 0xa2, 0x40, 0x8e, 0x56, 0x94, 0xfc, 0xed, 0x28, 0x96, 0x4c, 0x7f, 0x44, 0x2e, 0x6e, 0xd3, 0xb6, 0x37, 0x1c, 0xcc, 0x91, 0x47, 0x3f, 0x3e, 0xc5, 0xdc, 0xa8, 0x24, 0x5c, 0xf3, 0x8f },
+	  { 0xce, 0x08, 0xd7, 0x8b, 0x58, 0x17, 0x9b, 0x79, 0x57, 0xee, 0xab, 0x6f, 0x74, 0xdd, 0xb1, 0x0f } },
+	{ { 0x05, 0x5d, 0x53, 0xef, 0x57, 0x4a, 0x63, 0xf7, 0x7c, 0x0b, 0x3a, 0x88, 0xe7, 0xe7, 0xcd, 0xb0, 0x1d, 0xbe, 0xe0, 0x97, 0x94, 0x86, 0xdc, 0x46, 0x69, 0x2b, 0x77, 0xc7, 0x50, 0x81, 0x42, 0x80 },
+	  { 0x33, 0xce, 0x33, 0xe8, 0x0f, 0xcc, 0x26, 0x2e, 0x9e, 0x86, 0x2f, 0x5a, 0xc5, 0x0c, 0x14, 0xdf } },
+	{ { 0xc1, 0xa9, 0x0c, 0xde, 0xf5, 0xd5, 0xda, 0xaf, 0x7b, 0x18, 0x2d, 0x6b, 0x40, 0x99, 0x40, 0xe6, 0x2e, 0x70, 0xd3, 0x7f, 0x9b, 0x4a, 0xfa, 0x68, 0xf7, 0xad, 0x58, 0x9d, 0x95, 0x8d, 0x56, 0x5f },
+	  { 0x5c, 0x4d, 0x21, 0xe6, 0x04, 0x5f, 0x11, 0xf9, 0xf9, 0x1a, 0x8c, 0xef, 0x13, 0x03, 0x04, 0xe0 } },
+	{ { 0x6a, 0x25, 0x7a, 0x4f, 0x65, 0xbd, 0xd7, 0xd8, 0x82, 0xff, 0x45, 0xff, 0xbb, 0x95, 0x41, 0xe5, 0x72, 0x3d, 0xf2, 0x99, 0x9f, 0x15, 0xeb, 0x91, 0x0e, 0xb7, 0xd4, 0x72, 0x86, 0x8e, 0x52, 0xbf },
+	  { 0x4f, 0x50, 0x67, 0x9c, 0x2d, 0xbf, 0xa6, 0x3b, 0x5e, 0x55, 0xd0, 0x31, 0xaf, 0xac, 0xd4, 0x4b } },
+	{ { 0x58, 0x43, 0xbf, 0x4d, 0x6a, 0xfc, 0x64, 0x27, 0x3d, 0x32, 0x8e, 0x1b, 0xaf, 0x78, 0x21, 0xb0, 0x3d, 0x6d, 0x95, 0x05, 0xb2, 0xaa, 0x4d, 0xaa, 0x50, 0xe2, 0x04, 0x43, 0x29, 0x22, 0x86, 0xf4 },
+	  { 0x29, 0xf6, 0x4e, 0x79, 0xde, 0x48, 0xf3, 0xd3, 0xd5, 0xdf, 0xf9, 0x2a, 0xa0, 0xb1, 0x78, 0x3b } },
+	{ { 0x89, 0x15, 0x06, 0x0a, 0x33, 0x75, 0x8a, 0x30, 0x0c, 0x05, 0x3d, 0x36, 0x5c, 0x30, 0x4d, 0x4e, 0x14, 0x9b, 0xdb, 0x7c, 0x6c, 0xe2, 0xbe, 0x79, 0x85, 0x3d, 0xfd, 0x69, 0x89, 0x93, 0xfe, 0xcf },
+	  { 0x8c, 0x5b, 0xf9, 0x25, 0x15, 0xa9, 0x24, 0x49, 0x84, 0x65, 0x93, 0xa3, 0xbd, 0xbe, 0x52, 0x1b } },
+	{ { 0xbe, 0x2b, 0x2a, 0x41, 0xb3, 0x49, 0x15, 0x11, 0xc1, 0x81, 0x50, 0x8b, 0x66, 0xec, 0x96, 0xf7, 0x98, 0xc0, 0x22, 0x59, 0x79, 0x4b, 0x9a, 0x30, 0x01, 0x58, 0x6e, 0xca, 0x34, 0x2d, 0xac, 0xd4 },
+	  { 0x55, 0x11, 0xfe, 0xf7, 0xa2, 0x23, 0x82, 0x77, 0xaa, 0xa9, 0xe2, 0x5f, 0x1d, 0x09, 0x7c, 0x19 } },
+	{ { 0x4d, 0x6f, 0x38, 0x93, 0x53, 0x17, 0xff, 0xa0, 0xcb, 0x29, 0xbd, 0xfa, 0x8a, 0x43, 0xcd, 0x19, 0xcd, 0xd1, 0xdc, 0xae, 0xdb, 0x68, 0x18, 0x47, 0xab, 0xf1, 0x8c, 0x95, 0x29, 0x24, 0xd0, 0xcd },
+	  { 0x2e, 0xcd, 0x75, 0xc6, 0xa5, 0xea, 0xce, 0x1c, 0x54, 0x1e, 0x12, 0xdb, 0x15, 0x0a, 0x21, 0x43 } },
+	{ { 0x15, 0x49, 0xea, 0x3d, 0x16, 0x71, 0x52, 0xc8, 0x52, 0x23, 0xb0, 0xa6, 0x03, 0xd1, 0xfa, 0x61, 0xe3, 0x1c, 0xa9, 0x68, 0x7e, 0x82, 0xd6, 0x5b, 0xff, 0xef, 0x9e, 0x4e, 0x3c, 0x2e, 0xf1, 0x8e },
+	  { 0x6a, 0x4c, 0xfc, 0xb9, 0xe8, 0xda, 0xe9, 0x61, 0x0d, 0xf9, 0x95, 0x09, 0xda, 0xac, 0x7b, 0xe0 } },
+	{ { 0xba, 0x59, 0x3f, 0x67, 0x31, 0xf7, 0x0e, 0xda, 0xb8, 0x3f, 0x5c, 0xdf, 0x02, 0x52, 0x74, 0x36, 0x89, 0x50, 0x55, 0xd1, 0x96, 0x58, 0x3f, 0x3a, 0xf2, 0x16, 0x0b, 0x47, 0xe6, 0x82, 0x8a, 0x6e },
+	  { 0x18, 0x57, 0x72, 0xde, 0xff, 0x51, 0x80, 0x71, 0x47, 0xac, 0x53, 0x50, 0x24, 0x9b, 0x3e, 0x1a } },
+	{ { 0x71, 0x26, 0xa0, 0x57, 0x12, 0xf9, 0x87, 0xf1, 0xc9, 0x24, 0x9b, 0xf9, 0xa7, 0xc1, 0x7b, 0x4f, 0x91, 0x07, 0x27, 0x0f, 0x69, 0x09, 0xbf, 0x4b, 0xb5, 0xba, 0x58, 0x17, 0xc2, 0x19, 0xb4, 0x74 },
+	  { 0xbf, 0xb1, 0xce, 0x7d, 0xf7, 0x06, 0xbc, 0x97, 0x2e, 0x1b, 0x83, 0x06, 0xd4, 0x4a, 0xa1, 0x35 } },
+	{ { 0x3d, 0x0f, 0xa3, 0x98, 0x3e, 0xbc, 0x8a, 0x3f, 0x64, 0xc4, 0x13, 0x5d, 0x7c, 0xd3, 0x19, 0x5e, 0x2e, 0xb6, 0xe9, 0x72, 0x9e, 0x0f, 0x03, 0xdc, 0x9b, 0xa1, 0xdb, 0x11, 0x16, 0x53, 0x15, 0x41 },
+	  { 0xf2, 0x1d, 0xf1, 0xe9, 0x9a, 0x78, 0x1d, 0xba, 0x4a, 0x68, 0xff, 0x34, 0x91, 0x84, 0x8f, 0x99 } },
+	{ { 0x88, 0xc8, 0x8e, 0xc4, 0xd6, 0x3e, 0xb4, 0x81, 0xcd, 0x8d, 0x6e, 0x8e, 0x8d, 0x2e, 0x27, 0x15, 0xdc, 0xab, 0x18, 0x9b, 0x04, 0x77, 0x1e, 0x66, 0xd1, 0xc9, 0x24, 0x25, 0x87, 0xd7, 0x9a, 0xd8 },
+	  { 0xe4, 0xe8, 0xc9, 0xe4, 0x96, 0x3a, 0x44, 0xf5, 0xcf, 0x27, 0x76, 0x7e, 0x4e, 0x42, 0xfa, 0x61 } },
+	{ { 0x98, 0x9b, 0x95, 0x45, 0x62, 0x5a, 0x40, 0x25, 0xf7, 0x72, 0x5d, 0x63, 0x84, 0x72, 0x13, 0x88, 0x38, 0x43, 0xd1, 0x7f, 0x92, 0x4d, 0x5a, 0x93, 0x1e, 0xee, 0x52, 0x5b, 0xc9, 0x95, 0x60, 0xb9 },
+	  { 0x27, 0x47, 0x51, 0x21, 0xd0, 0xe3, 0x36, 0x7d, 0x0e, 0x0c, 0x2d, 0x9f, 0xb3, 0x9c, 0xfe, 0x95 } },
+	{ { 0xf4, 0x9b, 0x61, 0xf1, 0x90, 0xf9, 0x82, 0xaa, 0x86, 0x6d, 0x5c, 0x8f, 0x2e, 0x57, 0x49, 0x78, 0x1f, 0x04, 0x80, 0x5e, 0x42, 0xae, 0x6c, 0xee, 0x10, 0xe2, 0x7f, 0xc4, 0x7a, 0x09, 0x9e, 0x2c },
+	  { 0xc2, 0x99, 0x06, 0x26, 0xcb, 0x34, 0xc5, 0xd7, 0xfa, 0xfe, 0x04, 0x30, 0x65, 0x0e, 0xd9, 0x07 } },
+	{ { 0x10, 0x15, 0x37, 0xd5, 0xf6, 0x33, 0xad, 0x8d, 0xc7, 0xe8, 0xcc, 0x05, 0x8c, 0xe7, 0xfe, 0x20, 0xdd, 0x9d, 0x86, 0x78, 0x89, 0x9a, 0xa9, 0x39, 0xea, 0x1c, 0x7b, 0xf4, 0x1f, 0x07, 0x47, 0x2b },
+	  { 0x1c, 0x5d, 0x0c, 0xca, 0x28, 0x45, 0xb6, 0x6c, 0x37, 0x1c, 0x17, 0x60, 0xf8, 0x1e, 0x02, 0x4a } },
+	{ { 0x1f, 0x6a, 0xca, 0xa6, 0x66, 0x74, 0x73, 0x3d, 0x28, 0xdf, 0xec, 0x92, 0xc4, 0x3c, 0x7e, 0x76, 0xc1, 0xc0, 0x8a, 0xb2, 0xa1, 0xdf, 0x1f, 0x55, 0xdd, 0x00, 0x6c, 0x94, 0xe7, 0x19, 0x45, 0x61 },
+	  { 0x6f, 0x5a, 0x53, 0xad, 0xdd, 0x93, 0xc9, 0xa1, 0x36, 0x40, 0x1a, 0x80, 0x4a, 0x71, 0x04, 0x19 } },
+	{ { 0xb5, 0x5b, 0xde, 0xfe, 0x37, 0x06, 0x46, 0x69, 0x90, 0x12, 0x06, 0x2d, 0xf7, 0x48, 0xb6, 0xaa, 0xae, 0x9a, 0xd9, 0x1f, 0x7c, 0x4c, 0xd6, 0xf4, 0xeb, 0x40, 0x76, 0x14, 0xad, 0x68, 0x41, 0x78 },
+	  { 0x8e, 0x0c, 0x07, 0x0b, 0xe7, 0x10, 0x9e, 0xad, 0x0e, 0x8c, 0xc0, 0xaa, 0x0b, 0xf9, 0x5e, 0x61 } },
+	{ { 0xde, 0x09, 0xc3, 0x4a, 0x85, 0xd5, 0x6a, 0x27, 0x48, 0x55, 0x9c, 0x30, 0x9f, 0x04, 0xeb, 0x72, 0x20, 0x96, 0xde, 0x14, 0x9b, 0x5c, 0x48, 0x59, 0xe5, 0xcc, 0xb6, 0xbe, 0xa6, 0x91, 0x1f, 0x19 },
+	  { 0xdb, 0x53, 0xb5, 0x30, 0x65, 0x61, 0xdb, 0x89, 0x9a, 0x63, 0x5a, 0x56, 0xc5, 0x6e, 0x72, 0x39 } },
+	{ { 0x26, 0x50, 0xec, 0xd1, 0x33, 0xa5, 0xdf, 0x38, 0x25, 0x07, 0x2a, 0x4d, 0xf2, 0xd9, 0x5d, 0x15, 0xfb, 0xc5, 0x6b, 0x24, 0xfe, 0x3d, 0x93, 0xd0, 0x7f, 0xaf, 0xec, 0xe8, 0x63, 0xff, 0x6d, 0x20 },
+	  { 0x72, 0xe5, 0xac, 0x05, 0x99, 0x0d, 0x3f, 0x55, 0x08, 0x29, 0x5f, 0x95, 0xf8, 0x97, 0x33, 0x13 } },
+	{ { 0xa8, 0x59, 0x9f, 0x0e, 0xdd, 0x64, 0x46, 0xb4, 0xbb, 0x93, 0x71, 0xe3, 0x80, 0xbf, 0x33, 0x48, 0x89, 0x20, 0xc7, 0x21, 0x67, 0x30, 0xac, 0x85, 0x77, 0x86, 0xb3, 0x7d, 0x9b, 0x68, 0x5e, 0x33 },
+	  { 0x86, 0xa8, 0x33, 0x2f, 0x16, 0xf9, 0x97, 0xbc, 0x02, 0xaf, 0x52, 0x71, 0xc6, 0x4e, 0x7e, 0x0f } },
+	{ { 0x67, 0x2e, 0x7b, 0x0d, 0x49, 0x74, 0x58, 0xe2, 0x60, 0x08, 0x46, 0x62, 0xc5, 0x66, 0x39, 0x4e, 0x0f, 0x88, 0xf4, 0x0e, 0x71, 0xc9, 0x3b, 0x39, 0x75, 0x29, 0xe1, 0x0c, 0x5d, 0x26, 0x20, 0x3c },
+	  { 0x8e, 0x53, 0x85, 0x8c, 0xe7, 0xad, 0x0d, 0x25, 0x41, 0x0f, 0x88, 0x6e, 0xee, 0xca, 0x1e, 0x0e } },
+	{ { 0x73, 0xea, 0x41, 0xa5, 0x0c, 0xdd, 0x5a, 0x98, 0x64, 0x4e, 0x6f, 0x8d, 0x97, 0x4a, 0xf2, 0x13, 0x81, 0xdb, 0x71, 0x82, 0x96, 0x64, 0x36, 0x1c, 0x34, 0x26, 0x69, 0x62, 0xb3, 0xec, 0x3e, 0x32 },
+	  { 0xc6, 0xa1, 0xd4, 0x93, 0xd6, 0x07, 0xd2, 0xce, 0xf6, 0xae, 0xf2, 0x9e, 0xe8, 0x78, 0xc4, 0x34 } },
+	{ { 0x14, 0x96, 0x9b, 0x3f, 0xf7, 0x8c, 0xcd, 0xd6, 0x6c, 0x53, 0xb8, 0x02, 0x7a, 0x79, 0x56, 0x3e, 0x47, 0x7a, 0xa5, 0x11, 0x40, 0x63, 0xe4, 0xd2, 0xc2, 0x88, 0x9b, 0xfc, 0x5b, 0x94, 0xfa, 0x06 },
+	  { 0xa4, 0x97, 0x3e, 0x0c, 0xfa, 0xf8, 0xd6, 0xac, 0x67, 0x58, 0x61, 0x5f, 0xc8, 0x1e, 0x06, 0xdf } },
+	{ { 0xd0, 0x9e, 0x27, 0x41, 0xb9, 0x48, 0x0c, 0x21, 0x66, 0xc9, 0xc1, 0x83, 0x26, 0x54, 0x76, 0x3d, 0xe3, 0xed, 0x9b, 0x1d, 0xba, 0x9b, 0x32, 0x7e, 0xa5, 0xd0, 0xfa, 0xa3, 0x93, 0x8a, 0xfc, 0xd9 },
+	  { 0x67, 0xe3, 0x24, 0x3d, 0x8b, 0xc8, 0x18, 0x87, 0x51, 0x77, 0x08, 0xa2, 0x9a, 0x5d, 0x9a, 0xe5 } },
+	{ { 0x22, 0xc6, 0x5e, 0xad, 0x30, 0x3a, 0x03, 0x95, 0xcc, 0x9c, 0x06, 0x5a, 0xda, 0x93, 0x0d, 0xdd, 0x84, 0x0e, 0xbf, 0x20, 0x31, 0x53, 0x2a, 0xf9, 0xf4, 0xa7, 0xf2, 0x01, 0x09, 0xd7, 0x66, 0x3c },
+	  { 0xde, 0x2f, 0x35, 0xdf, 0x51, 0x64, 0x4c, 0xf5, 0xd7, 0x99, 0x84, 0xbe, 0x6c, 0x17, 0xc1, 0x4c } },
+	{ { 0x86, 0x79, 0xef, 0x03, 0x57, 0x51, 0x62, 0x45, 0xec, 0x48, 0x93, 0x86, 0x41, 0x96, 0x46, 0xbc, 0x5a, 0x21, 0x8a, 0xff, 0x60, 0x37, 0x66, 0x0c, 0x23, 0x3e, 0x76, 0xbf, 0x65, 0xc0, 0xa7, 0x70 },
+	  { 0x9e, 0xae, 0xda, 0xbb, 0x3b, 0xd0, 0x46, 0xec, 0x27, 0xa2, 0xbd, 0xaf, 0xab, 0xdb, 0xc8, 0x61 } },
+	{ { 0x60, 0x43, 0x90, 0x2c, 0x11, 0x5f, 0x10, 0x76, 0x39, 0xe7, 0xc9, 0x2b, 0xa4, 0x95, 0x23, 0x01, 0xc4, 0x8f, 0x50, 0x44, 0x5b, 0xe7, 0x20, 0xe0, 0x04, 0x9c, 0xcb, 0x10, 0xce, 0x1b, 0x6f, 0x11 },
+	  { 0x0c, 0xde, 0x7e, 0x6c, 0x1a, 0xec, 0xbb, 0xe9, 0x96, 0x86, 0x5b, 0xf3, 0x0b, 0x17, 0x8d, 0xe7 } },
+	{ { 0xac, 0xa4, 0x43, 0xa9, 0xe3, 0x10, 0x33, 0xea, 0x73, 0xb1, 0xee, 0xda, 0x6e, 0x7d, 0x6c, 0xa1, 0xc8, 0x51, 0x2e, 0x28, 0x41, 0x0b, 0x9b, 0x09, 0x92, 0x1a, 0x90, 0xe3, 0xc5, 0x0c, 0xe2, 0xf6 },
+	  { 0xba, 0x25, 0xbf, 0x5b, 0xe1, 0xe4, 0xc0, 0x99, 0xb9, 0xe4, 0x5e, 0xed, 0xd7, 0x36, 0x9c, 0xb5 } },
+	{ { 0x60, 0x36, 0x2e, 0x2b, 0x0b, 0xf9, 0x98, 0xc8, 0x75, 0xc0, 0x87, 0xc3, 0x70, 0xc4, 0xca, 0x47, 0x72, 0x74, 0x91, 0x73, 0xa0, 0xef, 0x5b, 0x90, 0x2b, 0xfe, 0xce, 0x0e, 0x12, 0x3a, 0x7e, 0x43 },
+	  { 0x80, 0x5b, 0xe6, 0x27, 0x89, 0x54, 0x9c, 0xe6, 0xaf, 0x74, 0x96, 0x64, 0x67, 0xf4, 0x11, 0x35 } },
+	{ { 0x6d, 0x7f, 0x0f, 0x75, 0x84, 0x16, 0x2a, 0x1f, 0xa4, 0xdd, 0x67, 0x64, 0x54, 0x8f, 0x35, 0x5a, 0xf2, 0x2f, 0x77, 0x54, 0x29, 0xbb, 0xc7, 0x76, 0x84, 0x8a, 0x58, 0x6a, 0x75, 0xce, 0x6f, 0x76 },
+	  { 0xab, 0x60, 0x01, 0xc6, 0xc4, 0xc5, 0x6e, 0x8c, 0xa3, 0x93, 0xc5, 0xfd, 0x17, 0x35, 0x05, 0xba } },
+	{ { 0xd8, 0xec, 0xc3, 0x9a, 0xc1, 0xd0, 0x0c, 0x53, 0x21, 0x6f, 0x6e, 0x64, 0xe8, 0x26, 0xa7, 0xa9, 0x59, 0x4f, 0x76, 0x92, 0xed, 0x7e, 0xa9, 0xfa, 0x27, 0x19, 0x9d, 0x97, 0x62, 0xfb, 0x6a, 0xcc },
+	  { 0x3b, 0xa3, 0x67, 0x3f, 0x4f, 0x49, 0x5d, 0xd1, 0x54, 0x1d, 0x47, 0xc2, 0x2b, 0x79, 0x21, 0xc5 } },
+	{ { 0x49, 0x31, 0x08, 0xf9, 0x1c, 0xae, 0xdf, 0x71, 0x46, 0x52, 0x14, 0x9a, 0x2b, 0x20, 0x30, 0xfe, 0x62, 0xec, 0x11, 0xad, 0xa2, 0x37, 0xf4, 0x2b, 0x73, 0x04, 0xda, 0x55, 0x49, 0x82, 0x4b, 0x09 },
+	  { 0xb2, 0x4f, 0xe1, 0x7c, 0xdc, 0x5c, 0x8c, 0xfa, 0x42, 0x60, 0xc3, 0x86, 0x91, 0xb5, 0x7b, 0xfa } },
+	{ { 0x44, 0x6a, 0xf6, 0xdd, 0x5f, 0x58, 0x75, 0x5a, 0xea, 0xa0, 0xa1, 0x22, 0x6d, 0x8c, 0x58, 0x4f, 0xd0, 0xa3, 0xf0, 0xd1, 0x7e, 0x6b, 0x78, 0xd1, 0x31, 0x64, 0x19, 0xd3, 0xd8, 0x37, 0x30, 0xf3 },
+	  { 0x86, 0xd9, 0x99, 0xa6, 0x3b, 0x96, 0xf6, 0xc9, 0xd9, 0xaa, 0xf3, 0xbe, 0x62, 0x02, 0x97, 0x7b } },
+	{ { 0x65, 0xf9, 0x2d, 0x4e, 0x17, 0x23, 0xd5, 0xe5, 0x8a, 0xeb, 0x35, 0x0c, 0x79, 0xdf, 0x28, 0xde, 0x56, 0x7a, 0x69, 0x77, 0x45, 0xfd, 0x8e, 0x18, 0xe8, 0xce, 0xea, 0x6d, 0xba, 0x35, 0xa7, 0x88 },
+	  { 0xc4, 0x71, 0x2a, 0xa7, 0x33, 0xf9, 0x73, 0x7f, 0x91, 0xe4, 0xed, 0x61, 0x60, 0x9e, 0x02, 0xf1 } },
+	{ { 0x91, 0x5c, 0xee, 0x6a, 0xf4, 0xea, 0x95, 0x62, 0x3f, 0x71, 0x22, 0xac, 0xda, 0x5e, 0x90, 0x40, 0x92, 0x0b, 0x43, 0xd0, 0x76, 0x04, 0xfd, 0x67, 0x79, 0x2a, 0x07, 0x0c, 0xda, 0xab, 0xa5, 0x79 },
+	  { 0x0e, 0x8c, 0x1a, 0x77, 0xb2, 0x80, 0xf4, 0xc7, 0x53, 0x68, 0x27, 0x68, 0xfd, 0x6f, 0x3b, 0x23 } },
+	{ { 0x8e, 0x9b, 0xb2, 0x88, 0x7f, 0xe6, 0x0d, 0x42, 0xdb, 0x4d, 0x82, 0x7f, 0x00, 0xba, 0x68, 0xff, 0x9c, 0x87, 0x59, 0xa7, 0xc4, 0x84, 0x09, 0xa0, 0x2a, 0x42, 0x20, 0x64, 0x27, 0xc4, 0x9e, 0x5a },
+	  { 0xdc, 0xcb, 0x68, 0x4d, 0x47, 0xc4, 0x80, 0xcc, 0x13, 0x17, 0xdc, 0xaa, 0x45, 0x12, 0x34, 0xc0 } },
+	{ { 0xcb, 0xf8, 0x5a, 0x66, 0x45, 0x46, 0x9e, 0x5d, 0xf8, 0x82, 0xfe, 0x84, 0x07, 0x76, 0xb6, 0xaa, 0x40, 0x4c, 0x31, 0xea, 0x83, 0x40, 0x89, 0x6c, 0x39, 0x55, 0xfc, 0xce, 0x62, 0xd6, 0xaa, 0x9a },
+	  { 0x9a, 0x2c, 0x4f, 0x07, 0x48, 0x9c, 0x14, 0x26, 0x5e, 0x33, 0xac, 0x03, 0x1d, 0x02, 0xb3, 0xd8 } },
+	{ { 0x3e, 0xa3, 0xc3, 0x3d, 0x74, 0x39, 0xab, 0x3c, 0x47, 0x8c, 0x01, 0x90, 0x7f, 0x13, 0xcd, 0xa7, 0xda, 0x60, 0x7e, 0xed, 0xcb, 0xdc, 0x9d, 0x4a, 0x67, 0x66, 0x50, 0xcd, 0x7f, 0xd4, 0x19, 0x42 },
+	  { 0x5c, 0x8e, 0x62, 0x2d, 0xdb, 0xd3, 0x2e, 0xe7, 0x9c, 0x17, 0x57, 0x2e, 0x8b, 0x3e, 0xe6, 0x1c } },
+	{ { 0x31, 0x2c, 0x5b, 0x43, 0x26, 0x3c, 0x1a, 0xf8, 0xd1, 0xe3, 0x5c, 0x0f, 0x24, 0xd1, 0x00, 0x43, 0x86, 0xee, 0x1c, 0xc0, 0x10, 0x0f, 0xb3, 0xad, 0xfb, 0x71, 0x07, 0xe3, 0xf4, 0xea, 0xff, 0x5e },
+	  { 0xc5, 0xd2, 0xcb, 0x3d, 0x5b, 0x7f, 0xf0, 0xe2, 0x3e, 0x30, 0x89, 0x67, 0xee, 0x07, 0x48, 0x25 } },
+};
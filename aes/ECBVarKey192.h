@@ -0,0 +1,248 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+#include "aes_kat.h"
+
+//Vector i of ECBVarKey192 uses a key with its first i + 1 bits set and an
+//all-zero plaintext, so only the ciphertexts are stored and aes.c builds
+//the key and plaintext from the vector number.  NIST lists every vector
+//under [ENCRYPT] and again under [DECRYPT]; the suite runs the table twice.
+const unsigned char ECBVarKey192[192][16] = {
+	{ 0xde, 0x88, 0x5d, 0xc8, 0x7f, 0x5a, 0x92, 0x59, 0x40, 0x82, 0xd0, 0x2c, 0xc1, 0xe1, 0xb4, 0x2c },
+	{ 0x13, 0x2b, 0x07, 0x4e, 0x80, 0xf2, 0xa5, 0x97, 0xbf, 0x5f, 0xeb, 0xd8, 0xea, 0x5d, 0xa5, 0x5e },
+	{ 0x6e, 0xcc, 0xed, 0xf8, 0xde, 0x59, 0x2c, 0x22, 0xfb, 0x81, 0x34, 0x7b, 0x79, 0xf2, 0xdb, 0x1f },
+	{ 0x18, 0x0b, 0x09, 0xf2, 0x67, 0xc4, 0x51, 0x45, 0xdb, 0x2f, 0x82, 0x6c, 0x25, 0x82, 0xd3, 0x5c },
+	{ 0xed, 0xd8, 0x07, 0xef, 0x76, 0x52, 0xd7, 0xeb, 0x0e, 0x13, 0xc8, 0xb5, 0xe1, 0x5b, 0x3b, 0xc0 },
+	{ 0x99, 0x78, 0xbc, 0xf8, 0xdd, 0x8f, 0xd7, 0x22, 0x41, 0x22, 0x3a, 0xd2, 0x4b, 0x31, 0xb8, 0xa4 },
+	{ 0x53, 0x10, 0xf6, 0x54, 0x34, 0x3e, 0x8f, 0x27, 0xe1, 0x2c, 0x83, 0xa4, 0x8d, 0x24, 0xff, 0x81 },
+	{ 0x83, 0x3f, 0x71, 0x25, 0x8d, 0x53, 0x03, 0x6b, 0x02, 0x95, 0x2c, 0x76, 0xc7, 0x44, 0xf5, 0xa1 },
+	{ 0xeb, 0xa8, 0x3f, 0xf2, 0x00, 0xcf, 0xf9, 0x31, 0x8a, 0x92, 0xf8, 0x69, 0x1a, 0x06, 0xb0, 0x9f },
+	{ 0xff, 0x62, 0x0c, 0xcb, 0xe9, 0xf3, 0x29, 0x2a, 0xbd, 0xf2, 0x17, 0x6b, 0x09, 0xf0, 0x4e, 0xba },
+	{ 0x7a, 0xba, 0xbc, 0x4b, 0x3f, 0x51, 0x6c, 0x9a, 0xaf, 0xb3, 0x5f, 0x41, 0x40, 0xb5, 0x48, 0xf9 },
+	{ 0xaa, 0x18, 0x78, 0x24, 0xd9, 0xc4, 0x58, 0x2b, 0x09, 0x16, 0x49, 0x3e, 0xcb, 0xde, 0x8c, 0x57 },
+	{ 0x1c, 0x0a, 0xd5, 0x53, 0x17, 0x7f, 0xd5, 0xea, 0x10, 0x92, 0xc9, 0xd6, 0x26, 0xa2, 0x9d, 0xc4 },
+	{ 0xa5, 0xdc, 0x46, 0xc3, 0x72, 0x61, 0x19, 0x41, 0x24, 0xec, 0xae, 0xbd, 0x68, 0x04, 0x08, 0xec },
+	{ 0xe4, 0xf2, 0xf2, 0xae, 0x23, 0xe9, 0xb1, 0x0b, 0xac, 0xfa, 0x58, 0x60, 0x15, 0x31, 0xba, 0x54 },
+	{ 0xb7, 0xd6, 0x7c, 0xf1, 0xa1, 0xe9, 0x1e, 0x8f, 0xf3, 0xa5, 0x7a, 0x17, 0x2c, 0x7b, 0xf4, 0x12 },
+	{ 0x26, 0x70, 0x6b, 0xe0, 0x69, 0x67, 0x88, 0x4e, 0x84, 0x7d, 0x13, 0x71, 0x28, 0xce, 0x47, 0xb3 },
+	{ 0xb2, 0xf8, 0xb4, 0x09, 0xb0, 0x58, 0x59, 0x09, 0xaa, 0xd3, 0xa7, 0xb5, 0xa2, 0x19, 0x07, 0x2a },
+	{ 0x5e, 0x4b, 0x7b, 0xff, 0x02, 0x90, 0xc7, 0x83, 0x44, 0xc5, 0x4a, 0x23, 0xb7, 0x22, 0xcd, 0x20 },
+	{ 0x07, 0x09, 0x36, 0x57, 0x55, 0x2d, 0x44, 0x14, 0x22, 0x7c, 0xe1, 0x61, 0xe9, 0xeb, 0xf7, 0xdd },
+	{ 0xe1, 0xaf, 0x1e, 0x7d, 0x8b, 0xc2, 0x25, 0xed, 0x4d, 0xff, 0xb7, 0x71, 0xec, 0xbb, 0x9e, 0x67 },
+	{ 0xef, 0x65, 0x55, 0x25, 0x36, 0x35, 0xd8, 0x43, 0x21, 0x56, 0xcf, 0xd9, 0xc1, 0x1b, 0x14, 0x5a },
+	{ 0xfb, 0x40, 0x35, 0x07, 0x4a, 0x5d, 0x42, 0x60, 0xc9, 0x0c, 0xbd, 0x6d, 0xa6, 0xc3, 0xfc, 0xeb },
+	{ 0x44, 0x6e, 0xe4, 0x16, 0xf9, 0xad, 0x1c, 0x10, 0x3e, 0xb0, 0xcc, 0x96, 0x75, 0x1c, 0x88, 0xe1 },
+	{ 0x19, 0x8a, 0xe2, 0xa4, 0x63, 0x7a, 0xc0, 0xa7, 0x89, 0x0a, 0x8f, 0xd1, 0x48, 0x54, 0x45, 0xc9 },
+	{ 0x56, 0x20, 0x12, 0xec, 0x8f, 0xad, 0xed, 0x08, 0x25, 0xfb, 0x2f, 0xa7, 0x0a, 0xb3, 0x0c, 0xbd },
+	{ 0xcc, 0x8a, 0x64, 0xb4, 0x6b, 0x5d, 0x88, 0xbf, 0x7f, 0x24, 0x7d, 0x4d, 0xba, 0xf3, 0x8f, 0x05 },
+	{ 0xa1, 0x68, 0x25, 0x37, 0x62, 0xe2, 0xcc, 0x81, 0xb4, 0x2d, 0x1e, 0x50, 0x01, 0x76, 0x26, 0x99 },
+	{ 0x1b, 0x41, 0xf8, 0x3b, 0x38, 0xce, 0x50, 0x32, 0xc6, 0xcd, 0x7a, 0xf9, 0x8c, 0xf6, 0x20, 0x61 },
+	{ 0x61, 0xa8, 0x99, 0x90, 0xcd, 0x14, 0x11, 0x75, 0x0d, 0x5f, 0xb0, 0xdc, 0x98, 0x84, 0x47, 0xd4 },
+	{ 0xb5, 0xac, 0xcc, 0x8e, 0xd6, 0x29, 0xed, 0xf8, 0xc6, 0x8a, 0x53, 0x91, 0x83, 0xb1, 0xea, 0x82 },
+	{ 0xb1, 0x6f, 0xa7, 0x1f, 0x84, 0x6b, 0x81, 0xa1, 0x3f, 0x36, 0x1c, 0x43, 0xa8, 0x51, 0xf2, 0x90 },
+	{ 0x4f, 0xad, 0x6e, 0xfd, 0xff, 0x59, 0x75, 0xae, 0xe7, 0x69, 0x22, 0x34, 0xbc, 0xd5, 0x44, 0x88 },
+	{ 0xeb, 0xfd, 0xb0, 0x5a, 0x78, 0x3d, 0x03, 0x08, 0x2d, 0xfe, 0x5f, 0xdd, 0x80, 0xa0, 0x0b, 0x17 },
+	{ 0xeb, 0x81, 0xb5, 0x84, 0x76, 0x69, 0x97, 0xaf, 0x6b, 0xa5, 0x52, 0x9d, 0x3b, 0xdd, 0x86, 0x09 },
+	{ 0x0c, 0xf4, 0xff, 0x4f, 0x49, 0xc8, 0xa0, 0xca, 0x06, 0x0c, 0x44, 0x34, 0x99, 0xe2, 0x93, 0x13 },
+	{ 0xcc, 0x4b, 0xa8, 0xa8, 0xe0, 0x29, 0xf8, 0xb2, 0x6d, 0x8a, 0xff, 0xf9, 0xdf, 0x13, 0x3b, 0xb6 },
+	{ 0xfe, 0xfe, 0xbf, 0x64, 0x36, 0x0f, 0x38, 0xe4, 0xe6, 0x35, 0x58, 0xf0, 0xff, 0xc5, 0x50, 0xc3 },
+	{ 0x12, 0xad, 0x98, 0xcb, 0xf7, 0x25, 0x13, 0x7d, 0x6a, 0x81, 0x08, 0xc2, 0xbe, 0xd9, 0x93, 0x22 },
+	{ 0x6a, 0xfa, 0xa9, 0x96, 0x22, 0x61, 0x98, 0xb3, 0xe2, 0x61, 0x04, 0x13, 0xce, 0x1b, 0x3f, 0x78 },
+	{ 0x2a, 0x8c, 0xe6, 0x74, 0x7a, 0x7e, 0x39, 0x36, 0x78, 0x28, 0xe2, 0x90, 0x84, 0x85, 0x02, 0xd9 },
+	{ 0x22, 0x37, 0x36, 0xe8, 0xb8, 0xf8, 0x9c, 0xa1, 0xe3, 0x7b, 0x6d, 0xea, 0xb4, 0x0f, 0xac, 0xf1 },
+	{ 0xc0, 0xf7, 0x97, 0xe5, 0x04, 0x18, 0xb9, 0x5f, 0xa6, 0x01, 0x33, 0x33, 0x91, 0x7a, 0x94, 0x80 },
+	{ 0xa7, 0x58, 0xde, 0x37, 0xc2, 0xec, 0xe2, 0xa0, 0x2c, 0x73, 0xc0, 0x1f, 0xed, 0xc9, 0xa1, 0x32 },
+	{ 0x3a, 0x9b, 0x87, 0xae, 0x77, 0xba, 0xe7, 0x06, 0x80, 0x39, 0x66, 0xc6, 0x6c, 0x73, 0xad, 0xbd },
+	{ 0xd3, 0x65, 0xab, 0x8d, 0xf8, 0xff, 0xd7, 0x82, 0xe3, 0x58, 0x12, 0x1a, 0x4a, 0x4f, 0xc5, 0x41 },
+	{ 0xc8, 0xdc, 0xd9, 0xe6, 0xf7, 0x5e, 0x6c, 0x36, 0xc8, 0xda, 0xee, 0x04, 0x66, 0xf0, 0xed, 0x74 },
+	{ 0xc7, 0x9a, 0x63, 0x7b, 0xeb, 0x1c, 0x03, 0x04, 0xf1, 0x40, 0x14, 0xc0, 0x37, 0xe7, 0x36, 0xdd },
+	{ 0x10, 0x5f, 0x0a, 0x25, 0xe8, 0x4a, 0xc9, 0x30, 0xd9, 0x96, 0x28, 0x1a, 0x5f, 0x95, 0x4d, 0xd9 },
+	{ 0x42, 0xe4, 0x07, 0x4b, 0x29, 0x27, 0x97, 0x3e, 0x8d, 0x17, 0xff, 0xa9, 0x2f, 0x7f, 0xe6, 0x15 },
+	{ 0x4f, 0xe2, 0xa9, 0xd2, 0xc1, 0x82, 0x44, 0x49, 0xc6, 0x9e, 0x3e, 0x03, 0x98, 0xf1, 0x29, 0x63 },
+	{ 0xb7, 0xf2, 0x9c, 0x1e, 0x1f, 0x62, 0x84, 0x7a, 0x15, 0x25, 0x3b, 0x28, 0xa1, 0xe9, 0xd7, 0x12 },
+	{ 0x36, 0xed, 0x5d, 0x29, 0xb9, 0x03, 0xf3, 0x1e, 0x89, 0x83, 0xef, 0x8b, 0x0a, 0x2b, 0xf9, 0x90 },
+	{ 0x27, 0xb8, 0x07, 0x02, 0x70, 0x81, 0x0f, 0x9d, 0x02, 0x3f, 0x9d, 0xd7, 0xff, 0x3b, 0x4a, 0xa2 },
+	{ 0x94, 0xd4, 0x6e, 0x15, 0x5c, 0x12, 0x28, 0xf6, 0x1d, 0x1a, 0x0d, 0xb4, 0x81, 0x5e, 0xcc, 0x4b },
+	{ 0xca, 0x61, 0x08, 0xd1, 0xd9, 0x80, 0x71, 0x42, 0x8e, 0xec, 0xee, 0xf1, 0x71, 0x4b, 0x96, 0xdd },
+	{ 0xdc, 0x5b, 0x25, 0xb7, 0x1b, 0x62, 0x96, 0xcf, 0x73, 0xdd, 0x2c, 0xdc, 0xac, 0x2f, 0x70, 0xb1 },
+	{ 0x44, 0xab, 0xa9, 0x5e, 0x8a, 0x06, 0xa2, 0xd9, 0xd3, 0x53, 0x0d, 0x26, 0x77, 0x87, 0x8c, 0x80 },
+	{ 0xa5, 0x70, 0xd2, 0x0e, 0x89, 0xb4, 0x67, 0xe8, 0xf5, 0x17, 0x60, 0x61, 0xb8, 0x1d, 0xd3, 0x96 },
+	{ 0x75, 0x8f, 0x44, 0x67, 0xa5, 0xd8, 0xf1, 0xe7, 0x30, 0x7d, 0xc3, 0x0b, 0x34, 0xe4, 0x04, 0xf4 },
+	{ 0xbc, 0xea, 0x28, 0xe9, 0x07, 0x1b, 0x5a, 0x23, 0x02, 0x97, 0x0f, 0xf3, 0x52, 0x45, 0x1b, 0xc5 },
+	{ 0x75, 0x23, 0xc0, 0x0b, 0xc1, 0x77, 0xd3, 0x31, 0xad, 0x31, 0x2e, 0x09, 0xc9, 0x01, 0x5c, 0x1c },
+	{ 0xcc, 0xac, 0x61, 0xe3, 0x18, 0x37, 0x47, 0xb3, 0xf5, 0x83, 0x6d, 0xa2, 0x1a, 0x1b, 0xc4, 0xf4 },
+	{ 0x70, 0x7b, 0x07, 0x57, 0x91, 0x87, 0x88, 0x80, 0xb4, 0x41, 0x89, 0xd3, 0x52, 0x2b, 0x8c, 0x30 },
+	{ 0x71, 0x32, 0xd0, 0xc0, 0xe4, 0xa0, 0x75, 0x93, 0xcf, 0x12, 0xeb, 0xb1, 0x2b, 0xe7, 0x68, 0x8c },
+	{ 0xef, 0xfb, 0xac, 0x16, 0x44, 0xde, 0xb0, 0xc7, 0x84, 0x27, 0x5f, 0xe5, 0x6e, 0x19, 0xea, 0xd3 },
+	{ 0xa0, 0x05, 0x06, 0x3f, 0x30, 0xf4, 0x22, 0x8b, 0x37, 0x4e, 0x24, 0x59, 0x73, 0x8f, 0x26, 0xbb },
+	{ 0x29, 0x97, 0x5b, 0x5f, 0x48, 0xbb, 0x68, 0xfc, 0xbb, 0xc7, 0xce, 0xa9, 0x3b, 0x45, 0x2e, 0xd7 },
+	{ 0xcf, 0x3f, 0x25, 0x76, 0xe2, 0xaf, 0xed, 0xc7, 0x4b, 0xb1, 0xca, 0x7e, 0xee, 0xc1, 0xc0, 0xe7 },
+	{ 0x07, 0xc4, 0x03, 0xf5, 0xf9, 0x66, 0xe0, 0xe3, 0xd9, 0xf2, 0x96, 0xd6, 0x22, 0x6d, 0xca, 0x28 },
+	{ 0xc8, 0xc2, 0x09, 0x08, 0x24, 0x9a, 0xb4, 0xa3, 0x4d, 0x6d, 0xd0, 0xa3, 0x13, 0x27, 0xff, 0x1a },
+	{ 0xc0, 0x54, 0x13, 0x29, 0xec, 0xb6, 0x15, 0x9a, 0xb2, 0x3b, 0x7f, 0xc5, 0xe6, 0xa2, 0x1b, 0xca },
+	{ 0x7a, 0xa1, 0xac, 0xf1, 0xa2, 0xed, 0x9b, 0xa7, 0x2b, 0xc6, 0xde, 0xb3, 0x1d, 0x88, 0xb8, 0x63 },
+	{ 0x80, 0x8b, 0xd8, 0xed, 0xda, 0xbb, 0x6f, 0x3b, 0xf0, 0xd5, 0xa8, 0xa2, 0x7b, 0xe1, 0xfe, 0x8a },
+	{ 0x27, 0x3c, 0x7d, 0x76, 0x85, 0xe1, 0x4e, 0xc6, 0x6b, 0xbb, 0x96, 0xb8, 0xf0, 0x5b, 0x6d, 0xdd },
+	{ 0x32, 0x75, 0x2e, 0xef, 0xc8, 0xc2, 0xa9, 0x3f, 0x91, 0xb6, 0xe7, 0x3e, 0xb0, 0x7c, 0xca, 0x6e },
+	{ 0xd8, 0x93, 0xe7, 0xd6, 0x2f, 0x6c, 0xe5, 0x02, 0xc6, 0x4f, 0x75, 0xe2, 0x81, 0xf9, 0xc0, 0x00 },
+	{ 0x8d, 0xfd, 0x99, 0x9b, 0xe5, 0xd0, 0xcf, 0xa3, 0x57, 0x32, 0xc0, 0xdd, 0xc8, 0x8f, 0xf5, 0xa5 },
+	{ 0x02, 0x64, 0x7c, 0x76, 0xa3, 0x00, 0xc3, 0x17, 0x3b, 0x84, 0x14, 0x87, 0xeb, 0x2b, 0xae, 0x9f },
+	{ 0x17, 0x2d, 0xf8, 0xb0, 0x2f, 0x04, 0xb5, 0x3a, 0xda, 0xb0, 0x28, 0xb4, 0xe0, 0x1a, 0xcd, 0x87 },
+	{ 0x05, 0x4b, 0x3b, 0xf4, 0x99, 0x8a, 0xeb, 0x05, 0xaf, 0xd8, 0x7e, 0xc5, 0x36, 0x53, 0x3a, 0x36 },
+	{ 0x37, 0x83, 0xf7, 0xbf, 0x44, 0xc9, 0x7f, 0x06, 0x52, 0x58, 0xa6, 0x66, 0xca, 0xe0, 0x30, 0x20 },
+	{ 0xaa, 0xd4, 0xc8, 0xa6, 0x3f, 0x80, 0x95, 0x41, 0x04, 0xde, 0x7b, 0x92, 0xce, 0xde, 0x1b, 0xe1 },
+	{ 0xcb, 0xfe, 0x61, 0x81, 0x0f, 0xd5, 0x46, 0x7c, 0xcd, 0xac, 0xb7, 0x58, 0x00, 0xf3, 0xac, 0x07 },
+	{ 0x83, 0x0d, 0x8a, 0x25, 0x90, 0xf7, 0xd8, 0xe1, 0xb5, 0x5a, 0x73, 0x7f, 0x4a, 0xf4, 0x5f, 0x34 },
+	{ 0xff, 0xfc, 0xd4, 0x68, 0x3f, 0x85, 0x80, 0x58, 0xe7, 0x43, 0x14, 0x67, 0x1d, 0x43, 0xfa, 0x2c },
+	{ 0x52, 0x3d, 0x0b, 0xab, 0xbb, 0x82, 0xf4, 0x6e, 0xbc, 0x9e, 0x70, 0xb1, 0xcd, 0x41, 0xdd, 0xd0 },
+	{ 0x34, 0x4a, 0xab, 0x37, 0x08, 0x0d, 0x74, 0x86, 0xf7, 0xd5, 0x42, 0xa3, 0x09, 0xe5, 0x3e, 0xed },
+	{ 0x56, 0xc5, 0x60, 0x9d, 0x09, 0x06, 0xb2, 0x3a, 0xb9, 0xca, 0xca, 0x81, 0x6f, 0x5d, 0xbe, 0xbd },
+	{ 0x70, 0x26, 0x02, 0x6e, 0xed, 0xd9, 0x1a, 0xdc, 0x6d, 0x83, 0x1c, 0xdf, 0x98, 0x94, 0xbd, 0xc6 },
+	{ 0x88, 0x33, 0x0b, 0xaa, 0x4f, 0x2b, 0x61, 0x8f, 0xc9, 0xd9, 0xb0, 0x21, 0xbf, 0x50, 0x3d, 0x5a },
+	{ 0xfc, 0x9e, 0x0e, 0xa2, 0x24, 0x80, 0xb0, 0xba, 0xc9, 0x35, 0xc8, 0xa8, 0xeb, 0xef, 0xcd, 0xcf },
+	{ 0x29, 0xca, 0x77, 0x9f, 0x39, 0x8f, 0xb0, 0x4f, 0x86, 0x7d, 0xa7, 0xe8, 0xa4, 0x47, 0x56, 0xcb },
+	{ 0x51, 0xf8, 0x9c, 0x42, 0x98, 0x57, 0x86, 0xbf, 0xc4, 0x3c, 0x6d, 0xf8, 0xad, 0xa3, 0x68, 0x32 },
+	{ 0x6a, 0xc1, 0xde, 0x5f, 0xb8, 0xf2, 0x1d, 0x87, 0x4e, 0x91, 0xc5, 0x3b, 0x56, 0x0c, 0x50, 0xe3 },
+	{ 0x03, 0xaa, 0x90, 0x58, 0x49, 0x0e, 0xda, 0x30, 0x60, 0x01, 0xa8, 0xa9, 0xf4, 0x8d, 0x0c, 0xa7 },
+	{ 0xe3, 0x4e, 0xc7, 0x1d, 0x61, 0x28, 0xd4, 0x87, 0x18, 0x65, 0xd6, 0x17, 0xc3, 0x0b, 0x37, 0xe3 },
+	{ 0x14, 0xbe, 0x1c, 0x53, 0x5b, 0x17, 0xca, 0xbd, 0x0c, 0x4d, 0x93, 0x52, 0x9d, 0x69, 0xbf, 0x47 },
+	{ 0xc9, 0xef, 0x67, 0x75, 0x65, 0x07, 0xbe, 0xec, 0x9d, 0xd3, 0x86, 0x28, 0x83, 0x47, 0x80, 0x44 },
+	{ 0x40, 0xe2, 0x31, 0xfa, 0x5a, 0x59, 0x48, 0xce, 0x21, 0x34, 0xe9, 0x2f, 0xc0, 0x66, 0x4d, 0x4b },
+	{ 0x03, 0x19, 0x4b, 0x8e, 0x5d, 0xda, 0x55, 0x30, 0xd0, 0xc6, 0x78, 0xc0, 0xb4, 0x8f, 0x5d, 0x92 },
+	{ 0x90, 0xbd, 0x08, 0x6f, 0x23, 0x7c, 0xc4, 0xfd, 0x99, 0xf4, 0xd7, 0x6b, 0xde, 0x6b, 0x48, 0x26 },
+	{ 0x19, 0x25, 0x97, 0x61, 0xca, 0x17, 0x13, 0x0d, 0x6e, 0xd8, 0x6d, 0x57, 0xcd, 0x79, 0x51, 0xee },
+	{ 0xd7, 0xcb, 0xb3, 0xf3, 0x4b, 0x9b, 0x45, 0x0f, 0x24, 0xb0, 0xe8, 0x51, 0x8e, 0x54, 0xda, 0x6d },
+	{ 0x72, 0x5b, 0x9c, 0xae, 0xbe, 0x9f, 0x7f, 0x41, 0x7f, 0x40, 0x68, 0xd0, 0xd2, 0xee, 0x20, 0xb3 },
+	{ 0x9d, 0x92, 0x4b, 0x93, 0x4a, 0x90, 0xce, 0x1f, 0xd3, 0x9b, 0x8a, 0x97, 0x94, 0xf8, 0x26, 0x72 },
+	{ 0xc5, 0x05, 0x62, 0xbf, 0x09, 0x45, 0x26, 0xa9, 0x1c, 0x5b, 0xc6, 0x3c, 0x0c, 0x22, 0x49, 0x95 },
+	{ 0xd2, 0xf1, 0x18, 0x05, 0x04, 0x67, 0x43, 0xbd, 0x74, 0xf5, 0x71, 0x88, 0xd9, 0x18, 0x8d, 0xf7 },
+	{ 0x8d, 0xd2, 0x74, 0xbd, 0x0f, 0x1b, 0x58, 0xae, 0x34, 0x5d, 0x9e, 0x72, 0x33, 0xf9, 0xb8, 0xf3 },
+	{ 0x9d, 0x6b, 0xdc, 0x8f, 0x4c, 0xe5, 0xfe, 0xb0, 0xf3, 0xbe, 0xd2, 0xe4, 0xb9, 0xa9, 0xbb, 0x0b },
+	{ 0xfd, 0x55, 0x48, 0xbc, 0xf3, 0xf4, 0x25, 0x65, 0xf7, 0xef, 0xa9, 0x45, 0x62, 0x52, 0x8d, 0x46 },
+	{ 0xd2, 0xcc, 0xae, 0xbd, 0x3a, 0x4c, 0x3e, 0x80, 0xb0, 0x63, 0x74, 0x81, 0x31, 0xba, 0x4a, 0x71 },
+	{ 0xe0, 0x3c, 0xb2, 0x3d, 0x9e, 0x11, 0xc9, 0xd9, 0x3f, 0x11, 0x7e, 0x9c, 0x0a, 0x91, 0xb5, 0x76 },
+	{ 0x78, 0xf9, 0x33, 0xa2, 0x08, 0x1a, 0xc1, 0xdb, 0x84, 0xf6, 0x9d, 0x10, 0xf4, 0x52, 0x3f, 0xe0 },
+	{ 0x40, 0x61, 0xf7, 0x41, 0x2e, 0xd3, 0x20, 0xde, 0x0e, 0xdc, 0x88, 0x51, 0xc2, 0xe2, 0x43, 0x6f },
+	{ 0x90, 0x64, 0xba, 0x1c, 0xd0, 0x4c, 0xe6, 0xba, 0xb9, 0x84, 0x74, 0x33, 0x08, 0x14, 0xb4, 0xd4 },
+	{ 0x48, 0x39, 0x1b, 0xff, 0xb9, 0xcf, 0xff, 0x80, 0xac, 0x23, 0x8c, 0x88, 0x6e, 0xf0, 0xa4, 0x61 },
+	{ 0xb8, 0xd2, 0xa6, 0x7d, 0xf5, 0xa9, 0x99, 0xfd, 0xbf, 0x93, 0xed, 0xd0, 0x34, 0x32, 0x96, 0xc9 },
+	{ 0xaa, 0xca, 0x73, 0x67, 0x39, 0x6b, 0x69, 0xa2, 0x21, 0xbd, 0x63, 0x2b, 0xea, 0x38, 0x6e, 0xec },
+	{ 0xa8, 0x0f, 0xd5, 0x02, 0x0d, 0xfe, 0x65, 0xf5, 0xf1, 0x62, 0x93, 0xec, 0x92, 0xc6, 0xfd, 0x89 },
+	{ 0x21, 0x62, 0x99, 0x5b, 0x82, 0x17, 0xa6, 0x7f, 0x1a, 0xbc, 0x34, 0x2e, 0x14, 0x64, 0x06, 0xf8 },
+	{ 0xc6, 0xa6, 0x16, 0x4b, 0x7a, 0x60, 0xba, 0xe4, 0xe9, 0x86, 0xff, 0xac, 0x28, 0xdf, 0xad, 0xd9 },
+	{ 0x64, 0xe0, 0xd7, 0xf9, 0x00, 0xe3, 0xd9, 0xc8, 0x3e, 0x4b, 0x8f, 0x96, 0x71, 0x7b, 0x21, 0x46 },
+	{ 0x1a, 0xd2, 0x56, 0x1d, 0xe8, 0xc1, 0x23, 0x2f, 0x5d, 0x8d, 0xba, 0xb4, 0x73, 0x9b, 0x6c, 0xbb },
+	{ 0x27, 0x96, 0x89, 0xe9, 0xa5, 0x57, 0xf5, 0x8b, 0x1c, 0x3b, 0xf4, 0x0c, 0x97, 0xa9, 0x09, 0x64 },
+	{ 0xc4, 0x63, 0x7e, 0x4a, 0x5e, 0x63, 0x77, 0xf9, 0xcc, 0x5a, 0x86, 0x38, 0x04, 0x5d, 0xe0, 0x29 },
+	{ 0x49, 0x2e, 0x60, 0x7e, 0x5a, 0xea, 0x46, 0x88, 0x59, 0x4b, 0x45, 0xf3, 0xae, 0xe3, 0xdf, 0x90 },
+	{ 0xe8, 0xc4, 0xe4, 0x38, 0x1f, 0xee, 0xc7, 0x40, 0x54, 0x95, 0x4c, 0x05, 0xb7, 0x77, 0xa0, 0x0a },
+	{ 0x91, 0x54, 0x95, 0x14, 0x60, 0x5f, 0x38, 0x24, 0x6c, 0x9b, 0x72, 0x4a, 0xd8, 0x39, 0xf0, 0x1d },
+	{ 0x74, 0xb2, 0x4e, 0x3b, 0x6f, 0xef, 0xe4, 0x0a, 0x4f, 0x9e, 0xf7, 0xac, 0x6e, 0x44, 0xd7, 0x6a },
+	{ 0x24, 0x37, 0xa6, 0x83, 0xdc, 0x5d, 0x4b, 0x52, 0xab, 0xb4, 0xa1, 0x23, 0xa8, 0xdf, 0x86, 0xc6 },
+	{ 0xbb, 0x28, 0x52, 0xc8, 0x91, 0xc5, 0x94, 0x7d, 0x2e, 0xd4, 0x40, 0x32, 0xc4, 0x21, 0xb8, 0x5f },
+	{ 0x1b, 0x9f, 0x5f, 0xbd, 0x5e, 0x8a, 0x42, 0x64, 0xc0, 0xa8, 0x5b, 0x80, 0x40, 0x9a, 0xfa, 0x5e },
+	{ 0x30, 0xda, 0xb8, 0x09, 0xf8, 0x5a, 0x91, 0x7f, 0xe9, 0x24, 0x73, 0x3f, 0x42, 0x4a, 0xc5, 0x89 },
+	{ 0xea, 0xef, 0x5c, 0x1f, 0x8d, 0x60, 0x51, 0x92, 0x64, 0x66, 0x95, 0xce, 0xad, 0xc6, 0x5f, 0x32 },
+	{ 0xb8, 0xaa, 0x90, 0x04, 0x0b, 0x4c, 0x15, 0xa1, 0x23, 0x16, 0xb7, 0x8e, 0x0f, 0x95, 0x86, 0xfc },
+	{ 0x97, 0xfa, 0xc8, 0x29, 0x7c, 0xea, 0xab, 0xc8, 0x7d, 0x45, 0x43, 0x50, 0x60, 0x1e, 0x06, 0x73 },
+	{ 0x9b, 0x47, 0xef, 0x56, 0x7a, 0xc2, 0x8d, 0xfe, 0x48, 0x84, 0x92, 0xf1, 0x57, 0xe2, 0xb2, 0xe0 },
+	{ 0x1b, 0x84, 0x26, 0x02, 0x7d, 0xdb, 0x96, 0x2b, 0x5c, 0x5b, 0xa7, 0xeb, 0x8b, 0xc9, 0xab, 0x63 },
+	{ 0xe9, 0x17, 0xfc, 0x77, 0xe7, 0x19, 0x92, 0xa1, 0x2d, 0xbe, 0x4c, 0x18, 0x06, 0x8b, 0xec, 0x82 },
+	{ 0xdc, 0xee, 0xbb, 0xc9, 0x88, 0x40, 0xf8, 0xae, 0x6d, 0xaf, 0x76, 0x57, 0x3b, 0x7e, 0x56, 0xf4 },
+	{ 0x4e, 0x11, 0xa9, 0xf7, 0x42, 0x05, 0x12, 0x5b, 0x61, 0xe0, 0xae, 0xe0, 0x47, 0xec, 0xa2, 0x0d },
+	{ 0xf6, 0x04, 0x67, 0xf5, 0x5a, 0x1f, 0x17, 0xea, 0xb8, 0x8e, 0x80, 0x01, 0x20, 0xcb, 0xc2, 0x84 },
+	{ 0xd4, 0x36, 0x64, 0x9f, 0x60, 0x0b, 0x44, 0x9e, 0xe2, 0x76, 0x53, 0x0f, 0x0c, 0xd8, 0x3c, 0x11 },
+	{ 0x3b, 0xc0, 0xe3, 0x65, 0x6a, 0x9e, 0x3a, 0xc7, 0xcd, 0x37, 0x8a, 0x73, 0x7f, 0x53, 0xb6, 0x37 },
+	{ 0x6b, 0xac, 0xae, 0x63, 0xd3, 0x3b, 0x92, 0x8a, 0xa8, 0x38, 0x0f, 0x8d, 0x54, 0xd8, 0x8c, 0x17 },
+	{ 0x89, 0x35, 0xff, 0xbc, 0x75, 0xae, 0x62, 0x51, 0xbf, 0x8e, 0x85, 0x9f, 0x08, 0x5a, 0xdc, 0xb9 },
+	{ 0x93, 0xdc, 0x49, 0x70, 0xfe, 0x35, 0xf6, 0x77, 0x47, 0xcb, 0x05, 0x62, 0xc0, 0x6d, 0x87, 0x5a },
+	{ 0x14, 0xf9, 0xdf, 0x85, 0x89, 0x75, 0x85, 0x17, 0x97, 0xba, 0x60, 0x4f, 0xb0, 0xd1, 0x6c, 0xc7 },
+	{ 0x02, 0xea, 0x0c, 0x98, 0xdc, 0xa1, 0x0b, 0x38, 0xc2, 0x1b, 0x3b, 0x14, 0xe8, 0xd1, 0xb7, 0x1f },
+	{ 0x8f, 0x09, 0x1b, 0x1b, 0x5b, 0x07, 0x49, 0xb2, 0xad, 0xc8, 0x03, 0xe6, 0x3d, 0xda, 0x9b, 0x72 },
+	{ 0x05, 0xb3, 0x89, 0xe3, 0x32, 0x2c, 0x6d, 0xa0, 0x83, 0x84, 0x34, 0x5a, 0x41, 0x37, 0xfd, 0x08 },
+	{ 0x38, 0x13, 0x08, 0xc4, 0x38, 0xf3, 0x5b, 0x39, 0x9f, 0x10, 0xad, 0x71, 0xb0, 0x50, 0x27, 0xd8 },
+	{ 0x68, 0xc2, 0x30, 0xfc, 0xfa, 0x92, 0x79, 0xc3, 0x40, 0x9f, 0xc4, 0x23, 0xe2, 0xac, 0xbe, 0x04 },
+	{ 0x1c, 0x84, 0xa4, 0x75, 0xac, 0xb0, 0x11, 0xf3, 0xf5, 0x9f, 0x4f, 0x46, 0xb7, 0x62, 0x74, 0xc0 },
+	{ 0x45, 0x11, 0x9b, 0x68, 0xcb, 0x3f, 0x83, 0x99, 0xee, 0x60, 0x06, 0x6b, 0x56, 0x11, 0xa4, 0xd7 },
+	{ 0x94, 0x23, 0x76, 0x2f, 0x52, 0x7a, 0x40, 0x60, 0xff, 0xca, 0x31, 0x2d, 0xcc, 0xa2, 0x2a, 0x16 },
+	{ 0xf3, 0x61, 0xa2, 0x74, 0x5a, 0x33, 0xf0, 0x56, 0xa5, 0xac, 0x6a, 0xce, 0x2f, 0x08, 0xe3, 0x44 },
+	{ 0x5e, 0xf1, 0x45, 0x76, 0x6e, 0xca, 0x84, 0x9f, 0x5d, 0x01, 0x15, 0x36, 0xa6, 0x55, 0x7f, 0xdb },
+	{ 0xc9, 0xaf, 0x27, 0xb2, 0xc8, 0x9c, 0x9b, 0x4c, 0xf4, 0xa0, 0xc4, 0x10, 0x6a, 0xc8, 0x03, 0x18 },
+	{ 0xfb, 0x9c, 0x4f, 0x16, 0xc6, 0x21, 0xf4, 0xea, 0xb7, 0xe9, 0xac, 0x1d, 0x75, 0x51, 0xdd, 0x57 },
+	{ 0x13, 0x8e, 0x06, 0xfb, 0xa4, 0x66, 0xfa, 0x70, 0x85, 0x4d, 0x8c, 0x2e, 0x52, 0x4c, 0xff, 0xb2 },
+	{ 0xfb, 0x4b, 0xc7, 0x8b, 0x22, 0x50, 0x70, 0x77, 0x3f, 0x04, 0xc4, 0x04, 0x66, 0xd4, 0xe9, 0x0c },
+	{ 0x8b, 0x2c, 0xbf, 0xf1, 0xed, 0x01, 0x50, 0xfe, 0xda, 0x8a, 0x47, 0x99, 0xbe, 0x94, 0x55, 0x1f },
+	{ 0x08, 0xb3, 0x0d, 0x7b, 0x3f, 0x27, 0x96, 0x27, 0x09, 0xa3, 0x6b, 0xca, 0xdf, 0xb9, 0x74, 0xbd },
+	{ 0xfd, 0xf6, 0xd3, 0x2e, 0x04, 0x4d, 0x77, 0xad, 0xcf, 0x37, 0xfb, 0x97, 0xac, 0x21, 0x33, 0x26 },
+	{ 0x93, 0xcb, 0x28, 0x4e, 0xcd, 0xcf, 0xd7, 0x81, 0xa8, 0xaf, 0xe3, 0x20, 0x77, 0x94, 0x9e, 0x88 },
+	{ 0x7b, 0x01, 0x7b, 0xb0, 0x2e, 0xc8, 0x7b, 0x2b, 0x94, 0xc9, 0x6e, 0x40, 0xa2, 0x6f, 0xc7, 0x1a },
+	{ 0xc5, 0xc0, 0x38, 0xb6, 0x99, 0x06, 0x64, 0xab, 0x08, 0xa3, 0xaa, 0xa5, 0xdf, 0x9f, 0x32, 0x66 },
+	{ 0x4b, 0x70, 0x20, 0xbe, 0x37, 0xfa, 0xb6, 0x25, 0x9b, 0x2a, 0x27, 0xf4, 0xec, 0x55, 0x15, 0x76 },
+	{ 0x60, 0x13, 0x67, 0x03, 0x37, 0x4f, 0x64, 0xe8, 0x60, 0xb4, 0x8c, 0xe3, 0x1f, 0x93, 0x07, 0x16 },
+	{ 0x8d, 0x63, 0xa2, 0x69, 0xb1, 0x4d, 0x50, 0x6c, 0xcc, 0x40, 0x1a, 0xb8, 0xa9, 0xf1, 0xb5, 0x91 },
+	{ 0xd3, 0x17, 0xf8, 0x1d, 0xc6, 0xaa, 0x45, 0x4a, 0xee, 0x4b, 0xd4, 0xa5, 0xa5, 0xcf, 0xf4, 0xbd },
+	{ 0xdd, 0xde, 0xce, 0xcd, 0x53, 0x54, 0xf0, 0x4d, 0x53, 0x0d, 0x76, 0xed, 0x88, 0x42, 0x46, 0xeb },
+	{ 0x41, 0xc5, 0x20, 0x5c, 0xc8, 0xfd, 0x8e, 0xda, 0x9a, 0x3c, 0xff, 0xd2, 0x51, 0x8f, 0x36, 0x5a },
+	{ 0xcf, 0x42, 0xfb, 0x47, 0x42, 0x93, 0xd9, 0x6e, 0xca, 0x9d, 0xb1, 0xb3, 0x7b, 0x1b, 0xa6, 0x76 },
+	{ 0xa2, 0x31, 0x69, 0x26, 0x07, 0x16, 0x9b, 0x4e, 0xcd, 0xea, 0xd5, 0xcd, 0x3b, 0x10, 0xdb, 0x3e },
+	{ 0xac, 0xe4, 0xb9, 0x1c, 0x9c, 0x66, 0x9e, 0x77, 0xe7, 0xac, 0xac, 0xd1, 0x98, 0x59, 0xed, 0x49 },
+	{ 0x75, 0xdb, 0x7c, 0xfd, 0x4a, 0x7b, 0x2b, 0x62, 0xab, 0x78, 0xa4, 0x8f, 0x3d, 0xda, 0xf4, 0xaf },
+	{ 0xc1, 0xfa, 0xba, 0x2d, 0x46, 0xe2, 0x59, 0xcf, 0x48, 0x0d, 0x7c, 0x38, 0xe4, 0x57, 0x2a, 0x58 },
+	{ 0x24, 0x1c, 0x45, 0xbc, 0x6a, 0xe1, 0x6d, 0xee, 0x6e, 0xb7, 0xbe, 0xa1, 0x28, 0x70, 0x15, 0x82 },
+	{ 0x8f, 0xd0, 0x30, 0x57, 0xcf, 0x13, 0x64, 0x42, 0x0c, 0x2b, 0x78, 0x06, 0x9a, 0x3e, 0x25, 0x02 },
+	{ 0xdd, 0xb5, 0x05, 0xe6, 0xcc, 0x13, 0x84, 0xcb, 0xae, 0xc1, 0xdf, 0x90, 0xb8, 0x0b, 0xeb, 0x20 },
+	{ 0x56, 0x74, 0xa3, 0xbe, 0xd2, 0x7b, 0xf4, 0xbd, 0x36, 0x22, 0xf9, 0xf5, 0xfe, 0x20, 0x83, 0x06 },
+	{ 0xb6, 0x87, 0xf2, 0x6a, 0x89, 0xcf, 0xbf, 0xbb, 0x8e, 0x5e, 0xea, 0xc5, 0x40, 0x55, 0x31, 0x5e },
+	{ 0x05, 0x47, 0xdd, 0x32, 0xd3, 0xb2, 0x9a, 0xb6, 0xa4, 0xca, 0xeb, 0x60, 0x6c, 0x5b, 0x6f, 0x78 },
+	{ 0x18, 0x68, 0x61, 0xf8, 0xbc, 0x53, 0x86, 0xd3, 0x1f, 0xb7, 0x7f, 0x72, 0x0c, 0x32, 0x26, 0xe6 },
+	{ 0xea, 0xcf, 0x1e, 0x6c, 0x42, 0x24, 0xef, 0xb3, 0x89, 0x00, 0xb1, 0x85, 0xab, 0x1d, 0xfd, 0x42 },
+	{ 0xd2, 0x41, 0xaa, 0xb0, 0x5a, 0x42, 0xd3, 0x19, 0xde, 0x81, 0xd8, 0x74, 0xf5, 0xc7, 0xb9, 0x0d },
+	{ 0x5e, 0xb9, 0xbc, 0x75, 0x9e, 0x2a, 0xd8, 0xd2, 0x14, 0x0a, 0x6c, 0x76, 0x2a, 0xe9, 0xe1, 0xab },
+	{ 0x01, 0x85, 0x96, 0xe1, 0x5e, 0x78, 0xe2, 0xc0, 0x64, 0x15, 0x9d, 0xef, 0xce, 0x5f, 0x30, 0x85 },
+	{ 0xdd, 0x8a, 0x49, 0x35, 0x14, 0x23, 0x1c, 0xbf, 0x56, 0xec, 0xce, 0xe4, 0xc4, 0x08, 0x89, 0xfb },
+};
+const unsigned int ECBVarKey192_count = 2 * sizeof(ECBVarKey192) / sizeof(ECBVarKey192[0]);
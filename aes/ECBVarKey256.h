@@ -0,0 +1,312 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+#include "aes_kat.h"
+
+//Vector i of ECBVarKey256 uses a key with its first i + 1 bits set and an
+//all-zero plaintext, so only the ciphertexts are stored and aes.c builds
+//the key and plaintext from the vector number.  NIST lists every vector
+//under [ENCRYPT] and again under [DECRYPT]; the suite runs the table twice.
+const unsigned char ECBVarKey256[256][16] = {
+	{ 0xe3, 0x5a, 0x6d, 0xcb, 0x19, 0xb2, 0x01, 0xa0, 0x1e, 0xbc, 0xfa, 0x8a, 0xa2, 0x2b, 0x57, 0x59 },
+	{ 0xb2, 0x91, 0x69, 0xcd, 0xcf, 0x2d, 0x83, 0xe8, 0x38, 0x12, 0x5a, 0x12, 0xee, 0x6a, 0xa4, 0x00 },
+	{ 0xd8, 0xf3, 0xa7, 0x2f, 0xc3, 0xcd, 0xf7, 0x4d, 0xfa, 0xf6, 0xc3, 0xe6, 0xb9, 0x7b, 0x2f, 0xa6 },
+	{ 0x1c, 0x77, 0x76, 0x79, 0xd5, 0x00, 0x37, 0xc7, 0x94, 0x91, 0xa9, 0x4d, 0xa7, 0x6a, 0x9a, 0x35 },
+	{ 0x9c, 0xf4, 0x89, 0x3e, 0xca, 0xfa, 0x0a, 0x02, 0x47, 0xa8, 0x98, 0xe0, 0x40, 0x69, 0x15, 0x59 },
+	{ 0x8f, 0xbb, 0x41, 0x37, 0x03, 0x73, 0x53, 0x26, 0x31, 0x0a, 0x26, 0x9b, 0xd3, 0xaa, 0x94, 0xb2 },
+	{ 0x60, 0xe3, 0x22, 0x46, 0xbe, 0xd2, 0xb0, 0xe8, 0x59, 0xe5, 0x5c, 0x1c, 0xc6, 0xb2, 0x65, 0x02 },
+	{ 0xec, 0x52, 0xa2, 0x12, 0xf8, 0x0a, 0x09, 0xdf, 0x63, 0x17, 0x02, 0x1b, 0xc2, 0xa9, 0x81, 0x9e },
+	{ 0xf2, 0x3e, 0x5b, 0x60, 0x0e, 0xb7, 0x0d, 0xbc, 0xcf, 0x6c, 0x0b, 0x1d, 0x9a, 0x68, 0x18, 0x2c },
+	{ 0xa3, 0xf5, 0x99, 0xd6, 0x3a, 0x82, 0xa9, 0x68, 0xc3, 0x3f, 0xe2, 0x65, 0x90, 0x74, 0x59, 0x70 },
+	{ 0xd1, 0xcc, 0xb9, 0xb1, 0x33, 0x70, 0x02, 0xcb, 0xac, 0x42, 0xc5, 0x20, 0xb5, 0xd6, 0x77, 0x22 },
+	{ 0xcc, 0x11, 0x1f, 0x6c, 0x37, 0xcf, 0x40, 0xa1, 0x15, 0x9d, 0x00, 0xfb, 0x59, 0xfb, 0x04, 0x88 },
+	{ 0xdc, 0x43, 0xb5, 0x1a, 0xb6, 0x09, 0x05, 0x23, 0x72, 0x98, 0x9a, 0x26, 0xe9, 0xcd, 0xd7, 0x14 },
+	{ 0x4d, 0xce, 0xde, 0x8d, 0xa9, 0xe2, 0x57, 0x8f, 0x39, 0x70, 0x3d, 0x44, 0x33, 0xdc, 0x64, 0x59 },
+	{ 0x1a, 0x4c, 0x1c, 0x26, 0x3b, 0xbc, 0xcf, 0xaf, 0xc1, 0x17, 0x82, 0x89, 0x46, 0x85, 0xe3, 0xa8 },
+	{ 0x93, 0x7a, 0xd8, 0x48, 0x80, 0xdb, 0x50, 0x61, 0x34, 0x23, 0xd6, 0xd5, 0x27, 0xa2, 0x82, 0x3d },
+	{ 0x61, 0x0b, 0x71, 0xdf, 0xc6, 0x88, 0xe1, 0x50, 0xd8, 0x15, 0x2c, 0x5b, 0x35, 0xeb, 0xc1, 0x4d },
+	{ 0x27, 0xef, 0x24, 0x95, 0xda, 0xbf, 0x32, 0x38, 0x85, 0xaa, 0xb3, 0x9c, 0x80, 0xf1, 0x8d, 0x8b },
+	{ 0x63, 0x3c, 0xaf, 0xea, 0x39, 0x5b, 0xc0, 0x3a, 0xda, 0xe3, 0xa1, 0xe2, 0x06, 0x8e, 0x4b, 0x4e },
+	{ 0x6e, 0x1b, 0x48, 0x2b, 0x53, 0x76, 0x1c, 0xf6, 0x31, 0x81, 0x9b, 0x74, 0x9a, 0x6f, 0x37, 0x24 },
+	{ 0x97, 0x6e, 0x6f, 0x85, 0x1a, 0xb5, 0x2c, 0x77, 0x19, 0x98, 0xdb, 0xb2, 0xd7, 0x1c, 0x75, 0xa9 },
+	{ 0x85, 0xf2, 0xba, 0x84, 0xf8, 0xc3, 0x07, 0xcf, 0x52, 0x5e, 0x12, 0x4c, 0x3e, 0x22, 0xe6, 0xcc },
+	{ 0x6b, 0xcc, 0xa9, 0x8b, 0xf6, 0xa8, 0x35, 0xfa, 0x64, 0x95, 0x5f, 0x72, 0xde, 0x41, 0x15, 0xfe },
+	{ 0x2c, 0x75, 0xe2, 0xd3, 0x6e, 0xeb, 0xd6, 0x54, 0x11, 0xf1, 0x4f, 0xd0, 0xeb, 0x1d, 0x2a, 0x06 },
+	{ 0xbd, 0x49, 0x29, 0x50, 0x06, 0x25, 0x0f, 0xfc, 0xa5, 0x10, 0x0b, 0x60, 0x07, 0xa0, 0xea, 0xde },
+	{ 0xa1, 0x90, 0x52, 0x7d, 0x0e, 0xf7, 0xc7, 0x0f, 0x45, 0x9c, 0xd3, 0x94, 0x0d, 0xf3, 0x16, 0xec },
+	{ 0xbb, 0xd1, 0x09, 0x7a, 0x62, 0x43, 0x3f, 0x79, 0x44, 0x9f, 0xa9, 0x7d, 0x4e, 0xe8, 0x0d, 0xbf },
+	{ 0x07, 0x05, 0x8e, 0x40, 0x8f, 0x5b, 0x99, 0xb0, 0xe0, 0xf0, 0x61, 0xa1, 0x76, 0x1b, 0x5b, 0x3b },
+	{ 0x5f, 0xd1, 0xf1, 0x3f, 0xa0, 0xf3, 0x1e, 0x37, 0xfa, 0xbd, 0xe3, 0x28, 0xf8, 0x94, 0xea, 0xc2 },
+	{ 0xfc, 0x4a, 0xf7, 0xc9, 0x48, 0xdf, 0x26, 0xe2, 0xef, 0x3e, 0x01, 0xc1, 0xee, 0x5b, 0x8f, 0x6f },
+	{ 0x82, 0x9f, 0xd7, 0x20, 0x8f, 0xb9, 0x2d, 0x44, 0xa0, 0x74, 0xa6, 0x77, 0xee, 0x98, 0x61, 0xac },
+	{ 0xad, 0x9f, 0xc6, 0x13, 0xa7, 0x03, 0x25, 0x1b, 0x54, 0xc6, 0x4a, 0x0e, 0x76, 0x43, 0x17, 0x11 },
+	{ 0x33, 0xac, 0x9e, 0xcc, 0xc4, 0xcc, 0x75, 0xe2, 0x71, 0x16, 0x18, 0xf8, 0x0b, 0x15, 0x48, 0xe8 },
+	{ 0x20, 0x25, 0xc7, 0x4b, 0x8a, 0xd8, 0xf4, 0xcd, 0xa1, 0x7e, 0xe2, 0x04, 0x9c, 0x4c, 0x90, 0x2d },
+	{ 0xf8, 0x5c, 0xa0, 0x5f, 0xe5, 0x28, 0xf1, 0xce, 0x9b, 0x79, 0x01, 0x66, 0xe8, 0xd5, 0x51, 0xe7 },
+	{ 0x6f, 0x62, 0x38, 0xd8, 0x96, 0x60, 0x48, 0xd4, 0x96, 0x71, 0x54, 0xe0, 0xda, 0xd5, 0xa6, 0xc9 },
+	{ 0xf2, 0xb2, 0x1b, 0x4e, 0x76, 0x40, 0xa9, 0xb3, 0x34, 0x6d, 0xe8, 0xb8, 0x2f, 0xb4, 0x1e, 0x49 },
+	{ 0xf8, 0x36, 0xf2, 0x51, 0xad, 0x1d, 0x11, 0xd4, 0x9d, 0xc3, 0x44, 0x62, 0x8b, 0x18, 0x84, 0xe1 },
+	{ 0x07, 0x7e, 0x94, 0x70, 0xae, 0x7a, 0xbe, 0xa5, 0xa9, 0x76, 0x9d, 0x49, 0x18, 0x26, 0x28, 0xc3 },
+	{ 0xe0, 0xdc, 0xc2, 0xd2, 0x7f, 0xc9, 0x86, 0x56, 0x33, 0xf8, 0x52, 0x23, 0xcf, 0x0d, 0x61, 0x1f },
+	{ 0xbe, 0x66, 0xcf, 0xea, 0x2f, 0xec, 0xd6, 0xbf, 0x0e, 0xc7, 0xb4, 0x35, 0x2c, 0x99, 0xbc, 0xaa },
+	{ 0xdf, 0x31, 0x14, 0x4f, 0x87, 0xa2, 0xef, 0x52, 0x3f, 0xac, 0xdc, 0xf2, 0x1a, 0x42, 0x78, 0x04 },
+	{ 0xb5, 0xbb, 0x0f, 0x56, 0x29, 0xfb, 0x6a, 0xae, 0x5e, 0x18, 0x39, 0xa3, 0xc3, 0x62, 0x5d, 0x63 },
+	{ 0x3c, 0x9d, 0xb3, 0x33, 0x53, 0x06, 0xfe, 0x1e, 0xc6, 0x12, 0xbd, 0xbf, 0xae, 0x6b, 0x60, 0x28 },
+	{ 0x3d, 0xd5, 0xc3, 0x46, 0x34, 0xa7, 0x9d, 0x3c, 0xfc, 0xc8, 0x33, 0x97, 0x60, 0xe6, 0xf5, 0xf4 },
+	{ 0x82, 0xbd, 0xa1, 0x18, 0xa3, 0xed, 0x7a, 0xf3, 0x14, 0xfa, 0x2c, 0xcc, 0x5c, 0x07, 0xb7, 0x61 },
+	{ 0x29, 0x37, 0xa6, 0x4f, 0x7d, 0x4f, 0x46, 0xfe, 0x6f, 0xea, 0x3b, 0x34, 0x9e, 0xc7, 0x8e, 0x38 },
+	{ 0x22, 0x5f, 0x06, 0x8c, 0x28, 0x47, 0x66, 0x05, 0x73, 0x5a, 0xd6, 0x71, 0xbb, 0x8f, 0x39, 0xf3 },
+	{ 0xae, 0x68, 0x2c, 0x5e, 0xcd, 0x71, 0x89, 0x8e, 0x08, 0x94, 0x2a, 0xc9, 0xaa, 0x89, 0x87, 0x5c },
+	{ 0x5e, 0x03, 0x1c, 0xb9, 0xd6, 0x76, 0xc3, 0x02, 0x2d, 0x7f, 0x26, 0x22, 0x7e, 0x85, 0xc3, 0x8f },
+	{ 0xa7, 0x84, 0x63, 0xfb, 0x06, 0x4d, 0xb5, 0xd5, 0x2b, 0xb6, 0x4b, 0xfe, 0xf6, 0x4f, 0x2d, 0xda },
+	{ 0x8a, 0xa9, 0xb7, 0x5e, 0x78, 0x45, 0x93, 0x87, 0x6c, 0x53, 0xa0, 0x0e, 0xae, 0x5a, 0xf5, 0x2b },
+	{ 0x3f, 0x84, 0x56, 0x6d, 0xf2, 0x3d, 0xa4, 0x8a, 0xf6, 0x92, 0x72, 0x2f, 0xe9, 0x80, 0x57, 0x3a },
+	{ 0x31, 0x69, 0x0b, 0x5e, 0xd4, 0x1c, 0x7e, 0xb4, 0x2a, 0x1e, 0x83, 0x27, 0x0a, 0x7f, 0xf0, 0xe6 },
+	{ 0x77, 0xdd, 0x77, 0x02, 0x64, 0x6d, 0x55, 0xf0, 0x83, 0x65, 0xe4, 0x77, 0xd3, 0x59, 0x0e, 0xda },
+	{ 0x4c, 0x02, 0x2a, 0xc6, 0x2b, 0x3c, 0xb7, 0x8d, 0x73, 0x9c, 0xc6, 0x7b, 0x3e, 0x20, 0xbb, 0x7e },
+	{ 0x09, 0x2f, 0xa1, 0x37, 0xce, 0x18, 0xb5, 0xdf, 0xe7, 0x90, 0x6f, 0x55, 0x0b, 0xb1, 0x33, 0x70 },
+	{ 0x3e, 0x0c, 0xda, 0xdf, 0x2e, 0x68, 0x35, 0x3c, 0x00, 0x27, 0x67, 0x2c, 0x97, 0x14, 0x4d, 0xd3 },
+	{ 0xd8, 0xc4, 0xb2, 0x00, 0xb3, 0x83, 0xfc, 0x1f, 0x2b, 0x2e, 0xa6, 0x77, 0x61, 0x8a, 0x1d, 0x27 },
+	{ 0x11, 0x82, 0x5f, 0x99, 0xb0, 0xe9, 0xbb, 0x34, 0x77, 0xc1, 0xc0, 0x71, 0x3b, 0x01, 0x5a, 0xac },
+	{ 0xf8, 0xb9, 0xff, 0xfb, 0x5c, 0x18, 0x7f, 0x7d, 0xdc, 0x7a, 0xb1, 0x0f, 0x4f, 0xb7, 0x75, 0x76 },
+	{ 0xff, 0xb4, 0xe8, 0x7a, 0x32, 0xb3, 0x7d, 0x6f, 0x2c, 0x83, 0x28, 0xd3, 0xb5, 0x37, 0x78, 0x02 },
+	{ 0xd2, 0x76, 0xc1, 0x3a, 0x5d, 0x22, 0x0f, 0x4d, 0xa9, 0x22, 0x4e, 0x74, 0x89, 0x63, 0x91, 0xce },
+	{ 0x94, 0xef, 0xe7, 0xa0, 0xe2, 0xe0, 0x31, 0xe2, 0x53, 0x6d, 0xa0, 0x1d, 0xf7, 0x99, 0xc9, 0x27 },
+	{ 0x8f, 0x8f, 0xd8, 0x22, 0x68, 0x0a, 0x85, 0x97, 0x4e, 0x53, 0xa5, 0xa8, 0xeb, 0x9d, 0x38, 0xde },
+	{ 0xe0, 0xf0, 0xa9, 0x1b, 0x2e, 0x45, 0xf8, 0xcc, 0x37, 0xb7, 0x80, 0x5a, 0x30, 0x42, 0x58, 0x8d },
+	{ 0x59, 0x7a, 0x62, 0x52, 0x25, 0x5e, 0x46, 0xd6, 0x36, 0x4d, 0xbe, 0xed, 0xa3, 0x1e, 0x27, 0x9c },
+	{ 0xf5, 0x1a, 0x0f, 0x69, 0x44, 0x42, 0xb8, 0xf0, 0x55, 0x71, 0x79, 0x7f, 0xec, 0x7e, 0xe8, 0xbf },
+	{ 0x9f, 0xf0, 0x71, 0xb1, 0x65, 0xb5, 0x19, 0x8a, 0x93, 0xdd, 0xde, 0xeb, 0xc5, 0x4d, 0x09, 0xb5 },
+	{ 0xc2, 0x0a, 0x19, 0xfd, 0x57, 0x58, 0xb0, 0xc4, 0xbc, 0x1a, 0x5d, 0xf8, 0x9c, 0xf7, 0x38, 0x77 },
+	{ 0x97, 0x12, 0x01, 0x66, 0x30, 0x71, 0x19, 0xca, 0x22, 0x80, 0xe9, 0x31, 0x56, 0x68, 0xe9, 0x6f },
+	{ 0x4b, 0x3b, 0x9f, 0x1e, 0x09, 0x9c, 0x2a, 0x09, 0xdc, 0x09, 0x1e, 0x90, 0xe4, 0xf1, 0x8f, 0x0a },
+	{ 0xeb, 0x04, 0x0b, 0x89, 0x1d, 0x4b, 0x37, 0xf6, 0x85, 0x1f, 0x7e, 0xc2, 0x19, 0xcd, 0x3f, 0x6d },
+	{ 0x9f, 0x0f, 0xde, 0xc0, 0x8b, 0x7f, 0xd7, 0x9a, 0xa3, 0x95, 0x35, 0xbe, 0xa4, 0x2d, 0xb9, 0x2a },
+	{ 0x2e, 0x70, 0xf1, 0x68, 0xfc, 0x74, 0xbf, 0x91, 0x1d, 0xf2, 0x40, 0xbc, 0xd2, 0xce, 0xf2, 0x36 },
+	{ 0x46, 0x2c, 0xcd, 0x7f, 0x5f, 0xd1, 0x10, 0x8d, 0xbc, 0x15, 0x2f, 0x3c, 0xac, 0xad, 0x32, 0x8b },
+	{ 0xa4, 0xaf, 0x53, 0x4a, 0x7d, 0x0b, 0x64, 0x3a, 0x01, 0x86, 0x87, 0x85, 0xd8, 0x6d, 0xfb, 0x95 },
+	{ 0xab, 0x98, 0x02, 0x96, 0x19, 0x7e, 0x1a, 0x50, 0x22, 0x32, 0x6c, 0x31, 0xda, 0x4b, 0xf6, 0xf3 },
+	{ 0xf9, 0x7d, 0x57, 0xb3, 0x33, 0x3b, 0x62, 0x81, 0xb0, 0x7d, 0x48, 0x6d, 0xb2, 0xd4, 0xe2, 0x0c },
+	{ 0xf3, 0x3f, 0xa3, 0x67, 0x20, 0x23, 0x1a, 0xfe, 0x4c, 0x75, 0x9a, 0xde, 0x6b, 0xd6, 0x2e, 0xb6 },
+	{ 0xfd, 0xcf, 0xac, 0x0c, 0x02, 0xca, 0x53, 0x83, 0x43, 0xc6, 0x81, 0x17, 0xe0, 0xa1, 0x59, 0x38 },
+	{ 0xad, 0x49, 0x16, 0xf5, 0xee, 0x57, 0x72, 0xbe, 0x76, 0x4f, 0xc0, 0x27, 0xb8, 0xa6, 0xe5, 0x39 },
+	{ 0x2e, 0x16, 0x87, 0x3e, 0x16, 0x78, 0x61, 0x0d, 0x7e, 0x14, 0xc0, 0x2d, 0x00, 0x2e, 0xa8, 0x45 },
+	{ 0x4e, 0x6e, 0x62, 0x7c, 0x1a, 0xcc, 0x51, 0x34, 0x00, 0x53, 0xa8, 0x23, 0x6d, 0x57, 0x95, 0x76 },
+	{ 0xab, 0x0c, 0x84, 0x10, 0xae, 0xee, 0xad, 0x92, 0xfe, 0xec, 0x1e, 0xb4, 0x30, 0xd6, 0x52, 0xcb },
+	{ 0xe8, 0x6f, 0x7e, 0x23, 0xe8, 0x35, 0xe1, 0x14, 0x97, 0x7f, 0x60, 0xe1, 0xa5, 0x92, 0x20, 0x2e },
+	{ 0xe6, 0x8a, 0xd5, 0x05, 0x5a, 0x36, 0x70, 0x41, 0xfa, 0xde, 0x09, 0xd9, 0xa7, 0x0a, 0x79, 0x4b },
+	{ 0x07, 0x91, 0x82, 0x3a, 0x3c, 0x66, 0x6b, 0xb6, 0x16, 0x28, 0x25, 0xe7, 0x86, 0x06, 0xa7, 0xfe },
+	{ 0xdc, 0xca, 0x36, 0x6a, 0x9b, 0xf4, 0x7b, 0x7b, 0x86, 0x8b, 0x77, 0xe2, 0x5c, 0x18, 0xa3, 0x64 },
+	{ 0x68, 0x4c, 0x9e, 0xfc, 0x23, 0x7e, 0x4a, 0x44, 0x29, 0x65, 0xf8, 0x4b, 0xce, 0x20, 0x24, 0x7a },
+	{ 0xa8, 0x58, 0x41, 0x1f, 0xfb, 0xe6, 0x3f, 0xdb, 0x9c, 0x8a, 0xa1, 0xbf, 0xae, 0xd6, 0x7b, 0x52 },
+	{ 0x04, 0xbc, 0x3d, 0xa2, 0x17, 0x9c, 0x30, 0x15, 0x49, 0x8b, 0x0e, 0x03, 0x91, 0x0d, 0xb5, 0xb8 },
+	{ 0x40, 0x07, 0x1e, 0xea, 0xb3, 0xf9, 0x35, 0xdb, 0xc2, 0x5d, 0x00, 0x84, 0x14, 0x60, 0x26, 0x0f },
+	{ 0x0e, 0xbd, 0x7c, 0x30, 0xed, 0x20, 0x16, 0xe0, 0x8b, 0xa8, 0x06, 0xdd, 0xb0, 0x08, 0xbc, 0xc8 },
+	{ 0x15, 0xc6, 0xbe, 0xcf, 0x0f, 0x4c, 0xec, 0x71, 0x29, 0xcb, 0xd2, 0x2d, 0x1a, 0x79, 0xb1, 0xb8 },
+	{ 0x0a, 0xee, 0xde, 0x5b, 0x91, 0xf7, 0x21, 0x70, 0x0e, 0x9e, 0x62, 0xed, 0xbf, 0x60, 0xb7, 0x81 },
+	{ 0x26, 0x65, 0x81, 0xaf, 0x0d, 0xcf, 0xbe, 0xd1, 0x58, 0x5e, 0x0a, 0x24, 0x2c, 0x64, 0xb8, 0xdf },
+	{ 0x66, 0x93, 0xdc, 0x91, 0x16, 0x62, 0xae, 0x47, 0x32, 0x16, 0xba, 0x22, 0x18, 0x9a, 0x51, 0x1a },
+	{ 0x76, 0x06, 0xfa, 0x36, 0xd8, 0x64, 0x73, 0xe6, 0xfb, 0x3a, 0x1b, 0xb0, 0xe2, 0xc0, 0xad, 0xf5 },
+	{ 0x11, 0x20, 0x78, 0xe9, 0xe1, 0x1f, 0xbb, 0x78, 0xe2, 0x6f, 0xfb, 0x88, 0x99, 0xe9, 0x6b, 0x9a },
+	{ 0x40, 0xb2, 0x64, 0xe9, 0x21, 0xe9, 0xe4, 0xa8, 0x26, 0x94, 0x58, 0x9e, 0xf3, 0x79, 0x82, 0x62 },
+	{ 0x8d, 0x45, 0x95, 0xcb, 0x4f, 0xa7, 0x02, 0x67, 0x15, 0xf5, 0x5b, 0xd6, 0x8e, 0x28, 0x82, 0xf9 },
+	{ 0xb5, 0x88, 0xa3, 0x02, 0xbd, 0xbc, 0x09, 0x19, 0x7d, 0xf1, 0xed, 0xae, 0x68, 0x92, 0x6e, 0xd9 },
+	{ 0x33, 0xf7, 0x50, 0x23, 0x90, 0xb8, 0xa4, 0xa2, 0x21, 0xcf, 0xec, 0xd0, 0x66, 0x66, 0x24, 0xba },
+	{ 0x3d, 0x20, 0x25, 0x3a, 0xdb, 0xce, 0x3b, 0xe2, 0x37, 0x37, 0x67, 0xc4, 0xd8, 0x22, 0xc5, 0x66 },
+	{ 0xa4, 0x27, 0x34, 0xa3, 0x92, 0x9b, 0xf8, 0x4c, 0xf0, 0x11, 0x6c, 0x98, 0x56, 0xa3, 0xc1, 0x8c },
+	{ 0xe3, 0xab, 0xc4, 0x93, 0x94, 0x57, 0x42, 0x2b, 0xb9, 0x57, 0xda, 0x3c, 0x56, 0x93, 0x8c, 0x6d },
+	{ 0x97, 0x2b, 0xdd, 0x2e, 0x7c, 0x52, 0x51, 0x30, 0xfa, 0xdc, 0x8f, 0x76, 0xfc, 0x6f, 0x4b, 0x3f },
+	{ 0x84, 0xa8, 0x3d, 0x7b, 0x94, 0xc6, 0x99, 0xcb, 0xcb, 0x8a, 0x7d, 0x9b, 0x61, 0xf6, 0x40, 0x93 },
+	{ 0xce, 0x61, 0xd6, 0x35, 0x14, 0xad, 0xed, 0x03, 0xd4, 0x3e, 0x6e, 0xbf, 0xc3, 0xa9, 0x00, 0x1f },
+	{ 0x6c, 0x83, 0x9d, 0xd5, 0x8e, 0xea, 0xe6, 0xb8, 0xa3, 0x6a, 0xf4, 0x8e, 0xd6, 0x3d, 0x2d, 0xc9 },
+	{ 0xcd, 0x5e, 0xce, 0x55, 0xb8, 0xda, 0x3b, 0xf6, 0x22, 0xc4, 0x10, 0x0d, 0xf5, 0xde, 0x46, 0xf9 },
+	{ 0x3b, 0x6f, 0x46, 0xf4, 0x0e, 0x0a, 0xc5, 0xfc, 0x0a, 0x9c, 0x11, 0x05, 0xf8, 0x00, 0xf4, 0x8d },
+	{ 0xba, 0x26, 0xd4, 0x7d, 0xa3, 0xae, 0xb0, 0x28, 0xde, 0x4f, 0xb5, 0xb3, 0xa8, 0x54, 0xa2, 0x4b },
+	{ 0x87, 0xf5, 0x3b, 0xf6, 0x20, 0xd3, 0x67, 0x72, 0x68, 0x44, 0x52, 0x12, 0x90, 0x43, 0x89, 0xd5 },
+	{ 0x10, 0x61, 0x7d, 0x28, 0xb5, 0xe0, 0xf4, 0x60, 0x54, 0x92, 0xb1, 0x82, 0xa5, 0xd7, 0xf9, 0xf6 },
+	{ 0x9a, 0xae, 0xc4, 0xfa, 0xbb, 0xf6, 0xfa, 0xe2, 0xa7, 0x1f, 0xef, 0xf0, 0x2e, 0x37, 0x2b, 0x39 },
+	{ 0x3a, 0x90, 0xc6, 0x2d, 0x88, 0xb5, 0xc4, 0x28, 0x09, 0xab, 0xf7, 0x82, 0x48, 0x8e, 0xd1, 0x30 },
+	{ 0xf1, 0xf1, 0xc5, 0xa4, 0x08, 0x99, 0xe1, 0x57, 0x72, 0x85, 0x7c, 0xcb, 0x65, 0xc7, 0xa0, 0x9a },
+	{ 0x19, 0x08, 0x43, 0xd2, 0x9b, 0x25, 0xa3, 0x89, 0x7c, 0x69, 0x2c, 0xe1, 0xdd, 0x81, 0xee, 0x52 },
+	{ 0xa8, 0x66, 0xbc, 0x65, 0xb6, 0x94, 0x1d, 0x86, 0xe8, 0x42, 0x0a, 0x7f, 0xfb, 0x09, 0x64, 0xdb },
+	{ 0x81, 0x93, 0xc6, 0xff, 0x85, 0x22, 0x5c, 0xed, 0x42, 0x55, 0xe9, 0x2f, 0x6e, 0x07, 0x8a, 0x14 },
+	{ 0x96, 0x61, 0xcb, 0x24, 0x24, 0xd7, 0xd4, 0xa3, 0x80, 0xd5, 0x47, 0xf9, 0xe7, 0xec, 0x1c, 0xb9 },
+	{ 0x86, 0xf9, 0x3d, 0x9e, 0xc0, 0x84, 0x53, 0xa0, 0x71, 0xe2, 0xe2, 0x87, 0x78, 0x77, 0xa9, 0xc8 },
+	{ 0x27, 0xee, 0xfa, 0x80, 0xce, 0x6a, 0x4a, 0x9d, 0x59, 0x8e, 0x3f, 0xec, 0x36, 0x54, 0x34, 0xd2 },
+	{ 0xd6, 0x20, 0x68, 0x44, 0x45, 0x78, 0xe3, 0xab, 0x39, 0xce, 0x7e, 0xc9, 0x5d, 0xd0, 0x45, 0xdc },
+	{ 0xb5, 0xf7, 0x1d, 0x4d, 0xd9, 0xa7, 0x1f, 0xe5, 0xd8, 0xbc, 0x8b, 0xa7, 0xe6, 0xea, 0x30, 0x48 },
+	{ 0x68, 0x25, 0xa3, 0x47, 0xac, 0x47, 0x9d, 0x4f, 0x9d, 0x95, 0xc5, 0xcb, 0x8d, 0x3f, 0xd7, 0xe9 },
+	{ 0xe3, 0x71, 0x4e, 0x94, 0xa5, 0x77, 0x89, 0x55, 0xcc, 0x03, 0x46, 0x35, 0x8e, 0x94, 0x78, 0x3a },
+	{ 0xd8, 0x36, 0xb4, 0x4b, 0xb2, 0x9e, 0x0c, 0x7d, 0x89, 0xfa, 0x4b, 0x2d, 0x4b, 0x67, 0x7d, 0x2a },
+	{ 0x5d, 0x45, 0x4b, 0x75, 0x02, 0x1d, 0x76, 0xd4, 0xb8, 0x4f, 0x87, 0x3a, 0x8f, 0x87, 0x7b, 0x92 },
+	{ 0xc3, 0x49, 0x8f, 0x7e, 0xce, 0xd2, 0x09, 0x53, 0x14, 0xfc, 0x28, 0x11, 0x58, 0x85, 0xb3, 0x3f },
+	{ 0x6e, 0x66, 0x88, 0x56, 0x53, 0x9a, 0xd8, 0xe4, 0x05, 0xbd, 0x12, 0x3f, 0xe6, 0xc8, 0x85, 0x30 },
+	{ 0x86, 0x80, 0xdb, 0x7f, 0x3a, 0x87, 0xb8, 0x60, 0x55, 0x43, 0xcf, 0xdb, 0xe6, 0x75, 0x40, 0x76 },
+	{ 0x6c, 0x5d, 0x03, 0xb1, 0x30, 0x69, 0xc3, 0x65, 0x8b, 0x31, 0x79, 0xbe, 0x91, 0xb0, 0x80, 0x0c },
+	{ 0xef, 0x1b, 0x38, 0x4a, 0xc4, 0xd9, 0x3e, 0xda, 0x00, 0xc9, 0x2a, 0xdd, 0x09, 0x95, 0xea, 0x5f },
+	{ 0xbf, 0x81, 0x15, 0x80, 0x54, 0x71, 0x74, 0x1b, 0xd5, 0xad, 0x20, 0xa0, 0x39, 0x44, 0x79, 0x0f },
+	{ 0xc6, 0x4c, 0x24, 0xb6, 0x89, 0x4b, 0x03, 0x8b, 0x3c, 0x0d, 0x09, 0xb1, 0xdf, 0x06, 0x8b, 0x0b },
+	{ 0x39, 0x67, 0xa1, 0x0c, 0xff, 0xe2, 0x7d, 0x01, 0x78, 0x54, 0x5f, 0xbf, 0x6a, 0x40, 0x54, 0x4b },
+	{ 0x7c, 0x85, 0xe9, 0xc9, 0x5d, 0xe1, 0xa9, 0xec, 0x5a, 0x53, 0x63, 0xa8, 0xa0, 0x53, 0x47, 0x2d },
+	{ 0xa9, 0xee, 0xc0, 0x3c, 0x8a, 0xbe, 0xc7, 0xba, 0x68, 0x31, 0x5c, 0x2c, 0x8c, 0x23, 0x16, 0xe0 },
+	{ 0xca, 0xc8, 0xe4, 0x14, 0xc2, 0xf3, 0x88, 0x22, 0x7a, 0xe1, 0x49, 0x86, 0xfc, 0x98, 0x35, 0x24 },
+	{ 0x5d, 0x94, 0x2b, 0x7f, 0x46, 0x22, 0xce, 0x05, 0x6c, 0x3c, 0xe3, 0xce, 0x5f, 0x1d, 0xd9, 0xd6 },
+	{ 0xd2, 0x40, 0xd6, 0x48, 0xce, 0x21, 0xa3, 0x02, 0x02, 0x82, 0xc3, 0xf1, 0xb5, 0x28, 0xa0, 0xb6 },
+	{ 0x45, 0xd0, 0x89, 0xc3, 0x6d, 0x5c, 0x5a, 0x4e, 0xfc, 0x68, 0x9e, 0x3b, 0x0d, 0xe1, 0x0d, 0xd5 },
+	{ 0xb4, 0xda, 0x5d, 0xf4, 0xbe, 0xcb, 0x54, 0x62, 0xe0, 0x3a, 0x0e, 0xd0, 0x0d, 0x29, 0x56, 0x29 },
+	{ 0xdc, 0xf4, 0xe1, 0x29, 0x13, 0x6c, 0x1a, 0x4b, 0x7a, 0x0f, 0x38, 0x93, 0x5c, 0xc3, 0x4b, 0x2b },
+	{ 0xd9, 0xa4, 0xc7, 0x61, 0x8b, 0x0c, 0xe4, 0x8a, 0x3d, 0x5a, 0xee, 0x1a, 0x1c, 0x01, 0x14, 0xc4 },
+	{ 0xca, 0x35, 0x2d, 0xf0, 0x25, 0xc6, 0x5c, 0x7b, 0x0b, 0xf3, 0x06, 0xfb, 0xee, 0x0f, 0x36, 0xba },
+	{ 0x23, 0x8a, 0xca, 0x23, 0xfd, 0x34, 0x09, 0xf3, 0x8a, 0xf6, 0x33, 0x78, 0xed, 0x2f, 0x54, 0x73 },
+	{ 0x59, 0x83, 0x6a, 0x0e, 0x06, 0xa7, 0x96, 0x91, 0xb3, 0x66, 0x67, 0xd5, 0x38, 0x0d, 0x81, 0x88 },
+	{ 0x33, 0x90, 0x50, 0x80, 0xf7, 0xac, 0xf1, 0xcd, 0xae, 0x0a, 0x91, 0xfc, 0x3e, 0x85, 0xae, 0xe4 },
+	{ 0x72, 0xc9, 0xe4, 0x64, 0x6d, 0xbc, 0x3d, 0x63, 0x20, 0xfc, 0x66, 0x89, 0xd9, 0x3e, 0x88, 0x33 },
+	{ 0xba, 0x77, 0x41, 0x3d, 0xea, 0x59, 0x25, 0xb7, 0xf5, 0x41, 0x7e, 0xa4, 0x7f, 0xf1, 0x9f, 0x59 },
+	{ 0x6c, 0xae, 0x81, 0x29, 0xf8, 0x43, 0xd8, 0x6d, 0xc7, 0x86, 0xa0, 0xfb, 0x1a, 0x18, 0x49, 0x70 },
+	{ 0xfc, 0xfe, 0xfb, 0x53, 0x41, 0x00, 0x79, 0x6e, 0xeb, 0xbd, 0x99, 0x02, 0x06, 0x75, 0x4e, 0x19 },
+	{ 0x8c, 0x79, 0x1d, 0x5f, 0xdd, 0xdf, 0x47, 0x0d, 0xa0, 0x4f, 0x3e, 0x6d, 0xc4, 0xa5, 0xb5, 0xb5 },
+	{ 0xc9, 0x3b, 0xbd, 0xc0, 0x7a, 0x46, 0x11, 0xae, 0x4b, 0xb2, 0x66, 0xea, 0x50, 0x34, 0xa3, 0x87 },
+	{ 0xc1, 0x02, 0xe3, 0x8e, 0x48, 0x9a, 0xa7, 0x47, 0x62, 0xf3, 0xef, 0xc5, 0xbb, 0x23, 0x20, 0x5a },
+	{ 0x93, 0x20, 0x14, 0x81, 0x66, 0x5c, 0xba, 0xfc, 0x1f, 0xcc, 0x22, 0x0b, 0xc5, 0x45, 0xfb, 0x3d },
+	{ 0x49, 0x60, 0x75, 0x7e, 0xc6, 0xce, 0x68, 0xcf, 0x19, 0x5e, 0x45, 0x4c, 0xfd, 0x0f, 0x32, 0xca },
+	{ 0xfe, 0xec, 0x7c, 0xe6, 0xa6, 0xcb, 0xd0, 0x7c, 0x04, 0x34, 0x16, 0x73, 0x7f, 0x1b, 0xbb, 0x33 },
+	{ 0x11, 0xc5, 0x41, 0x39, 0x04, 0x48, 0x7a, 0x80, 0x5d, 0x70, 0xa8, 0xed, 0xd9, 0xc3, 0x55, 0x27 },
+	{ 0x34, 0x78, 0x46, 0xb2, 0xb2, 0xe3, 0x6f, 0x1f, 0x03, 0x24, 0xc8, 0x6f, 0x7f, 0x1b, 0x98, 0xe2 },
+	{ 0x33, 0x2e, 0xee, 0x1a, 0x0c, 0xbd, 0x19, 0xca, 0x2d, 0x69, 0xb4, 0x26, 0x89, 0x40, 0x44, 0xf0 },
+	{ 0x86, 0x6b, 0x5b, 0x39, 0x77, 0xba, 0x6e, 0xfa, 0x51, 0x28, 0xef, 0xbd, 0xa9, 0xff, 0x03, 0xcd },
+	{ 0xcc, 0x14, 0x45, 0xee, 0x94, 0xc0, 0xf0, 0x8c, 0xde, 0xe5, 0xc3, 0x44, 0xec, 0xd1, 0xe2, 0x33 },
+	{ 0xbe, 0x28, 0x83, 0x19, 0x02, 0x93, 0x63, 0xc2, 0x62, 0x2f, 0xeb, 0xa4, 0xb0, 0x5d, 0xfd, 0xfe },
+	{ 0xcf, 0xd1, 0x87, 0x55, 0x23, 0xf3, 0xcd, 0x21, 0xc3, 0x95, 0x65, 0x1e, 0x6e, 0xe1, 0x5e, 0x56 },
+	{ 0xcb, 0x5a, 0x40, 0x86, 0x57, 0x83, 0x7c, 0x53, 0xbf, 0x16, 0xf9, 0xd8, 0x46, 0x5d, 0xce, 0x19 },
+	{ 0xca, 0x0b, 0xf4, 0x2c, 0xb1, 0x07, 0xf5, 0x5c, 0xcf, 0xf2, 0xfc, 0x09, 0xee, 0x08, 0xca, 0x15 },
+	{ 0xfd, 0xd9, 0xbb, 0xb4, 0xa7, 0xdc, 0x2e, 0x4a, 0x23, 0x53, 0x6a, 0x58, 0x80, 0xa2, 0xdb, 0x67 },
+	{ 0xed, 0xe4, 0x47, 0xb3, 0x62, 0xc4, 0x84, 0x99, 0x3d, 0xec, 0x94, 0x42, 0xa3, 0xb4, 0x6a, 0xef },
+	{ 0x10, 0xdf, 0xfb, 0x05, 0x90, 0x4b, 0xff, 0x7c, 0x47, 0x81, 0xdf, 0x78, 0x0a, 0xd2, 0x68, 0x37 },
+	{ 0xc3, 0x3b, 0xc1, 0x3e, 0x8d, 0xe8, 0x8a, 0xc2, 0x52, 0x32, 0xaa, 0x74, 0x96, 0x39, 0x87, 0x83 },
+	{ 0xca, 0x35, 0x9c, 0x70, 0x80, 0x3a, 0x3b, 0x2a, 0x3d, 0x54, 0x2e, 0x87, 0x81, 0xde, 0xa9, 0x75 },
+	{ 0xbc, 0xc6, 0x5b, 0x52, 0x6f, 0x88, 0xd0, 0x5b, 0x89, 0xce, 0x8a, 0x52, 0x02, 0x1f, 0xdb, 0x06 },
+	{ 0xdb, 0x91, 0xa3, 0x88, 0x55, 0xc8, 0xc4, 0x64, 0x38, 0x51, 0xfb, 0xfb, 0x35, 0x8b, 0x01, 0x09 },
+	{ 0xca, 0x6e, 0x88, 0x93, 0xa1, 0x14, 0xae, 0x8e, 0x27, 0xd5, 0xab, 0x03, 0xa5, 0x49, 0x96, 0x10 },
+	{ 0x66, 0x29, 0xd2, 0xb8, 0xdf, 0x97, 0xda, 0x72, 0x8c, 0xdd, 0x8b, 0x1e, 0x7f, 0x94, 0x50, 0x77 },
+	{ 0x45, 0x70, 0xa5, 0xa1, 0x8c, 0xfc, 0x0d, 0xd5, 0x82, 0xf1, 0xd8, 0x8d, 0x5c, 0x9a, 0x17, 0x20 },
+	{ 0x72, 0xbc, 0x65, 0xaa, 0x8e, 0x89, 0x56, 0x2e, 0x3f, 0x27, 0x4d, 0x45, 0xaf, 0x1c, 0xd1, 0x0b },
+	{ 0x98, 0x55, 0x1d, 0xa1, 0xa6, 0x50, 0x32, 0x76, 0xae, 0x1c, 0x77, 0x62, 0x5f, 0x9e, 0xa6, 0x15 },
+	{ 0x0d, 0xdf, 0xe5, 0x1c, 0xed, 0x7e, 0x3f, 0x4a, 0xe9, 0x27, 0xda, 0xa3, 0xfe, 0x45, 0x2c, 0xee },
+	{ 0xdb, 0x82, 0x62, 0x51, 0xe4, 0xce, 0x38, 0x4b, 0x80, 0x21, 0x8b, 0x0e, 0x1d, 0xa1, 0xdd, 0x4c },
+	{ 0x2c, 0xac, 0xf7, 0x28, 0xb8, 0x8a, 0xbb, 0xad, 0x70, 0x11, 0xed, 0x0e, 0x64, 0xa1, 0x68, 0x0c },
+	{ 0x33, 0x0d, 0x8e, 0xe7, 0xc5, 0x67, 0x7e, 0x09, 0x9a, 0xc7, 0x4c, 0x99, 0x94, 0xee, 0x4c, 0xfb },
+	{ 0xed, 0xf6, 0x1a, 0xe3, 0x62, 0xe8, 0x82, 0xdd, 0xc0, 0x16, 0x74, 0x74, 0xa7, 0xa7, 0x7f, 0x3a },
+	{ 0x61, 0x68, 0xb0, 0x0b, 0xa7, 0x85, 0x9e, 0x09, 0x70, 0xec, 0xfd, 0x75, 0x7e, 0xfe, 0xcf, 0x7c },
+	{ 0xd1, 0x41, 0x54, 0x47, 0x86, 0x62, 0x30, 0xd2, 0x8b, 0xb1, 0xea, 0x18, 0xa4, 0xcd, 0xfd, 0x02 },
+	{ 0x51, 0x61, 0x83, 0x39, 0x2f, 0x7a, 0x87, 0x63, 0xaf, 0xec, 0x68, 0xa0, 0x60, 0x26, 0x41, 0x41 },
+	{ 0x77, 0x56, 0x5c, 0x8d, 0x73, 0xcf, 0xd4, 0x13, 0x0b, 0x4a, 0xa1, 0x4d, 0x89, 0x11, 0x71, 0x0f },
+	{ 0x37, 0x23, 0x2a, 0x4e, 0xd2, 0x1c, 0xcc, 0x27, 0xc1, 0x9c, 0x96, 0x10, 0x07, 0x8c, 0xab, 0xac },
+	{ 0x80, 0x4f, 0x32, 0xea, 0x71, 0x82, 0x8c, 0x7d, 0x32, 0x90, 0x77, 0xe7, 0x12, 0x23, 0x16, 0x66 },
+	{ 0xd6, 0x44, 0x24, 0xf2, 0x3c, 0xb9, 0x72, 0x15, 0xe9, 0xc2, 0xc6, 0xf2, 0x8d, 0x29, 0xea, 0xb7 },
+	{ 0x02, 0x3e, 0x82, 0xb5, 0x33, 0xf6, 0x8c, 0x75, 0xc2, 0x38, 0xce, 0xbd, 0xb2, 0xee, 0x89, 0xa2 },
+	{ 0x19, 0x3a, 0x3d, 0x24, 0x15, 0x7a, 0x51, 0xf1, 0xee, 0x08, 0x93, 0xf6, 0x77, 0x74, 0x17, 0xe7 },
+	{ 0x84, 0xec, 0xac, 0xfc, 0xd4, 0x00, 0x08, 0x4d, 0x07, 0x86, 0x12, 0xb1, 0x94, 0x5f, 0x2e, 0xf5 },
+	{ 0x1d, 0xcd, 0x8b, 0xb1, 0x73, 0x25, 0x9e, 0xb3, 0x3a, 0x52, 0x42, 0xb0, 0xde, 0x31, 0xa4, 0x55 },
+	{ 0x35, 0xe9, 0xed, 0xdb, 0xc3, 0x75, 0xe7, 0x92, 0xc1, 0x99, 0x92, 0xc1, 0x91, 0x65, 0x01, 0x2b },
+	{ 0x8a, 0x77, 0x22, 0x31, 0xc0, 0x1d, 0xfd, 0xd7, 0xc9, 0x8e, 0x4c, 0xfd, 0xdc, 0xc0, 0x80, 0x7a },
+	{ 0x6e, 0xda, 0x7f, 0xf6, 0xb8, 0x31, 0x91, 0x80, 0xff, 0x0d, 0x6e, 0x65, 0x62, 0x9d, 0x01, 0xc3 },
+	{ 0xc2, 0x67, 0xef, 0x0e, 0x2d, 0x01, 0xa9, 0x93, 0x94, 0x4d, 0xd3, 0x97, 0x10, 0x14, 0x13, 0xcb },
+	{ 0xe9, 0xf8, 0x0e, 0x9d, 0x84, 0x5b, 0xcc, 0x0f, 0x62, 0x92, 0x6a, 0xf7, 0x2e, 0xab, 0xca, 0x39 },
+	{ 0x67, 0x02, 0x99, 0x07, 0x27, 0xaa, 0x08, 0x78, 0x63, 0x7b, 0x45, 0xdc, 0xd3, 0xa3, 0xb0, 0x74 },
+	{ 0x2e, 0x2e, 0x64, 0x7d, 0x53, 0x60, 0xe0, 0x92, 0x30, 0xa5, 0xd7, 0x38, 0xca, 0x33, 0x47, 0x1e },
+	{ 0x1f, 0x56, 0x41, 0x3c, 0x7a, 0xdd, 0x6f, 0x43, 0xd1, 0xd5, 0x6e, 0x4f, 0x02, 0x19, 0x03, 0x30 },
+	{ 0x69, 0xcd, 0x06, 0x06, 0xe1, 0x5a, 0xf7, 0x29, 0xd6, 0xbc, 0xa1, 0x43, 0x01, 0x6d, 0x98, 0x42 },
+	{ 0xa0, 0x85, 0xd7, 0xc1, 0xa5, 0x00, 0x87, 0x3a, 0x20, 0x09, 0x9c, 0x4c, 0xaa, 0x3c, 0x3f, 0x5b },
+	{ 0x4f, 0xc0, 0xd2, 0x30, 0xf8, 0x89, 0x14, 0x15, 0xb8, 0x7b, 0x83, 0xf9, 0x5f, 0x2e, 0x09, 0xd1 },
+	{ 0x43, 0x27, 0xd0, 0x8c, 0x52, 0x3d, 0x8e, 0xba, 0x69, 0x7a, 0x43, 0x36, 0x50, 0x7d, 0x1f, 0x42 },
+	{ 0x7a, 0x15, 0xaa, 0xb8, 0x27, 0x01, 0xef, 0xa5, 0xae, 0x36, 0xab, 0x1d, 0x6b, 0x76, 0x29, 0x0f },
+	{ 0x5b, 0xf0, 0x05, 0x18, 0x93, 0xa1, 0x8b, 0xb3, 0x0e, 0x13, 0x9a, 0x58, 0xfe, 0xd0, 0xfa, 0x54 },
+	{ 0x97, 0xe8, 0xad, 0xf6, 0x56, 0x38, 0xfd, 0x9c, 0xdf, 0x3b, 0xc2, 0x2c, 0x17, 0xfe, 0x4d, 0xbd },
+	{ 0x1e, 0xe6, 0xee, 0x32, 0x65, 0x83, 0xa0, 0x58, 0x64, 0x91, 0xc9, 0x64, 0x18, 0xd1, 0xa3, 0x5d },
+	{ 0x26, 0xb5, 0x49, 0xc2, 0xec, 0x75, 0x6f, 0x82, 0xec, 0xc4, 0x80, 0x08, 0xe5, 0x29, 0x95, 0x6b },
+	{ 0x70, 0x37, 0x7b, 0x6d, 0xa6, 0x69, 0xb0, 0x72, 0x12, 0x9e, 0x05, 0x7c, 0xc2, 0x8e, 0x9c, 0xa5 },
+	{ 0x9c, 0x94, 0xb8, 0xb0, 0xcb, 0x8b, 0xcc, 0x91, 0x90, 0x72, 0x26, 0x2b, 0x3f, 0xa0, 0x5a, 0xd9 },
+	{ 0x2f, 0xbb, 0x83, 0xdf, 0xd0, 0xd7, 0xab, 0xcb, 0x05, 0xcd, 0x28, 0xca, 0xd2, 0xdf, 0xb5, 0x23 },
+	{ 0x96, 0x87, 0x78, 0x03, 0xde, 0x77, 0x74, 0x4b, 0xb9, 0x70, 0xd0, 0xa9, 0x1f, 0x4d, 0xeb, 0xae },
+	{ 0x73, 0x79, 0xf3, 0x37, 0x0c, 0xf6, 0xe5, 0xce, 0x12, 0xae, 0x59, 0x69, 0xc8, 0xee, 0xa3, 0x12 },
+	{ 0x02, 0xdc, 0x99, 0xfa, 0x3d, 0x4f, 0x98, 0xce, 0x80, 0x98, 0x5e, 0x72, 0x33, 0x88, 0x93, 0x13 },
+	{ 0x1e, 0x38, 0xe7, 0x59, 0x07, 0x5b, 0xa5, 0xca, 0xb6, 0x45, 0x7d, 0xa5, 0x18, 0x44, 0x29, 0x5a },
+	{ 0x70, 0xbe, 0xd8, 0xdb, 0xf6, 0x15, 0x86, 0x8a, 0x1f, 0x9d, 0x9b, 0x05, 0xd3, 0xe7, 0xa2, 0x67 },
+	{ 0x23, 0x4b, 0x14, 0x8b, 0x8c, 0xb1, 0xd8, 0xc3, 0x2b, 0x28, 0x7e, 0x89, 0x69, 0x03, 0xd1, 0x50 },
+	{ 0x29, 0x4b, 0x03, 0x3d, 0xf4, 0xda, 0x85, 0x3f, 0x4b, 0xe3, 0xe2, 0x43, 0xf7, 0xe5, 0x13, 0xf4 },
+	{ 0x3f, 0x58, 0xc9, 0x50, 0xf0, 0x36, 0x71, 0x60, 0xad, 0xec, 0x45, 0xf2, 0x44, 0x1e, 0x74, 0x11 },
+	{ 0x37, 0xf6, 0x55, 0x53, 0x6a, 0x70, 0x4e, 0x5a, 0xce, 0x18, 0x2d, 0x74, 0x2a, 0x82, 0x0c, 0xf4 },
+	{ 0xea, 0x7b, 0xd6, 0xbb, 0x63, 0x41, 0x87, 0x31, 0xae, 0xac, 0x79, 0x0f, 0xe4, 0x2d, 0x61, 0xe8 },
+	{ 0xe7, 0x4a, 0x4c, 0x99, 0x9b, 0x4c, 0x06, 0x4e, 0x48, 0xbb, 0x1e, 0x41, 0x3f, 0x51, 0xe5, 0xea },
+	{ 0xba, 0x9e, 0xbe, 0xfd, 0xb4, 0xcc, 0xf3, 0x0f, 0x29, 0x6c, 0xec, 0xb3, 0xbc, 0x19, 0x43, 0xe8 },
+	{ 0x31, 0x94, 0x36, 0x7a, 0x48, 0x98, 0xc5, 0x02, 0xc1, 0x3b, 0xb7, 0x47, 0x86, 0x40, 0xa7, 0x2d },
+	{ 0xda, 0x79, 0x77, 0x13, 0x26, 0x3d, 0x6f, 0x33, 0xa5, 0x47, 0x8a, 0x65, 0xef, 0x60, 0xd4, 0x12 },
+	{ 0xd1, 0xac, 0x39, 0xbb, 0x1e, 0xf8, 0x6b, 0x9c, 0x13, 0x44, 0xf2, 0x14, 0x67, 0x9a, 0xa3, 0x76 },
+	{ 0x2f, 0xde, 0xa9, 0xe6, 0x50, 0x53, 0x2b, 0xe5, 0xbc, 0x0e, 0x73, 0x25, 0x33, 0x7f, 0xd3, 0x63 },
+	{ 0xd3, 0xa2, 0x04, 0xdb, 0xd9, 0xc2, 0xaf, 0x15, 0x8b, 0x6c, 0xa6, 0x7a, 0x51, 0x56, 0xce, 0x4a },
+	{ 0x3a, 0x0a, 0x0e, 0x75, 0xa8, 0xda, 0x36, 0x73, 0x5a, 0xee, 0x66, 0x84, 0xd9, 0x65, 0xa7, 0x78 },
+	{ 0x52, 0xfc, 0x3e, 0x62, 0x04, 0x92, 0xea, 0x99, 0x64, 0x1e, 0xa1, 0x68, 0xda, 0x5b, 0x6d, 0x52 },
+	{ 0xd2, 0xe0, 0xc7, 0xf1, 0x5b, 0x47, 0x72, 0x46, 0x7d, 0x2c, 0xfc, 0x87, 0x30, 0x00, 0xb2, 0xca },
+	{ 0x56, 0x35, 0x31, 0x13, 0x5e, 0x0c, 0x4d, 0x70, 0xa3, 0x8f, 0x8b, 0xdb, 0x19, 0x0b, 0xa0, 0x4e },
+	{ 0xa8, 0xa3, 0x9a, 0x0f, 0x56, 0x63, 0xf4, 0xc0, 0xfe, 0x5f, 0x2d, 0x3c, 0xaf, 0xff, 0x42, 0x1a },
+	{ 0xd9, 0x4b, 0x5e, 0x90, 0xdb, 0x35, 0x4c, 0x1e, 0x42, 0xf6, 0x1f, 0xab, 0xe1, 0x67, 0xb2, 0xc0 },
+	{ 0x50, 0xe6, 0xd3, 0xc9, 0xb6, 0x69, 0x8a, 0x7c, 0xd2, 0x76, 0xf9, 0x6b, 0x14, 0x73, 0xf3, 0x5a },
+	{ 0x93, 0x38, 0xf0, 0x8e, 0x0e, 0xbe, 0xe9, 0x69, 0x05, 0xd8, 0xf2, 0xe8, 0x25, 0x20, 0x8f, 0x43 },
+	{ 0x8b, 0x37, 0x8c, 0x86, 0x67, 0x2a, 0xa5, 0x4a, 0x3a, 0x26, 0x6b, 0xa1, 0x9d, 0x25, 0x80, 0xca },
+	{ 0xcc, 0xa7, 0xc3, 0x08, 0x6f, 0x5f, 0x95, 0x11, 0xb3, 0x12, 0x33, 0xda, 0x7c, 0xab, 0x91, 0x60 },
+	{ 0x5b, 0x40, 0xff, 0x4e, 0xc9, 0xbe, 0x53, 0x6b, 0xa2, 0x30, 0x35, 0xfa, 0x4f, 0x06, 0x06, 0x4c },
+	{ 0x60, 0xeb, 0x5a, 0xf8, 0x41, 0x6b, 0x25, 0x71, 0x49, 0x37, 0x21, 0x94, 0xe8, 0xb8, 0x87, 0x49 },
+	{ 0x2f, 0x00, 0x5a, 0x8a, 0xed, 0x8a, 0x36, 0x1c, 0x92, 0xe4, 0x40, 0xc1, 0x55, 0x20, 0xcb, 0xd1 },
+	{ 0x7b, 0x03, 0x62, 0x76, 0x11, 0x67, 0x8a, 0x99, 0x77, 0x17, 0x57, 0x88, 0x07, 0xa8, 0x00, 0xe2 },
+	{ 0xcf, 0x78, 0x61, 0x8f, 0x74, 0xf6, 0xf3, 0x69, 0x6e, 0x0a, 0x47, 0x79, 0xb9, 0x0b, 0x5a, 0x77 },
+	{ 0x03, 0x72, 0x03, 0x71, 0xa0, 0x49, 0x62, 0xea, 0xea, 0x0a, 0x85, 0x2e, 0x69, 0x97, 0x28, 0x58 },
+	{ 0x1f, 0x8a, 0x81, 0x33, 0xaa, 0x8c, 0xcf, 0x70, 0xe2, 0xbd, 0x32, 0x85, 0x83, 0x1c, 0xa6, 0xb7 },
+	{ 0x27, 0x93, 0x6b, 0xd2, 0x7f, 0xb1, 0x46, 0x8f, 0xc8, 0xb4, 0x8b, 0xc4, 0x83, 0x32, 0x17, 0x25 },
+	{ 0xb0, 0x7d, 0x4f, 0x3e, 0x2c, 0xd2, 0xef, 0x2e, 0xb5, 0x45, 0x98, 0x07, 0x54, 0xdf, 0xea, 0x0f },
+	{ 0x4b, 0xf8, 0x5f, 0x1b, 0x5d, 0x54, 0xad, 0xbc, 0x30, 0x7b, 0x0a, 0x04, 0x83, 0x89, 0xad, 0xcb },
+};
+const unsigned int ECBVarKey256_count = 2 * sizeof(ECBVarKey256) / sizeof(ECBVarKey256[0]);
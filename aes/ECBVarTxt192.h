@@ -0,0 +1,184 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+#include "aes_kat.h"
+
+//Vector i of ECBVarTxt192 uses an all-zero key and a plaintext with its first
+//i + 1 bits set, so only the ciphertexts are stored and aes.c builds the
+//key and plaintext from the vector number.  NIST lists every vector
+//under [ENCRYPT] and again under [DECRYPT]; the suite runs the table twice.
+const unsigned char ECBVarTxt192[128][16] = {
+	{ 0x6c, 0xd0, 0x25, 0x13, 0xe8, 0xd4, 0xdc, 0x98, 0x6b, 0x4a, 0xfe, 0x08, 0x7a, 0x60, 0xbd, 0x0c },
+	{ 0x2c, 0xe1, 0xf8, 0xb7, 0xe3, 0x06, 0x27, 0xc1, 0xc4, 0x51, 0x9e, 0xad, 0xa4, 0x4b, 0xc4, 0x36 },
+	{ 0x99, 0x46, 0xb5, 0xf8, 0x7a, 0xf4, 0x46, 0xf5, 0x79, 0x6c, 0x1f, 0xee, 0x63, 0xa2, 0xda, 0x24 },
+	{ 0x2a, 0x56, 0x03, 0x64, 0xce, 0x52, 0x9e, 0xfc, 0x21, 0x78, 0x87, 0x79, 0x56, 0x8d, 0x55, 0x55 },
+	{ 0x35, 0xc1, 0x47, 0x18, 0x37, 0xaf, 0x44, 0x61, 0x53, 0xbc, 0xe5, 0x5d, 0x5b, 0xa7, 0x2a, 0x0a },
+	{ 0xce, 0x60, 0xbc, 0x52, 0x38, 0x62, 0x34, 0xf1, 0x58, 0xf8, 0x43, 0x41, 0xe5, 0x34, 0xcd, 0x9e },
+	{ 0x8c, 0x7c, 0x27, 0xff, 0x32, 0xbc, 0xf8, 0xdc, 0x2d, 0xc5, 0x7c, 0x90, 0xc2, 0x90, 0x39, 0x61 },
+	{ 0x32, 0xbb, 0x6a, 0x7e, 0xc8, 0x44, 0x99, 0xe1, 0x66, 0xf9, 0x36, 0x00, 0x3d, 0x55, 0xa5, 0xbb },
+	{ 0xa5, 0xc7, 0x72, 0xe5, 0xc6, 0x26, 0x31, 0xef, 0x66, 0x0e, 0xe1, 0xd5, 0x87, 0x7f, 0x6d, 0x1b },
+	{ 0x03, 0x0d, 0x7e, 0x5b, 0x64, 0xf3, 0x80, 0xa7, 0xe4, 0xea, 0x53, 0x87, 0xb5, 0xcd, 0x7f, 0x49 },
+	{ 0x0d, 0xc9, 0xa2, 0x61, 0x00, 0x37, 0x00, 0x9b, 0x69, 0x8f, 0x11, 0xbb, 0x7e, 0x86, 0xc8, 0x3e },
+	{ 0x00, 0x46, 0x61, 0x2c, 0x76, 0x6d, 0x18, 0x40, 0xc2, 0x26, 0x36, 0x4f, 0x1f, 0xa7, 0xed, 0x72 },
+	{ 0x48, 0x80, 0xc7, 0xe0, 0x8f, 0x27, 0xbe, 0xfe, 0x78, 0x59, 0x07, 0x43, 0xc0, 0x5e, 0x69, 0x8b },
+	{ 0x25, 0x20, 0xce, 0x82, 0x9a, 0x26, 0x57, 0x7f, 0x0f, 0x48, 0x22, 0xc4, 0xec, 0xc8, 0x74, 0x01 },
+	{ 0x87, 0x65, 0xe8, 0xac, 0xc1, 0x69, 0x75, 0x83, 0x19, 0xcb, 0x46, 0xdc, 0x7b, 0xcf, 0x3d, 0xca },
+	{ 0xe9, 0x8f, 0x4b, 0xa4, 0xf0, 0x73, 0xdf, 0x4b, 0xaa, 0x11, 0x6d, 0x01, 0x1d, 0xc2, 0x4a, 0x28 },
+	{ 0xf3, 0x78, 0xf6, 0x8c, 0x5d, 0xbf, 0x59, 0xe2, 0x11, 0xb3, 0xa6, 0x59, 0xa7, 0x31, 0x7d, 0x94 },
+	{ 0x28, 0x3d, 0x3b, 0x06, 0x9d, 0x8e, 0xb9, 0xfb, 0x43, 0x2d, 0x74, 0xb9, 0x6c, 0xa7, 0x62, 0xb4 },
+	{ 0xa7, 0xe1, 0x84, 0x2e, 0x8a, 0x87, 0x86, 0x1c, 0x22, 0x1a, 0x50, 0x08, 0x83, 0x24, 0x5c, 0x51 },
+	{ 0x77, 0xaa, 0x27, 0x04, 0x71, 0x88, 0x1b, 0xe0, 0x70, 0xfb, 0x52, 0xc7, 0x06, 0x7c, 0xe7, 0x32 },
+	{ 0x01, 0xb0, 0xf4, 0x76, 0xd4, 0x84, 0xf4, 0x3f, 0x1a, 0xeb, 0x6e, 0xfa, 0x93, 0x61, 0xa8, 0xac },
+	{ 0x1c, 0x3a, 0x94, 0xf1, 0xc0, 0x52, 0xc5, 0x5c, 0x2d, 0x83, 0x59, 0xaf, 0xf2, 0x16, 0x3b, 0x4f },
+	{ 0xe8, 0xa0, 0x67, 0xb6, 0x04, 0xd5, 0x37, 0x3d, 0x8b, 0x0f, 0x2e, 0x05, 0xa0, 0x3b, 0x34, 0x1b },
+	{ 0xa7, 0x87, 0x6e, 0xc8, 0x7f, 0x5a, 0x09, 0xbf, 0xea, 0x42, 0xc7, 0x7d, 0xa3, 0x0f, 0xd5, 0x0e },
+	{ 0x0c, 0xf3, 0xe9, 0xd3, 0xa4, 0x2b, 0xe5, 0xb8, 0x54, 0xca, 0x65, 0xb1, 0x3f, 0x35, 0xf4, 0x8d },
+	{ 0x6c, 0x62, 0xf6, 0xbb, 0xca, 0xb7, 0xc3, 0xe8, 0x21, 0xc9, 0x29, 0x0f, 0x08, 0x89, 0x2d, 0xda },
+	{ 0x7f, 0x5e, 0x05, 0xbd, 0x20, 0x68, 0x73, 0x81, 0x96, 0xfe, 0xe7, 0x9a, 0xce, 0x7e, 0x3a, 0xec },
+	{ 0x44, 0x0e, 0x0d, 0x73, 0x32, 0x55, 0xcd, 0xa9, 0x2f, 0xb4, 0x6e, 0x84, 0x2f, 0xe5, 0x80, 0x54 },
+	{ 0xaa, 0x5d, 0x5b, 0x1c, 0x4e, 0xa1, 0xb7, 0xa2, 0x2e, 0x55, 0x83, 0xac, 0x2e, 0x9e, 0xd8, 0xa7 },
+	{ 0x77, 0xe5, 0x37, 0xe8, 0x9e, 0x84, 0x91, 0xe8, 0x66, 0x2a, 0xae, 0x3b, 0xc8, 0x09, 0x42, 0x1d },
+	{ 0x99, 0x7d, 0xd3, 0xe9, 0xf1, 0x59, 0x8b, 0xfa, 0x73, 0xf7, 0x59, 0x73, 0xf7, 0xe9, 0x3b, 0x76 },
+	{ 0x1b, 0x38, 0xd4, 0xf7, 0x45, 0x2a, 0xfe, 0xfc, 0xb7, 0xfc, 0x72, 0x12, 0x44, 0xe4, 0xb7, 0x2e },
+	{ 0x0b, 0xe2, 0xb1, 0x82, 0x52, 0xe7, 0x74, 0xdd, 0xa3, 0x0c, 0xdd, 0xa0, 0x2c, 0x69, 0x06, 0xe3 },
+	{ 0xd2, 0x69, 0x5e, 0x59, 0xc2, 0x03, 0x61, 0xd8, 0x26, 0x52, 0xd7, 0xd5, 0x8b, 0x6f, 0x11, 0xb2 },
+	{ 0x90, 0x2d, 0x88, 0xd1, 0x3e, 0xae, 0x52, 0x08, 0x9a, 0xbd, 0x61, 0x43, 0xcf, 0xe3, 0x94, 0xe9 },
+	{ 0xd4, 0x9b, 0xce, 0xb3, 0xb8, 0x23, 0xfe, 0xdd, 0x60, 0x2c, 0x30, 0x53, 0x45, 0x73, 0x4b, 0xd2 },
+	{ 0x70, 0x7b, 0x1d, 0xbb, 0x0f, 0xfa, 0x40, 0xef, 0x7d, 0x95, 0xde, 0xf4, 0x21, 0x23, 0x3f, 0xae },
+	{ 0x7c, 0xa0, 0xc1, 0xd9, 0x33, 0x56, 0xd9, 0xeb, 0x8a, 0xa9, 0x52, 0x08, 0x4d, 0x75, 0xf9, 0x13 },
+	{ 0xf2, 0xcb, 0xf9, 0xcb, 0x18, 0x6e, 0x27, 0x0d, 0xd7, 0xbd, 0xb0, 0xc2, 0x8f, 0xeb, 0xc5, 0x7d },
+	{ 0xc9, 0x43, 0x37, 0xc3, 0x7c, 0x4e, 0x79, 0x0a, 0xb4, 0x57, 0x80, 0xbd, 0x9c, 0x36, 0x74, 0xa0 },
+	{ 0x8e, 0x35, 0x58, 0xc1, 0x35, 0x25, 0x2f, 0xb9, 0xc9, 0xf3, 0x67, 0xed, 0x60, 0x94, 0x67, 0xa1 },
+	{ 0x1b, 0x72, 0xee, 0xae, 0xe4, 0x89, 0x9b, 0x44, 0x39, 0x14, 0xe5, 0xb3, 0xa5, 0x7f, 0xba, 0x92 },
+	{ 0x01, 0x18, 0x65, 0xf9, 0x1b, 0xc5, 0x68, 0x68, 0xd0, 0x51, 0xe5, 0x2c, 0x9e, 0xfd, 0x59, 0xb7 },
+	{ 0xe4, 0x77, 0x13, 0x18, 0xad, 0x7a, 0x63, 0xdd, 0x68, 0x0f, 0x6e, 0x58, 0x3b, 0x77, 0x47, 0xea },
+	{ 0x61, 0xe3, 0xd1, 0x94, 0x08, 0x8d, 0xc8, 0xd9, 0x7e, 0x9e, 0x6d, 0xb3, 0x74, 0x57, 0xea, 0xc5 },
+	{ 0x36, 0xff, 0x1e, 0xc9, 0xcc, 0xfb, 0xc3, 0x49, 0xe5, 0xd3, 0x56, 0xd0, 0x63, 0x69, 0x3a, 0xd6 },
+	{ 0x3c, 0xc9, 0xe9, 0xa9, 0xbe, 0x8c, 0xc3, 0xf6, 0xfb, 0x2e, 0xa2, 0x40, 0x88, 0xe9, 0xbb, 0x19 },
+	{ 0x1e, 0xe5, 0xab, 0x00, 0x3d, 0xc8, 0x72, 0x2e, 0x74, 0x90, 0x5d, 0x9a, 0x8f, 0xe3, 0xd3, 0x50 },
+	{ 0x24, 0x53, 0x39, 0x31, 0x95, 0x84, 0xb0, 0xa4, 0x12, 0x41, 0x28, 0x69, 0xd6, 0xc2, 0xea, 0xda },
+	{ 0x7b, 0xd4, 0x96, 0x91, 0x81, 0x15, 0xd1, 0x4e, 0xd5, 0x38, 0x08, 0x52, 0x71, 0x6c, 0x88, 0x14 },
+	{ 0x27, 0x3a, 0xb2, 0xf2, 0xb4, 0xa3, 0x66, 0xa5, 0x7d, 0x58, 0x2a, 0x33, 0x93, 0x13, 0xc8, 0xb1 },
+	{ 0x11, 0x33, 0x65, 0xa9, 0xff, 0xbe, 0x3b, 0x0c, 0xa6, 0x1e, 0x98, 0x50, 0x75, 0x54, 0x16, 0x8b },
+	{ 0xaf, 0xa9, 0x9c, 0x99, 0x7a, 0xc4, 0x78, 0xa0, 0xde, 0xa4, 0x11, 0x9c, 0x9e, 0x45, 0xf8, 0xb1 },
+	{ 0x92, 0x16, 0x30, 0x9a, 0x78, 0x42, 0x43, 0x0b, 0x83, 0xff, 0xb9, 0x86, 0x38, 0x01, 0x15, 0x12 },
+	{ 0x62, 0xab, 0xc7, 0x92, 0x28, 0x82, 0x58, 0x49, 0x2a, 0x7c, 0xb4, 0x51, 0x45, 0xf4, 0xb7, 0x59 },
+	{ 0x53, 0x49, 0x23, 0xc1, 0x69, 0xd5, 0x04, 0xd7, 0x51, 0x9c, 0x15, 0xd3, 0x0e, 0x75, 0x6c, 0x50 },
+	{ 0xfa, 0x75, 0xe0, 0x5b, 0xcd, 0xc7, 0xe0, 0x0c, 0x27, 0x3f, 0xa3, 0x3f, 0x6e, 0xe4, 0x41, 0xd2 },
+	{ 0x7d, 0x35, 0x0f, 0xa6, 0x05, 0x70, 0x80, 0xf1, 0x08, 0x6a, 0x56, 0xb1, 0x7e, 0xc2, 0x40, 0xdb },
+	{ 0xf3, 0x4e, 0x4a, 0x63, 0x24, 0xea, 0x4a, 0x5c, 0x39, 0xa6, 0x61, 0xc8, 0xfe, 0x5a, 0xda, 0x8f },
+	{ 0x08, 0x82, 0xa1, 0x6f, 0x44, 0x08, 0x8d, 0x42, 0x44, 0x7a, 0x29, 0xac, 0x09, 0x0e, 0xc1, 0x7e },
+	{ 0x3a, 0x3c, 0x15, 0xbf, 0xc1, 0x1a, 0x95, 0x37, 0xc1, 0x30, 0x68, 0x70, 0x04, 0xe1, 0x36, 0xee },
+	{ 0x22, 0xc0, 0xa7, 0x67, 0x8d, 0xc6, 0xd8, 0xcf, 0x5c, 0x8a, 0x6d, 0x5a, 0x99, 0x60, 0x76, 0x7c },
+	{ 0xb4, 0x6b, 0x09, 0x80, 0x9d, 0x68, 0xb9, 0xa4, 0x56, 0x43, 0x2a, 0x79, 0xbd, 0xc2, 0xe3, 0x8c },
+	{ 0x93, 0xba, 0xaf, 0xfb, 0x35, 0xfb, 0xe7, 0x39, 0xc1, 0x7c, 0x6a, 0xc2, 0x2e, 0xec, 0xf1, 0x8f },
+	{ 0xc8, 0xaa, 0x80, 0xa7, 0x85, 0x06, 0x75, 0xbc, 0x00, 0x7c, 0x46, 0xdf, 0x06, 0xb4, 0x98, 0x68 },
+	{ 0x12, 0xc6, 0xf3, 0x87, 0x7a, 0xf4, 0x21, 0xa9, 0x18, 0xa8, 0x4b, 0x77, 0x58, 0x58, 0x02, 0x1d },
+	{ 0x33, 0xf1, 0x23, 0x28, 0x2c, 0x5d, 0x63, 0x39, 0x24, 0xf7, 0xd5, 0xba, 0x3f, 0x3c, 0xab, 0x11 },
+	{ 0xa8, 0xf1, 0x61, 0x00, 0x27, 0x33, 0xe9, 0x3c, 0xa4, 0x52, 0x7d, 0x22, 0xc1, 0xa0, 0xc5, 0xbb },
+	{ 0xb7, 0x2f, 0x70, 0xeb, 0xf3, 0xe3, 0xfd, 0xa2, 0x3f, 0x50, 0x8e, 0xec, 0x76, 0xb4, 0x2c, 0x02 },
+	{ 0x6a, 0x9d, 0x96, 0x5e, 0x62, 0x74, 0x14, 0x3f, 0x25, 0xaf, 0xdc, 0xfc, 0x88, 0xff, 0xd7, 0x7c },
+	{ 0xa0, 0xc7, 0x4f, 0xd0, 0xb9, 0x36, 0x17, 0x64, 0xce, 0x91, 0xc5, 0x20, 0x0b, 0x09, 0x53, 0x57 },
+	{ 0x09, 0x1d, 0x1f, 0xdc, 0x2b, 0xd2, 0xc3, 0x46, 0xcd, 0x50, 0x46, 0xa8, 0xc6, 0x20, 0x91, 0x46 },
+	{ 0xe2, 0xa3, 0x75, 0x80, 0x11, 0x6c, 0xfb, 0x71, 0x85, 0x62, 0x54, 0x49, 0x6a, 0xb0, 0xac, 0xa8 },
+	{ 0xe0, 0xb3, 0xa0, 0x07, 0x85, 0x91, 0x7c, 0x7e, 0xfc, 0x9a, 0xdb, 0xa3, 0x22, 0x81, 0x35, 0x71 },
+	{ 0x73, 0x3d, 0x41, 0xf4, 0x72, 0x7b, 0x5e, 0xf0, 0xdf, 0x4a, 0xf4, 0xcf, 0x3c, 0xff, 0xa0, 0xcb },
+	{ 0xa9, 0x9e, 0xbb, 0x03, 0x02, 0x60, 0x82, 0x6f, 0x98, 0x1a, 0xd3, 0xe6, 0x44, 0x90, 0xaa, 0x4f },
+	{ 0x73, 0xf3, 0x4c, 0x7d, 0x3e, 0xae, 0x5e, 0x80, 0x08, 0x2c, 0x16, 0x47, 0x52, 0x43, 0x08, 0xee },
+	{ 0x40, 0xeb, 0xd5, 0xad, 0x08, 0x23, 0x45, 0xb7, 0xa2, 0x09, 0x7c, 0xcd, 0x34, 0x64, 0xda, 0x02 },
+	{ 0x7c, 0xc4, 0xae, 0x9a, 0x42, 0x4b, 0x2c, 0xec, 0x90, 0xc9, 0x71, 0x53, 0xc2, 0x45, 0x7e, 0xc5 },
+	{ 0x54, 0xd6, 0x32, 0xd0, 0x3a, 0xba, 0x0b, 0xd0, 0xf9, 0x18, 0x77, 0xeb, 0xdd, 0x4d, 0x09, 0xcb },
+	{ 0xd3, 0x42, 0x7b, 0xe7, 0xe4, 0xd2, 0x7c, 0xd5, 0x4f, 0x5f, 0xe3, 0x7b, 0x03, 0xcf, 0x08, 0x97 },
+	{ 0xb2, 0x09, 0x97, 0x95, 0xe8, 0x8c, 0xc1, 0x58, 0xfd, 0x75, 0xea, 0x13, 0x3d, 0x7e, 0x7f, 0xbe },
+	{ 0xa6, 0xca, 0xe4, 0x6f, 0xb6, 0xfa, 0xdf, 0xe7, 0xa2, 0xc3, 0x02, 0xa3, 0x42, 0x42, 0x81, 0x7b },
+	{ 0x02, 0x6a, 0x70, 0x24, 0xd6, 0xa9, 0x02, 0xe0, 0xb3, 0xff, 0xcc, 0xba, 0xa9, 0x10, 0xcc, 0x3f },
+	{ 0x15, 0x6f, 0x07, 0x76, 0x7a, 0x85, 0xa4, 0x31, 0x23, 0x21, 0xf6, 0x39, 0x68, 0x33, 0x8a, 0x01 },
+	{ 0x15, 0xee, 0xc9, 0xeb, 0xf4, 0x2b, 0x9c, 0xa7, 0x68, 0x97, 0xd2, 0xcd, 0x6c, 0x5a, 0x12, 0xe2 },
+	{ 0xdb, 0x0d, 0x3a, 0x6f, 0xdc, 0xc1, 0x3f, 0x91, 0x5e, 0x2b, 0x30, 0x2c, 0xee, 0xb7, 0x0f, 0xd8 },
+	{ 0x71, 0xdb, 0xf3, 0x7e, 0x87, 0xa2, 0xe3, 0x4d, 0x15, 0xb2, 0x0e, 0x8f, 0x10, 0xe4, 0x89, 0x24 },
+	{ 0xc7, 0x45, 0xc4, 0x51, 0xe9, 0x6f, 0xf3, 0xc0, 0x45, 0xe4, 0x36, 0x7c, 0x83, 0x3e, 0x3b, 0x54 },
+	{ 0x34, 0x0d, 0xa0, 0x9c, 0x2d, 0xd1, 0x1c, 0x3b, 0x67, 0x9d, 0x08, 0xcc, 0xd2, 0x7d, 0xd5, 0x95 },
+	{ 0x82, 0x79, 0xf7, 0xc0, 0xc2, 0xa0, 0x3e, 0xe6, 0x60, 0xc6, 0xd3, 0x92, 0xdb, 0x02, 0x5d, 0x18 },
+	{ 0xa4, 0xb2, 0xc7, 0xd8, 0xeb, 0xa5, 0x31, 0xff, 0x47, 0xc5, 0x04, 0x1a, 0x55, 0xfb, 0xd1, 0xec },
+	{ 0x74, 0x56, 0x9a, 0x2c, 0xa5, 0xa7, 0xbd, 0x51, 0x31, 0xce, 0x8d, 0xc7, 0xcb, 0xfb, 0xf7, 0x2f },
+	{ 0x37, 0x13, 0xda, 0x0c, 0x02, 0x19, 0xb6, 0x34, 0x54, 0x03, 0x56, 0x13, 0xb5, 0xa4, 0x03, 0xdd },
+	{ 0x88, 0x27, 0x55, 0x1d, 0xdc, 0xc9, 0xdf, 0x23, 0xfa, 0x72, 0xa3, 0xde, 0x4e, 0x9f, 0x0b, 0x07 },
+	{ 0x2e, 0x3f, 0xeb, 0xfd, 0x62, 0x5b, 0xfc, 0xd0, 0xa2, 0xc0, 0x6e, 0xb4, 0x60, 0xda, 0x17, 0x32 },
+	{ 0xee, 0x82, 0xe6, 0xba, 0x48, 0x81, 0x56, 0xf7, 0x64, 0x96, 0x31, 0x1d, 0xa6, 0x94, 0x1d, 0xeb },
+	{ 0x47, 0x70, 0x44, 0x6f, 0x01, 0xd1, 0xf3, 0x91, 0x25, 0x6e, 0x85, 0xa1, 0xb3, 0x0d, 0x89, 0xd3 },
+	{ 0xaf, 0x04, 0xb6, 0x8f, 0x10, 0x4f, 0x21, 0xef, 0x2a, 0xfb, 0x47, 0x67, 0xcf, 0x74, 0x14, 0x3c },
+	{ 0xcf, 0x35, 0x79, 0xa9, 0xba, 0x38, 0xc8, 0xe4, 0x36, 0x53, 0x17, 0x3e, 0x14, 0xf3, 0xa4, 0xc6 },
+	{ 0xb3, 0xbb, 0xa9, 0x04, 0xf4, 0x95, 0x3e, 0x09, 0xb5, 0x48, 0x00, 0xaf, 0x2f, 0x62, 0xe7, 0xd4 },
+	{ 0xfc, 0x42, 0x49, 0x65, 0x6e, 0x14, 0xb2, 0x9e, 0xb9, 0xc4, 0x48, 0x29, 0xb4, 0xc5, 0x9a, 0x46 },
+	{ 0x9b, 0x31, 0x56, 0x8f, 0xeb, 0xe8, 0x1c, 0xfc, 0x2e, 0x65, 0xaf, 0x1c, 0x86, 0xd1, 0xa3, 0x08 },
+	{ 0x9c, 0xa0, 0x9c, 0x25, 0xf2, 0x73, 0xa7, 0x66, 0xdb, 0x98, 0xa4, 0x80, 0xce, 0x8d, 0xfe, 0xdc },
+	{ 0xb9, 0x09, 0x92, 0x57, 0x86, 0xf3, 0x4c, 0x3c, 0x92, 0xd9, 0x71, 0x88, 0x3c, 0x9f, 0xbe, 0xdf },
+	{ 0x82, 0x64, 0x7f, 0x13, 0x32, 0xfe, 0x57, 0x0a, 0x9d, 0x4d, 0x92, 0xb2, 0xee, 0x77, 0x1d, 0x3b },
+	{ 0x36, 0x04, 0xa7, 0xe8, 0x08, 0x32, 0xb3, 0xa9, 0x99, 0x54, 0xbc, 0xa6, 0xf5, 0xb9, 0xf5, 0x01 },
+	{ 0x88, 0x46, 0x07, 0xb1, 0x28, 0xc5, 0xde, 0x3a, 0xb3, 0x9a, 0x52, 0x9a, 0x1e, 0xf5, 0x1b, 0xef },
+	{ 0x67, 0x0c, 0xfa, 0x09, 0x3d, 0x1d, 0xbd, 0xb2, 0x31, 0x70, 0x41, 0x40, 0x41, 0x02, 0x43, 0x5e },
+	{ 0x7a, 0x86, 0x71, 0x95, 0xf3, 0xce, 0x87, 0x69, 0xcb, 0xd3, 0x36, 0x50, 0x2f, 0xbb, 0x51, 0x30 },
+	{ 0x52, 0xef, 0xcf, 0x64, 0xc7, 0x2b, 0x2f, 0x7c, 0xa5, 0xb3, 0xc8, 0x36, 0xb1, 0x07, 0x8c, 0x15 },
+	{ 0x40, 0x19, 0x25, 0x0f, 0x6e, 0xef, 0xb2, 0xac, 0x5c, 0xcb, 0xca, 0xe0, 0x44, 0xe7, 0x5c, 0x7e },
+	{ 0x02, 0x2c, 0x4f, 0x6f, 0x5a, 0x01, 0x7d, 0x29, 0x27, 0x85, 0x62, 0x76, 0x67, 0xdd, 0xef, 0x24 },
+	{ 0xe9, 0xc2, 0x10, 0x78, 0xa2, 0xeb, 0x7e, 0x03, 0x25, 0x0f, 0x71, 0x00, 0x0f, 0xa9, 0xe3, 0xed },
+	{ 0xa1, 0x3e, 0xae, 0xeb, 0x9c, 0xd3, 0x91, 0xda, 0x4e, 0x2b, 0x09, 0x49, 0x0b, 0x3e, 0x7f, 0xad },
+	{ 0xc9, 0x58, 0xa1, 0x71, 0xdc, 0xa1, 0xd4, 0xed, 0x53, 0xe1, 0xaf, 0x1d, 0x38, 0x08, 0x03, 0xa9 },
+	{ 0x21, 0x44, 0x2e, 0x07, 0xa1, 0x10, 0x66, 0x7f, 0x25, 0x83, 0xea, 0xee, 0xee, 0x44, 0xdc, 0x8c },
+	{ 0x59, 0xbb, 0xb3, 0x53, 0xcf, 0x1d, 0xd8, 0x67, 0xa6, 0xe3, 0x37, 0x37, 0xaf, 0x65, 0x5e, 0x99 },
+	{ 0x43, 0xcd, 0x3b, 0x25, 0x37, 0x5d, 0x0c, 0xe4, 0x10, 0x87, 0xff, 0x9f, 0xe2, 0x82, 0x96, 0x39 },
+	{ 0x6b, 0x98, 0xb1, 0x7e, 0x80, 0xd1, 0x11, 0x8e, 0x35, 0x16, 0xbd, 0x76, 0x8b, 0x28, 0x5a, 0x84 },
+	{ 0xae, 0x47, 0xed, 0x36, 0x76, 0xca, 0x0c, 0x08, 0xde, 0xea, 0x02, 0xd9, 0x5b, 0x81, 0xdb, 0x58 },
+	{ 0x34, 0xec, 0x40, 0xdc, 0x20, 0x41, 0x37, 0x95, 0xed, 0x53, 0x62, 0x8e, 0xa7, 0x48, 0x72, 0x0b },
+	{ 0x4d, 0xc6, 0x81, 0x63, 0xf8, 0xe9, 0x83, 0x54, 0x73, 0x25, 0x35, 0x42, 0xc8, 0xa6, 0x5d, 0x46 },
+	{ 0x2a, 0xab, 0xb9, 0x99, 0xf4, 0x36, 0x93, 0x17, 0x5a, 0xf6, 0x5c, 0x6c, 0x61, 0x2c, 0x46, 0xfb },
+	{ 0xe0, 0x1f, 0x94, 0x49, 0x9d, 0xac, 0x35, 0x47, 0x51, 0x5c, 0x5b, 0x1d, 0x75, 0x6f, 0x0f, 0x58 },
+	{ 0x9d, 0x12, 0x43, 0x5a, 0x46, 0x48, 0x0c, 0xe0, 0x0e, 0xa3, 0x49, 0xf7, 0x17, 0x99, 0xdf, 0x9a },
+	{ 0xce, 0xf4, 0x1d, 0x16, 0xd2, 0x66, 0xbd, 0xfe, 0x46, 0x93, 0x8a, 0xd7, 0x88, 0x4c, 0xc0, 0xcf },
+	{ 0xb1, 0x3d, 0xb4, 0xda, 0x1f, 0x71, 0x8b, 0xc6, 0x90, 0x47, 0x97, 0xc8, 0x2b, 0xcf, 0x2d, 0x32 },
+};
+const unsigned int ECBVarTxt192_count = 2 * sizeof(ECBVarTxt192) / sizeof(ECBVarTxt192[0]);
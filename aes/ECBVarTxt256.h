@@ -0,0 +1,184 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+#include "aes_kat.h"
+
+//Vector i of ECBVarTxt256 uses an all-zero key and a plaintext with its first
+//i + 1 bits set, so only the ciphertexts are stored and aes.c builds the
+//key and plaintext from the vector number.  NIST lists every vector
+//under [ENCRYPT] and again under [DECRYPT]; the suite runs the table twice.
+const unsigned char ECBVarTxt256[128][16] = {
+	{ 0xdd, 0xc6, 0xbf, 0x79, 0x0c, 0x15, 0x76, 0x0d, 0x8d, 0x9a, 0xeb, 0x6f, 0x9a, 0x75, 0xfd, 0x4e },
+	{ 0x0a, 0x6b, 0xdc, 0x6d, 0x4c, 0x1e, 0x62, 0x80, 0x30, 0x1f, 0xd8, 0xe9, 0x7d, 0xdb, 0xe6, 0x01 },
+	{ 0x9b, 0x80, 0xee, 0xfb, 0x7e, 0xbe, 0x2d, 0x2b, 0x16, 0x24, 0x7a, 0xa0, 0xef, 0xc7, 0x2f, 0x5d },
+	{ 0x7f, 0x2c, 0x5e, 0xce, 0x07, 0xa9, 0x8d, 0x8b, 0xee, 0x13, 0xc5, 0x11, 0x77, 0x39, 0x5f, 0xf7 },
+	{ 0x78, 0x18, 0xd8, 0x00, 0xdc, 0xf6, 0xf4, 0xbe, 0x1e, 0x0e, 0x94, 0xf4, 0x03, 0xd1, 0xe4, 0xc2 },
+	{ 0xe7, 0x4c, 0xd1, 0xc9, 0x2f, 0x09, 0x19, 0xc3, 0x5a, 0x03, 0x24, 0x12, 0x3d, 0x61, 0x77, 0xd3 },
+	{ 0x80, 0x92, 0xa4, 0xdc, 0xf2, 0xda, 0x7e, 0x77, 0xe9, 0x3b, 0xdd, 0x37, 0x1d, 0xfe, 0xd8, 0x2e },
+	{ 0x49, 0xaf, 0x6b, 0x37, 0x21, 0x35, 0xac, 0xef, 0x10, 0x13, 0x2e, 0x54, 0x8f, 0x21, 0x7b, 0x17 },
+	{ 0x8b, 0xcd, 0x40, 0xf9, 0x4e, 0xbb, 0x63, 0xb9, 0xf7, 0x90, 0x96, 0x76, 0xe6, 0x67, 0xf1, 0xe7 },
+	{ 0xfe, 0x1c, 0xff, 0xb8, 0x3f, 0x45, 0xdc, 0xfb, 0x38, 0xb2, 0x9b, 0xe4, 0x38, 0xdb, 0xd3, 0xab },
+	{ 0x0d, 0xc5, 0x8a, 0x8d, 0x88, 0x66, 0x23, 0x70, 0x5a, 0xec, 0x15, 0xcb, 0x1e, 0x70, 0xdc, 0x0e },
+	{ 0xc2, 0x18, 0xfa, 0xa1, 0x60, 0x56, 0xbd, 0x07, 0x74, 0xc3, 0xe8, 0xd7, 0x9c, 0x35, 0xa5, 0xe4 },
+	{ 0x04, 0x7b, 0xba, 0x83, 0xf7, 0xaa, 0x84, 0x17, 0x31, 0x50, 0x4e, 0x01, 0x22, 0x08, 0xfc, 0x9e },
+	{ 0xdc, 0x8f, 0x0e, 0x49, 0x15, 0xfd, 0x81, 0xba, 0x70, 0xa3, 0x31, 0x31, 0x08, 0x82, 0xf6, 0xda },
+	{ 0x15, 0x69, 0x85, 0x9e, 0xa6, 0xb7, 0x20, 0x6c, 0x30, 0xbf, 0x4f, 0xd0, 0xcb, 0xfa, 0xc3, 0x3c },
+	{ 0x30, 0x0a, 0xde, 0x92, 0xf8, 0x8f, 0x48, 0xfa, 0x2d, 0xf7, 0x30, 0xec, 0x16, 0xef, 0x44, 0xcd },
+	{ 0x1f, 0xe6, 0xcc, 0x3c, 0x05, 0x96, 0x5d, 0xc0, 0x8e, 0xb0, 0x59, 0x0c, 0x95, 0xac, 0x71, 0xd0 },
+	{ 0x59, 0xe8, 0x58, 0xea, 0xaa, 0x97, 0xfe, 0xc3, 0x81, 0x11, 0x27, 0x5b, 0x6c, 0xf5, 0xab, 0xc0 },
+	{ 0x22, 0x39, 0x45, 0x5e, 0x7a, 0xfe, 0x3b, 0x06, 0x16, 0x10, 0x02, 0x88, 0xcc, 0x5a, 0x72, 0x3b },
+	{ 0x3e, 0xe5, 0x00, 0xc5, 0xc8, 0xd6, 0x34, 0x79, 0x71, 0x71, 0x63, 0xe5, 0x5c, 0x5c, 0x45, 0x22 },
+	{ 0xd5, 0xe3, 0x8b, 0xf1, 0x5f, 0x16, 0xd9, 0x0e, 0x3e, 0x21, 0x40, 0x41, 0xd7, 0x74, 0xda, 0xa8 },
+	{ 0xb1, 0xf4, 0x06, 0x6e, 0x6f, 0x4f, 0x18, 0x7d, 0xfe, 0x5f, 0x2a, 0xd1, 0xb1, 0x78, 0x19, 0xd0 },
+	{ 0x6e, 0xf4, 0xcc, 0x4d, 0xe4, 0x9b, 0x11, 0x06, 0x5d, 0x7a, 0xf2, 0x90, 0x98, 0x54, 0x79, 0x4a },
+	{ 0xac, 0x86, 0xbc, 0x60, 0x6b, 0x66, 0x40, 0xc3, 0x09, 0xe7, 0x82, 0xf2, 0x32, 0xbf, 0x36, 0x7f },
+	{ 0x36, 0xaf, 0xf0, 0xef, 0x7b, 0xf3, 0x28, 0x07, 0x72, 0xcf, 0x4c, 0xac, 0x80, 0xa0, 0xd2, 0xb2 },
+	{ 0x1f, 0x8e, 0xed, 0xea, 0x0f, 0x62, 0xa1, 0x40, 0x6d, 0x58, 0xcf, 0xc3, 0xec, 0xea, 0x72, 0xcf },
+	{ 0xab, 0xf4, 0x15, 0x4a, 0x33, 0x75, 0xa1, 0xd3, 0xe6, 0xb1, 0xd4, 0x54, 0x43, 0x8f, 0x95, 0xa6 },
+	{ 0x96, 0xf9, 0x6e, 0x9d, 0x60, 0x7f, 0x66, 0x15, 0xfc, 0x19, 0x20, 0x61, 0xee, 0x64, 0x8b, 0x07 },
+	{ 0xcf, 0x37, 0xcd, 0xaa, 0xa0, 0xd2, 0xd5, 0x36, 0xc7, 0x18, 0x57, 0x63, 0x4c, 0x79, 0x20, 0x64 },
+	{ 0xfb, 0xd6, 0x64, 0x0c, 0x80, 0x24, 0x5c, 0x2b, 0x80, 0x53, 0x73, 0xf1, 0x30, 0x70, 0x31, 0x27 },
+	{ 0x8d, 0x6a, 0x8a, 0xfe, 0x55, 0xa6, 0xe4, 0x81, 0xba, 0xda, 0xe0, 0xd1, 0x46, 0xf4, 0x36, 0xdb },
+	{ 0x6a, 0x49, 0x81, 0xf2, 0x91, 0x5e, 0x3e, 0x68, 0xaf, 0x6c, 0x22, 0x38, 0x5d, 0xd0, 0x67, 0x56 },
+	{ 0x42, 0xa1, 0x13, 0x6e, 0x5f, 0x8d, 0x8d, 0x21, 0xd3, 0x10, 0x19, 0x98, 0x64, 0x2d, 0x57, 0x3b },
+	{ 0x9b, 0x47, 0x15, 0x96, 0xdc, 0x69, 0xae, 0x15, 0x86, 0xce, 0xe6, 0x15, 0x8b, 0x0b, 0x01, 0x81 },
+	{ 0x75, 0x36, 0x65, 0xc4, 0xaf, 0x1e, 0xff, 0x33, 0xaa, 0x8b, 0x62, 0x8b, 0xf8, 0x74, 0x1c, 0xfd },
+	{ 0x9a, 0x68, 0x2a, 0xcf, 0x40, 0xbe, 0x01, 0xf5, 0xb2, 0xa4, 0x19, 0x3c, 0x9a, 0x82, 0x40, 0x4d },
+	{ 0x54, 0xfa, 0xfe, 0x26, 0xe4, 0x28, 0x7f, 0x17, 0xd1, 0x93, 0x5f, 0x87, 0xeb, 0x9a, 0xde, 0x01 },
+	{ 0x49, 0xd5, 0x41, 0xb2, 0xe7, 0x4c, 0xfe, 0x73, 0xe6, 0xa8, 0xe8, 0x22, 0x5f, 0x7b, 0xd4, 0x49 },
+	{ 0x11, 0xa4, 0x55, 0x30, 0xf6, 0x24, 0xff, 0x6f, 0x76, 0xa1, 0xb3, 0x82, 0x66, 0x26, 0xff, 0x7b },
+	{ 0xf9, 0x6b, 0x0c, 0x4a, 0x8b, 0xc6, 0xc8, 0x61, 0x30, 0x28, 0x9f, 0x60, 0xb4, 0x3b, 0x8f, 0xba },
+	{ 0x48, 0xc7, 0xd0, 0xe8, 0x08, 0x34, 0xeb, 0xdc, 0x35, 0xb6, 0x73, 0x5f, 0x76, 0xb4, 0x6c, 0x8b },
+	{ 0x24, 0x63, 0x53, 0x1a, 0xb5, 0x4d, 0x66, 0x95, 0x5e, 0x73, 0xed, 0xc4, 0xcb, 0x8e, 0xaa, 0x45 },
+	{ 0xac, 0x9b, 0xd8, 0xe2, 0x53, 0x04, 0x69, 0x13, 0x4b, 0x9d, 0x5b, 0x06, 0x5d, 0x4f, 0x56, 0x5b },
+	{ 0x3f, 0x5f, 0x91, 0x06, 0xd0, 0xe5, 0x2f, 0x97, 0x3d, 0x48, 0x90, 0xe6, 0xf3, 0x7e, 0x8a, 0x00 },
+	{ 0x20, 0xeb, 0xc8, 0x6f, 0x13, 0x04, 0xd2, 0x72, 0xe2, 0xe2, 0x07, 0xe5, 0x9d, 0xb6, 0x39, 0xf0 },
+	{ 0xe6, 0x7a, 0xe6, 0x42, 0x6b, 0xf9, 0x52, 0x6c, 0x97, 0x2c, 0xff, 0x07, 0x2b, 0x52, 0x25, 0x2c },
+	{ 0x1a, 0x51, 0x8d, 0xdd, 0xaf, 0x9e, 0xfa, 0x0d, 0x00, 0x2c, 0xc5, 0x8d, 0x10, 0x7e, 0xdf, 0xc8 },
+	{ 0xea, 0xd7, 0x31, 0xaf, 0x4d, 0x3a, 0x2f, 0xe3, 0xb3, 0x4b, 0xed, 0x04, 0x79, 0x42, 0xa4, 0x9f },
+	{ 0xb1, 0xd4, 0xef, 0xe4, 0x02, 0x42, 0xf8, 0x3e, 0x93, 0xb6, 0xc8, 0xd7, 0xef, 0xb5, 0xea, 0xe9 },
+	{ 0xcd, 0x2b, 0x1f, 0xec, 0x11, 0xfd, 0x90, 0x6c, 0x5c, 0x76, 0x30, 0x09, 0x94, 0x43, 0x61, 0x0a },
+	{ 0xa1, 0x85, 0x3f, 0xe4, 0x7f, 0xe2, 0x92, 0x89, 0xd1, 0x53, 0x16, 0x1d, 0x06, 0x38, 0x7d, 0x21 },
+	{ 0x46, 0x32, 0x15, 0x41, 0x79, 0xa5, 0x55, 0xc1, 0x7e, 0xa6, 0x04, 0xd0, 0x88, 0x9f, 0xab, 0x14 },
+	{ 0xdd, 0x27, 0xca, 0xc6, 0x40, 0x1a, 0x02, 0x2e, 0x8f, 0x38, 0xf9, 0xf9, 0x3e, 0x77, 0x44, 0x17 },
+	{ 0xc0, 0x90, 0x31, 0x3e, 0xb9, 0x86, 0x74, 0xf3, 0x5f, 0x31, 0x23, 0x38, 0x5f, 0xb9, 0x5d, 0x4d },
+	{ 0xcc, 0x35, 0x26, 0x26, 0x2b, 0x92, 0xf0, 0x2e, 0xdc, 0xe5, 0x48, 0xf7, 0x16, 0xb9, 0xf4, 0x5c },
+	{ 0xc0, 0x83, 0x8d, 0x1a, 0x2b, 0x16, 0xa7, 0xc7, 0xf0, 0xdf, 0xcc, 0x43, 0x3c, 0x39, 0x9c, 0x33 },
+	{ 0x0d, 0x9a, 0xc7, 0x56, 0xeb, 0x29, 0x76, 0x95, 0xee, 0xd4, 0xd3, 0x82, 0xeb, 0x12, 0x6d, 0x26 },
+	{ 0x56, 0xed, 0xe9, 0xdd, 0xa3, 0xf6, 0xf1, 0x41, 0xbf, 0xf1, 0x75, 0x7f, 0xa6, 0x89, 0xc3, 0xe1 },
+	{ 0x76, 0x8f, 0x52, 0x0e, 0xfe, 0x0f, 0x23, 0xe6, 0x1d, 0x3e, 0xc8, 0xad, 0x9c, 0xe9, 0x17, 0x74 },
+	{ 0xb1, 0x14, 0x4d, 0xdf, 0xa7, 0x57, 0x55, 0x21, 0x33, 0x90, 0xe7, 0xc5, 0x96, 0x66, 0x04, 0x90 },
+	{ 0x1d, 0x7c, 0x0c, 0x40, 0x40, 0xb3, 0x55, 0xb9, 0xd1, 0x07, 0xa9, 0x93, 0x25, 0xe3, 0xb0, 0x50 },
+	{ 0xd8, 0xe2, 0xbb, 0x1a, 0xe8, 0xee, 0x3d, 0xcf, 0x5b, 0xf7, 0xd6, 0xc3, 0x8d, 0xa8, 0x2a, 0x1a },
+	{ 0xfa, 0xf8, 0x2d, 0x17, 0x8a, 0xf2, 0x5a, 0x98, 0x86, 0xa4, 0x7e, 0x7f, 0x78, 0x9b, 0x98, 0xd7 },
+	{ 0x9b, 0x58, 0xdb, 0xfd, 0x77, 0xfe, 0x5a, 0xca, 0x9c, 0xfc, 0x19, 0x0c, 0xd1, 0xb8, 0x2d, 0x19 },
+	{ 0x77, 0xf3, 0x92, 0x08, 0x90, 0x42, 0xe4, 0x78, 0xac, 0x16, 0xc0, 0xc8, 0x6a, 0x0b, 0x5d, 0xb5 },
+	{ 0x19, 0xf0, 0x8e, 0x34, 0x20, 0xee, 0x69, 0xb4, 0x77, 0xca, 0x14, 0x20, 0x28, 0x1c, 0x47, 0x82 },
+	{ 0xa1, 0xb1, 0x9b, 0xee, 0xe4, 0xe1, 0x17, 0x13, 0x9f, 0x74, 0xb3, 0xc5, 0x3f, 0xdc, 0xb8, 0x75 },
+	{ 0xa3, 0x7a, 0x58, 0x69, 0xb2, 0x18, 0xa9, 0xf3, 0xa0, 0x86, 0x8d, 0x19, 0xae, 0xa0, 0xad, 0x6a },
+	{ 0xbc, 0x35, 0x94, 0xe8, 0x65, 0xbc, 0xd0, 0x26, 0x1b, 0x13, 0x20, 0x27, 0x31, 0xf3, 0x35, 0x80 },
+	{ 0x81, 0x14, 0x41, 0xce, 0x1d, 0x30, 0x9e, 0xee, 0x71, 0x85, 0xe8, 0xc7, 0x52, 0xc0, 0x75, 0x57 },
+	{ 0x95, 0x99, 0x71, 0xce, 0x41, 0x34, 0x19, 0x05, 0x63, 0x51, 0x8e, 0x70, 0x0b, 0x98, 0x74, 0xd1 },
+	{ 0x76, 0xb5, 0x61, 0x4a, 0x04, 0x27, 0x07, 0xc9, 0x8e, 0x21, 0x32, 0xe2, 0xe8, 0x05, 0xfe, 0x63 },
+	{ 0x7d, 0x9f, 0xa6, 0xa5, 0x75, 0x30, 0xd0, 0xf0, 0x36, 0xfe, 0xc3, 0x1c, 0x23, 0x0b, 0x0c, 0xc6 },
+	{ 0x96, 0x41, 0x53, 0xa8, 0x3b, 0xf6, 0x98, 0x9a, 0x4b, 0xa8, 0x0d, 0xaa, 0x91, 0xc3, 0xe0, 0x81 },
+	{ 0xa0, 0x13, 0x01, 0x4d, 0x4c, 0xe8, 0x05, 0x4c, 0xf2, 0x59, 0x1d, 0x06, 0xf6, 0xf2, 0xf1, 0x76 },
+	{ 0xd1, 0xc5, 0xf6, 0x39, 0x9b, 0xf3, 0x82, 0x50, 0x2e, 0x38, 0x5e, 0xee, 0x14, 0x74, 0xa8, 0x69 },
+	{ 0x00, 0x07, 0xe2, 0x0b, 0x82, 0x98, 0xec, 0x35, 0x4f, 0x0f, 0x5f, 0xe7, 0x47, 0x0f, 0x36, 0xbd },
+	{ 0xb9, 0x5b, 0xa0, 0x5b, 0x33, 0x2d, 0xa6, 0x1e, 0xf6, 0x3a, 0x2b, 0x31, 0xfc, 0xad, 0x98, 0x79 },
+	{ 0x46, 0x20, 0xa4, 0x9b, 0xd9, 0x67, 0x49, 0x15, 0x61, 0x66, 0x9a, 0xb2, 0x5d, 0xce, 0x45, 0xf4 },
+	{ 0x12, 0xe7, 0x12, 0x14, 0xae, 0x8e, 0x04, 0xf0, 0xbb, 0x63, 0xd7, 0x42, 0x5c, 0x6f, 0x14, 0xd5 },
+	{ 0x4c, 0xc4, 0x2f, 0xc1, 0x40, 0x7b, 0x00, 0x8f, 0xe3, 0x50, 0x90, 0x7c, 0x09, 0x2e, 0x80, 0xac },
+	{ 0x08, 0xb2, 0x44, 0xce, 0x7c, 0xbc, 0x8e, 0xe9, 0x7f, 0xbb, 0xa8, 0x08, 0xcb, 0x14, 0x6f, 0xda },
+	{ 0x39, 0xb3, 0x33, 0xe8, 0x69, 0x4f, 0x21, 0x54, 0x6a, 0xd1, 0xed, 0xd9, 0xd8, 0x7e, 0xd9, 0x5b },
+	{ 0x3b, 0x27, 0x1f, 0x8a, 0xb2, 0xe6, 0xe4, 0xa2, 0x0b, 0xa8, 0x09, 0x0f, 0x43, 0xba, 0x78, 0xf3 },
+	{ 0x9a, 0xd9, 0x83, 0xf3, 0xbf, 0x65, 0x1c, 0xd0, 0x39, 0x3f, 0x0a, 0x73, 0xcc, 0xcd, 0xea, 0x50 },
+	{ 0x8f, 0x47, 0x6c, 0xbf, 0xf7, 0x5c, 0x1f, 0x72, 0x5c, 0xe1, 0x8e, 0x4b, 0xbc, 0xd1, 0x9b, 0x32 },
+	{ 0x90, 0x5b, 0x62, 0x67, 0xf1, 0xd6, 0xab, 0x53, 0x20, 0x83, 0x5a, 0x13, 0x3f, 0x09, 0x6f, 0x2a },
+	{ 0x14, 0x5b, 0x60, 0xd6, 0xd0, 0x19, 0x3c, 0x23, 0xf4, 0x22, 0x18, 0x48, 0xa8, 0x92, 0xd6, 0x1a },
+	{ 0x55, 0xcf, 0xb3, 0xfb, 0x6d, 0x75, 0xca, 0xd0, 0x44, 0x5b, 0xbc, 0x8d, 0xaf, 0xa2, 0x5b, 0x0f },
+	{ 0x7b, 0x8e, 0x70, 0x98, 0xe3, 0x57, 0xef, 0x71, 0x23, 0x7d, 0x46, 0xd8, 0xb0, 0x75, 0xb0, 0xf5 },
+	{ 0x2b, 0xf2, 0x72, 0x29, 0x90, 0x1e, 0xb4, 0x0f, 0x2d, 0xf9, 0xd8, 0x39, 0x8d, 0x15, 0x05, 0xae },
+	{ 0x83, 0xa6, 0x34, 0x02, 0xa7, 0x7f, 0x9a, 0xd5, 0xc1, 0xe9, 0x31, 0xa9, 0x31, 0xec, 0xd7, 0x06 },
+	{ 0x6f, 0x8b, 0xa6, 0x52, 0x11, 0x52, 0xd3, 0x1f, 0x2b, 0xad, 0xa1, 0x84, 0x3e, 0x26, 0xb9, 0x73 },
+	{ 0xe5, 0xc3, 0xb8, 0xe3, 0x0f, 0xd2, 0xd8, 0xe6, 0x23, 0x9b, 0x17, 0xb4, 0x4b, 0xd2, 0x3b, 0xbd },
+	{ 0x1a, 0xc1, 0xf7, 0x10, 0x2c, 0x59, 0x93, 0x3e, 0x8b, 0x2d, 0xdc, 0x3f, 0x14, 0xe9, 0x4b, 0xaa },
+	{ 0x21, 0xd9, 0xba, 0x49, 0xf2, 0x76, 0xb4, 0x5f, 0x11, 0xaf, 0x8f, 0xc7, 0x1a, 0x08, 0x8e, 0x3d },
+	{ 0x64, 0x9f, 0x1c, 0xdd, 0xc3, 0x79, 0x2b, 0x46, 0x38, 0x63, 0x5a, 0x39, 0x2b, 0xc9, 0xba, 0xde },
+	{ 0xe2, 0x77, 0x5e, 0x4b, 0x59, 0xc1, 0xbc, 0x2e, 0x31, 0xa2, 0x07, 0x8c, 0x11, 0xb5, 0xa0, 0x8c },
+	{ 0x2b, 0xe1, 0xfa, 0xe5, 0x04, 0x8a, 0x25, 0x58, 0x2a, 0x67, 0x9c, 0xa1, 0x09, 0x05, 0xeb, 0x80 },
+	{ 0xda, 0x86, 0xf2, 0x92, 0xc6, 0xf4, 0x1e, 0xa3, 0x4f, 0xb2, 0x06, 0x8d, 0xf7, 0x5e, 0xcc, 0x29 },
+	{ 0x22, 0x0d, 0xf1, 0x9f, 0x85, 0xd6, 0x9b, 0x1b, 0x56, 0x2f, 0xa6, 0x9a, 0x3c, 0x5b, 0xec, 0xa5 },
+	{ 0x1f, 0x11, 0xd5, 0xd0, 0x35, 0x5e, 0x0b, 0x55, 0x6c, 0xcd, 0xb6, 0xc7, 0xf5, 0x08, 0x3b, 0x4d },
+	{ 0x62, 0x52, 0x6b, 0x78, 0xbe, 0x79, 0xcb, 0x38, 0x46, 0x33, 0xc9, 0x1f, 0x83, 0xb4, 0x15, 0x1b },
+	{ 0x90, 0xdd, 0xbc, 0xb9, 0x50, 0x84, 0x35, 0x92, 0xdd, 0x47, 0xbb, 0xef, 0x00, 0xfd, 0xc8, 0x76 },
+	{ 0x2f, 0xd0, 0xe4, 0x1c, 0x5b, 0x84, 0x02, 0x27, 0x73, 0x54, 0xa7, 0x39, 0x1d, 0x26, 0x18, 0xe2 },
+	{ 0x3c, 0xdf, 0x13, 0xe7, 0x2d, 0xee, 0x4c, 0x58, 0x1b, 0xaf, 0xec, 0x70, 0xb8, 0x5f, 0x96, 0x60 },
+	{ 0xaf, 0xa2, 0xff, 0xc1, 0x37, 0x57, 0x70, 0x92, 0xe2, 0xb6, 0x54, 0xfa, 0x19, 0x9d, 0x2c, 0x43 },
+	{ 0x8d, 0x68, 0x3e, 0xe6, 0x3e, 0x60, 0xd2, 0x08, 0xe3, 0x43, 0xce, 0x48, 0xdb, 0xc4, 0x4c, 0xac },
+	{ 0x70, 0x5a, 0x4e, 0xf8, 0xba, 0x21, 0x33, 0x72, 0x9c, 0x20, 0x18, 0x5c, 0x3d, 0x3a, 0x47, 0x63 },
+	{ 0x08, 0x61, 0xa8, 0x61, 0xc3, 0xdb, 0x4e, 0x94, 0x19, 0x42, 0x11, 0xb7, 0x7e, 0xd7, 0x61, 0xb9 },
+	{ 0x4b, 0x00, 0xc2, 0x7e, 0x8b, 0x26, 0xda, 0x7e, 0xab, 0x9d, 0x3a, 0x88, 0xde, 0xc8, 0xb0, 0x31 },
+	{ 0x5f, 0x39, 0x7b, 0xf0, 0x30, 0x84, 0x82, 0x0c, 0xc8, 0x81, 0x0d, 0x52, 0xe5, 0xb6, 0x66, 0xe9 },
+	{ 0x63, 0xfa, 0xfa, 0xbb, 0x72, 0xc0, 0x7b, 0xfb, 0xd3, 0xdd, 0xc9, 0xb1, 0x20, 0x31, 0x04, 0xb8 },
+	{ 0x68, 0x3e, 0x21, 0x40, 0x58, 0x5b, 0x18, 0x45, 0x2d, 0xd4, 0xff, 0xbb, 0x93, 0xc9, 0x5d, 0xf9 },
+	{ 0x28, 0x68, 0x94, 0xe4, 0x8e, 0x53, 0x7f, 0x87, 0x63, 0xb5, 0x67, 0x07, 0xd7, 0xd1, 0x55, 0xc8 },
+	{ 0xa4, 0x23, 0xde, 0xab, 0xc1, 0x73, 0xdc, 0xf7, 0xe2, 0xc4, 0xc5, 0x3e, 0x77, 0xd3, 0x7c, 0xd1 },
+	{ 0xeb, 0x81, 0x68, 0x31, 0x3e, 0x1c, 0xfd, 0xfd, 0xb5, 0xe9, 0x86, 0xd5, 0x42, 0x9c, 0xf1, 0x72 },
+	{ 0x27, 0x12, 0x7d, 0xaa, 0xfc, 0x9a, 0xcc, 0xd2, 0xfb, 0x33, 0x4e, 0xc3, 0xeb, 0xa5, 0x23, 0x23 },
+	{ 0xee, 0x07, 0x15, 0xb9, 0x6f, 0x72, 0xe3, 0xf7, 0xa2, 0x2a, 0x50, 0x64, 0xfc, 0x59, 0x2f, 0x4c },
+	{ 0x29, 0xee, 0x52, 0x67, 0x70, 0xf2, 0xa1, 0x1d, 0xcf, 0xa9, 0x89, 0xd1, 0xce, 0x88, 0x83, 0x0f },
+	{ 0x04, 0x93, 0x37, 0x0e, 0x05, 0x4b, 0x09, 0x87, 0x11, 0x30, 0xfe, 0x49, 0xaf, 0x73, 0x0a, 0x5a },
+	{ 0x9b, 0x7b, 0x94, 0x0f, 0x6c, 0x50, 0x9f, 0x9e, 0x44, 0xa4, 0xee, 0x14, 0x04, 0x48, 0xee, 0x46 },
+	{ 0x29, 0x15, 0xbe, 0x4a, 0x1e, 0xcf, 0xdc, 0xbe, 0x3e, 0x02, 0x38, 0x11, 0xa1, 0x2b, 0xb6, 0xc7 },
+	{ 0x72, 0x40, 0xe5, 0x24, 0xbc, 0x51, 0xd8, 0xc4, 0xd4, 0x40, 0xb1, 0xbe, 0x55, 0xd1, 0x06, 0x2c },
+	{ 0xda, 0x63, 0x03, 0x9d, 0x38, 0xcb, 0x46, 0x12, 0xb2, 0xdc, 0x36, 0xba, 0x26, 0x68, 0x4b, 0x93 },
+	{ 0x0f, 0x59, 0xcb, 0x5a, 0x4b, 0x52, 0x2e, 0x2a, 0xc5, 0x6c, 0x1a, 0x64, 0xf5, 0x58, 0xad, 0x9a },
+	{ 0x7b, 0xfe, 0x9d, 0x87, 0x6c, 0x6d, 0x63, 0xc1, 0xd0, 0x35, 0xda, 0x8f, 0xe2, 0x1c, 0x40, 0x9d },
+	{ 0xac, 0xda, 0xce, 0x80, 0x78, 0xa3, 0x2b, 0x1a, 0x18, 0x2b, 0xfa, 0x49, 0x87, 0xca, 0x13, 0x47 },
+};
+const unsigned int ECBVarTxt256_count = 2 * sizeof(ECBVarTxt256) / sizeof(ECBVarTxt256[0]);
@@ -53,18 +53,26 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 // aes.c
 //
 // This piece of code is part of the mitigation working group benchmark
-// suite.  This program executes a 128-AES code from Texas Instruments
-// using the National Institute of Standards and Technology.  While we
-// have converted the test vector suites to header files, two codes need
-// to be downloaded and linked to:
+// suite.  This program executes AES-128, AES-192 and AES-256 using the
+// test vectors from the National Institute of Standards and Technology.  The AES engine
+// lives in aes_core.c (T-table or compact S-box, see aes_core.h) and
+// replaces the TI AES-128 code this test originally used.  The test vector
+// suites have been converted to header files.  aes_mct_mode swaps them for
+// NIST Monte Carlo chains, and aes_stream_mode runs CBC, CTR (aes_modes.c)
+// and GCM (aes_gcm.c) over a large buffer.  One code needs to be
+// downloaded and linked to:
 //
-// TI AES-128 code: http://www.ti.com/tool/AES-128
 // Tiny printf: http://www.43oh.com/forum/viewtopic.php?f=10&t=1732
 
-// Download those files and compile them with the rest of the AES code.
+// Download that file and compile it with the rest of the AES code.
 //
 // This software is otimized for TI microcontrollers, specifically the
-// MSP430F2619.
+// MSP430F2619.  When __MSP430__ is not defined the part initialization is
+// skipped and sendByte() writes to stdout, so the same code can be built
+// and profiled on a Linux host.  On a host aes_threaded spreads the test
+// over pinned worker threads, one per core by default.  Building with
+// aes_checkpoints 1 (aes_core.h) adds the first faulty round to the error
+// blocks of the KAT suites.
 //
 // The output is designed to go out the UART at a speed of 9,600 baud
 // and uses a tiny printf to reduce printf footprint.  All of the
@@ -74,30 +82,222 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 //*****************************************************************************
 
 
+#ifdef __MSP430__
 #include <msp430.h>
+#else
+#define _GNU_SOURCE
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#endif
 #include <string.h>
-#include "TI_aes_128.h"
+#include "aes_core.h"
+#include "aes_modes.h"
+#include "aes_gcm.h"
+#include "aes_bitslice.h"
+#include "aes_ni.h"
+#include "aes_ref.h"
 #include "ECBGFSbox128.h"
 #include "ECBKeySbox128.h"
 #include "ECBVarKey128.h"
 #include "ECBVarTxt128.h"
+#include "ECBVarKey192.h"
+#include "ECBVarTxt192.h"
+#include "ECBVarKey256.h"
+#include "ECBVarTxt256.h"
+#include "FIPS197.h"
+#include "ECBMCT.h"
+#include "SP800_38A.h"
+#include "GCMSpec.h"
 
 //all of the printing is YAML parsable.  The robust printing variable solely determines how much text you get.
 #define robust_printing		1
 
-unsigned long ind = 0;
-int local_errors = 0;
-int in_block = 0;
+//1 runs every 128-bit suite whose count is a multiple of aes_bs_blocks (the
+//VarKey/VarTxt suites) through the bitsliced engine, aes_bs_blocks vectors
+//at a time.
+#define aes_batch_mode		0
 
+//1 expands the round keys of every vector once at startup (one schedule
+//per vector of aes_suites, about 480 KB, so hosts only), 0 expands them
+//once per vector.  Either way
+//the same schedule serves the encryption and the decryption.  An upset in
+//the cache shows up as the same vector failing on every pass.
+#ifdef __MSP430__
+#define aes_key_cache		0
+#else
+#define aes_key_cache		1
+#endif
 
+//1 runs the NIST Monte Carlo chains of ECBMCT.h instead of the suites
+//below.  Each record is aes_mct_chain dependent encryptions checked only at
+//the end, then as many decryptions from the golden back to the record's
+//plaintext, so nearly all of the time goes to the cipher and an upset
+//anywhere along a chain reaches the checked output.
+#define aes_mct_mode		0
+#define aes_mct_chain		1000
+
+//1 streams a buffer of aes_stream_bytes (a multiple of 16) through CBC, CTR
+//and GCM instead of running the suites.  Each mode first checks its
+//published examples (SP 800-38A, the GCM specification), then encrypts the
+//buffer, checks a digest of the ciphertext (the CBC-MAC, or the GCM tag)
+//against the golden taken at startup, and decrypts it back to the fill
+//pattern.  The heartbeat carries the bytes per second of the encryptions
+//and decryptions.
+#define aes_stream_mode		0
+#ifdef __MSP430__
+#define aes_stream_bytes	1024UL
+#else
+#define aes_stream_bytes	(16UL << 20)
+#endif
+
+//1 runs the selected test on aes_workers threads (0 = one per CPU the
+//process may use), each pinned to its own CPU.  The KAT vectors, the Monte
+//Carlo records are dealt out round robin and the stream buffer is split in
+//equal parts.  Every thread keeps its own counters and its error blocks
+//carry a t: line with the thread number.  The main thread prints the
+//summed heartbeat once a second.  Hosts only; build with -pthread.
+#define aes_threaded		0
+#define aes_workers		0
+#define aes_max_workers		256
+
+#if aes_threaded
+#define aes_tls			__thread
+#else
+#define aes_tls
+#endif
+
+#ifdef __MSP430__
+#define hw_name			"msp430f2619"
+#else
+#define hw_name			"host"
+#endif
+
+//the suites run in this order on every pass.  A header made by
+//tools/rsp2h from a NIST .rsp file goes in with aes_packed_suite().
+const aes_kat_suite aes_suites[] = {
+  aes_packed_suite(ECBGFSbox128, 128),
+  aes_packed_suite(ECBKeySbox128, 128),
+  aes_gen_suite(ECBVarKey128, 128, aes_gen_varkey),
+  aes_gen_suite(ECBVarTxt128, 128, aes_gen_vartxt),
+  aes_suite(FIPS197_128, 128),
+  aes_suite(FIPS197_192, 192),
+  aes_gen_suite(ECBVarKey192, 192, aes_gen_varkey),
+  aes_gen_suite(ECBVarTxt192, 192, aes_gen_vartxt),
+  aes_suite(FIPS197_256, 256),
+  aes_gen_suite(ECBVarKey256, 256, aes_gen_varkey),
+  aes_gen_suite(ECBVarTxt256, 256, aes_gen_vartxt),
+};
+
+#define suite_count		(sizeof(aes_suites) / sizeof(aes_suites[0]))
+
+#if aes_mct_mode
+const aes_mct_suite aes_mct_suites[] = {
+  aes_mct(ECBMCT128, 128),
+  aes_mct(ECBMCT192, 192),
+  aes_mct(ECBMCT256, 256),
+};
+
+#define mct_suite_count		(sizeof(aes_mct_suites) / sizeof(aes_mct_suites[0]))
+#endif
+
+#if aes_stream_mode
+unsigned char stream_buf[aes_stream_bytes];
+//this thread's part of the buffer
+aes_tls unsigned long stream_off = 0;
+aes_tls unsigned long stream_len = aes_stream_bytes;
+//CBC, CTR and GCM digests of the encrypted buffer
+#define stream_modes		3
+aes_tls unsigned char stream_golden[stream_modes][16];
+//the GCM context also holds the key schedule of CBC and CTR
+aes_tls aes_gcm_ctx stream_gcm;
+aes_tls aes_key_schedule stream_mac_ks;
+//time spent in the cipher, the fill and the checks are left out
+aes_tls unsigned long stream_us = 0;
+#endif
+
+#if aes_mct_mode
+#define aes_mode_name		"mct"
+#elif aes_stream_mode
+#define aes_mode_name		"stream"
+#else
+#define aes_mode_name		"kat"
+#endif
+
+aes_tls unsigned long ind = 0;
+aes_tls int local_errors = 0;
+aes_tls int in_block = 0;
+
+//this thread takes work item i when i % shard_count == shard_id
+aes_tls unsigned int shard_id = 0;
+aes_tls unsigned int shard_count = 1;
+
+//generated keys and plaintexts are built here
+aes_tls unsigned char scratch_key[32];
+aes_tls unsigned char scratch_plain[16];
+
+#if aes_batch_mode
+aes_tls unsigned char batch_key[aes_bs_blocks * 16];
+aes_tls unsigned char batch_enc[aes_bs_blocks * 16];
+aes_tls unsigned char batch_dec[aes_bs_blocks * 16];
+#endif
+
+#if aes_threaded
+typedef struct {
+  pthread_t thread;
+  int id;
+  int cpu;
+  //published after every vector for the main thread's heartbeat
+  volatile unsigned long ind;
+  volatile int errors;
+  volatile unsigned long long bytes;
+  volatile unsigned long long us;
+} aes_worker;
+
+aes_worker workers[aes_max_workers];
+int worker_count = 0;
+aes_tls aes_worker *worker;
+pthread_mutex_t print_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+#if aes_key_cache
+aes_key_schedule *key_cache;		//a schedule per vector, suite after suite
+#endif
+
+
+void aes_run(void);
 void aes_test(void);
-void check_arrays(char array1[], char array2[], int lim, char pre);
+void aes_progress(int total_errors, unsigned long every);
+void aes_vector_end(void);
+void aes_localize(const unsigned char *key, int key_bits, int errors_before, char pre);
+void aes_print_lock(void);
+void aes_print_unlock(void);
+void aes_plan_workers(void);
+void aes_run_workers(void);
+void *aes_worker_main(void *arg);
+void aes_mct_test(void);
+void aes_stream_test(void);
+void aes_stream_fill(unsigned long off, unsigned char *p, unsigned long len);
+void aes_stream_crypt(unsigned char *buf, unsigned long len, int mode, unsigned char dir, unsigned char *tag);
+void aes_stream_kat(int mode);
+void aes_stream_pass(int mode, unsigned char *mac);
+unsigned long aes_clock_us(void);
+void aes_kat_get(const aes_kat_suite *suite, unsigned int j, aes_kat_vector *vec);
+int aes_key_cache_alloc(void);
+void aes_kat_crypt(const aes_kat_vector *vec, const aes_key_schedule *ks, const unsigned char *in, unsigned char *out, unsigned char dir);
+void aes_batch_load(const aes_kat_suite *suite, unsigned int first);
+void aes_batch_enc_dec(unsigned char *state, const unsigned char *key, unsigned char dir);
+void check_arrays(const unsigned char array1[], const unsigned char array2[], int lim, char pre);
 void sendByte(char);
 void printf(char *, ...);
 void initUART(void);
 void initMSP430();
 
-void check_arrays(char *array1, char *array2, int lim, char pre) {
+//the values are printed as char, as they always have been, so the YAML
+//output keeps its format
+void check_arrays(const unsigned char *array1, const unsigned char *array2, int lim, char pre) {
   int first_error = 0;
   int i = 0;
   int numberOfErrors = 0;
@@ -107,19 +307,23 @@ void check_arrays(char *array1, char *array2, int lim, char pre) {
       //block of code for printing errors
       if (!first_error) {
 	if (!in_block && robust_printing) {
+	  aes_print_lock();
 	  printf(" - i: %n\r\n", ind);
-	  printf("   %c: {%x: %x,", pre, array1[i], array2[i]);
+#if aes_threaded
+	  printf("   t: %i\r\n", worker->id);
+#endif
+	  printf("   %c: {%x: %x,", pre, (char)array1[i], (char)array2[i]);
 	  first_error = 1;
 	  in_block = 1;  
 	}
 	else if (in_block && robust_printing){
-	  printf("   %c: {%x: %x,", pre, array1[i], array2[i]);
+	  printf("   %c: {%x: %x,", pre, (char)array1[i], (char)array2[i]);
 	  first_error = 1;
 	}
       }
       else{
 	if (robust_printing)
-	  printf("%x: %x,", array1[i], array2[i]);
+	  printf("%x: %x,", (char)array1[i], (char)array2[i]);
       }
       local_errors++;
       numberOfErrors++;
@@ -134,7 +338,11 @@ void check_arrays(char *array1, char *array2, int lim, char pre) {
   if (!robust_printing && numberOfErrors > 0) {
     //less prolific printing
     if (!in_block) {
+      aes_print_lock();
       printf(" - i: %n\r\n", ind);
+#if aes_threaded
+      printf("   t: %i\r\n", worker->id);
+#endif
       printf("   %c: %i\r\n", pre, numberOfErrors);
       in_block = 1;
     }
@@ -144,118 +352,662 @@ void check_arrays(char *array1, char *array2, int lim, char pre) {
   }
 }
 
+#if aes_threaded
+//an error block is printed under the lock from its " - i:" line until
+//aes_vector_end(), so blocks from different threads never interleave
+void aes_print_lock(void) {
+  pthread_mutex_lock(&print_lock);
+}
+
+void aes_print_unlock(void) {
+  pthread_mutex_unlock(&print_lock);
+}
+#else
+void aes_print_lock(void) {
+}
+
+void aes_print_unlock(void) {
+}
+#endif
+
+#if aes_checkpoints
+//after a failed check of a single block, name the first round whose state
+//differs from the reference ("rE: 3"); -1 says every round was right, so
+//the error came in with the block's input or arose after the cipher
+void aes_localize(const unsigned char *key, int key_bits, int errors_before, char pre) {
+  if (local_errors != errors_before) {
+    printf("   r%c: %i\r\n", pre, aes_ckpt_first_fault(key, key_bits));
+  }
+}
+#endif
+
+//close the YAML block of the vector just checked
+void aes_vector_end(void) {
+  if (in_block) {
+    aes_print_unlock();
+  }
+  local_errors = 0;
+  in_block = 0;
+}
+
+//print an "I am alive" message every once in a awhile, or hand the counters
+//to the main thread, which prints the heartbeat for all of the workers
+void aes_progress(int total_errors, unsigned long every) {
+#if aes_threaded
+  //the main thread prints on its own clock
+  (void)every;
+  worker->ind = ind;
+  worker->errors = total_errors;
+#else
+  if (ind % every == 0 && ind != 0) {
+    printf("# %n, %i\r\n", ind, total_errors);
+  }
+#endif
+}
+
+//point vec at vector j of suite.  Stored and packed records are used in
+//place; a generated vector gets its key and plaintext built from its bit
+//prefix and points at the stored ciphertext.
+void aes_kat_get(const aes_kat_suite *suite, unsigned int j, aes_kat_vector *vec) {
+  unsigned int i = 0;
+  unsigned int bits = 0;
+  unsigned int stride = 0;
+  const unsigned char *rec;
+  unsigned char *pattern;
+  const aes_packed *packed = suite->packed;
+
+  vec->iv = 0;
+  vec->len = 16;
+  vec->mode = aes_mode_ecb;
+
+  if (suite->gen == aes_gen_packed) {
+    //[iv] plain cypher
+    rec = packed->data + packed->offset[j];
+    vec->key = packed->keys + packed->key_index[j] * (suite->key_bits / 8);
+    vec->mode = packed->mode;
+    if (vec->mode != aes_mode_ecb) {
+      vec->iv = rec;
+      rec += 16;
+    }
+    vec->len = (packed->data + packed->offset[j + 1] - rec) / 2;
+    vec->plain = rec;
+    vec->input = rec;
+    vec->cypher = rec + vec->len;
+    return;
+  }
+
+  if (suite->gen == aes_gen_none) {
+    //key, cypher, plain, input
+    stride = suite->key_bits / 8 + 48;
+    rec = suite->records + j * stride;
+    vec->key = rec;
+    vec->cypher = rec + stride - 48;
+    vec->plain = rec + stride - 32;
+    vec->input = rec + stride - 16;
+    return;
+  }
+
+  bits = j + 1;
+
+  memset(scratch_key, 0, sizeof(scratch_key));
+  memset(scratch_plain, 0, sizeof(scratch_plain));
+  pattern = suite->gen == aes_gen_varkey ? scratch_key : scratch_plain;
+  for (i = 0; i < bits / 8; i++) {
+    pattern[i] = 0xff;
+  }
+  if (bits % 8) {
+    pattern[i] = (unsigned char)(0xff << (8 - bits % 8));
+  }
+
+  vec->key = scratch_key;
+  vec->cypher = suite->cypher[j];
+  vec->plain = scratch_plain;
+  vec->input = scratch_plain;
+}
+
+//run the vec->len bytes at in through the vector's mode into out, which
+//may be in
+void aes_kat_crypt(const aes_kat_vector *vec, const aes_key_schedule *ks, const unsigned char *in, unsigned char *out, unsigned char dir) {
+  unsigned char iv[16];
+  unsigned int n = 0;
+
+  if (vec->mode == aes_mode_ecb) {
+    for (n = 0; n < vec->len; n += 16) {
+      aes_crypt(in + n, out + n, ks, dir);
+    }
+    return;
+  }
+
+  memcpy(iv, vec->iv, 16);
+  if (vec->mode == aes_mode_cbc) {
+    if (dir) {
+      aes_cbc_decrypt(in, out, vec->len, ks, iv);
+    }
+    else {
+      aes_cbc_encrypt(in, out, vec->len, ks, iv);
+    }
+  }
+  else if (vec->mode == aes_mode_ofb) {
+    aes_ofb_crypt(in, out, vec->len, ks, iv);
+  }
+  else if (dir) {
+    aes_cfb_decrypt(in, out, vec->len, ks, iv);
+  }
+  else {
+    aes_cfb_encrypt(in, out, vec->len, ks, iv);
+  }
+}
+
+#if aes_batch_mode
+//gather the keys and inputs of aes_bs_blocks records into the batch buffers
+void aes_batch_load(const aes_kat_suite *suite, unsigned int first) {
+  int n = 0;
+  aes_kat_vector vec;
+
+  for (n = 0; n < aes_bs_blocks; n++) {
+    aes_kat_get(suite, first + n, &vec);
+    memcpy(batch_key + n * 16, vec.key, 16);
+    memcpy(batch_enc + n * 16, vec.input, 16);
+  }
+}
+
+//the wide hardware unit takes the batch when the host has one
+void aes_batch_enc_dec(unsigned char *state, const unsigned char *key, unsigned char dir) {
+#if aes_hw
+  if (aes_ni_level() > 0) {
+    aes_ni_enc_dec_multi(state, key, aes_bs_blocks, dir);
+    return;
+  }
+#endif
+  aes_bs_enc_dec(state, key, dir);
+}
+#endif
+
+#if aes_key_cache
+//size the key cache from the suite table, so a new suite needs no other
+//change; 0 if there is no memory for it
+int aes_key_cache_alloc(void) {
+  unsigned long total = 0;
+  unsigned int k = 0;
+
+  for (k = 0; k < suite_count; k++) {
+    total += aes_suites[k].count;
+  }
+  key_cache = malloc(total * sizeof(aes_key_schedule));
+  return key_cache != 0;
+}
+#endif
+
 void aes_test()
 {
-  int i = 0;
-  int j = 0;
-  int k = 0;
-  unsigned int count = 0;
-  unsigned int ret = 0;
+  unsigned int j = 0;
+  unsigned int k = 0;
+  unsigned int base = 0;
   int total_errors = 0;
-  int first_error = 0;
-  
-  unsigned char key[] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-  unsigned char key2[] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-  unsigned char gold_cypher[] = {0x08, 0xa4, 0xe2, 0xef, 0xec, 0x8a, 0x8e, 0x33, 0x12, 0xca, 0x74, 0x60, 0xb9, 0x04, 0x0b, 0xbf };
-  unsigned char gold_plain[] = {0x58, 0xc8, 0xe0, 0x0b, 0x26, 0x31, 0x68, 0x6d, 0x54, 0xea, 0xb8, 0x4b, 0x91, 0xf0, 0xac, 0xa1 };
-  unsigned char input[] = {0x58, 0xc8, 0xe0, 0x0b, 0x26, 0x31, 0x68, 0x6d, 0x54, 0xea, 0xb8, 0x4b, 0x91, 0xf0, 0xac, 0xa1 };
+  const aes_kat_suite *suite;
+  aes_kat_vector vec;
+  const aes_key_schedule *ks;
+  unsigned char state[aes_kat_max_len];
+#if aes_batch_mode
+  unsigned int n = 0;
+#endif
+#if aes_checkpoints
+  int errors_before = 0;
+#endif
+#if !aes_key_cache
+  aes_key_schedule ks_vector;
+#endif
+
+#if aes_key_cache
+  //each thread fills the entries of its own vectors
+  for (k = 0; k < suite_count; k++) {
+    for (j = 0; j < aes_suites[k].count; j++, base++) {
+      if (base % shard_count == shard_id) {
+	aes_kat_get(&aes_suites[k], j, &vec);
+	aes_key_setup(vec.key, aes_suites[k].key_bits, &key_cache[base]);
+      }
+    }
+  }
+#endif
   
   while(1) {
-    for (k = 0; k < 4; k++) {
-      if (k == 0) {
-	count = ECBGFSbox128_count;
-      }
-      else if (k == 1) {
-	count = ECBKeySbox128_count;
-      }
-      else if (k == 2) {
-	count = ECBVarKey128_count;
-      }
-      else {
-	count = ECBVarTxt128_count;
-      }
-      
-      for (j = 0; j < count; j++){	
-	//read data arrays out of flash
-	for (i = 0; i < 16; i++) {
-	  if (k == 0) {
-	    key[i] = ECBGFSbox128[i + j*80];
-	    key2[i] = ECBGFSbox128[i + 16 + j*80];
-	    gold_cypher[i] = ECBGFSbox128[i + 32 + j*80];
-	    gold_plain[i] = ECBGFSbox128[i + 48 + j*80];
-	    input[i] = ECBGFSbox128[i + 64 + j*80];
-	  }
-	  if (k == 1) {
-	    key[i] = ECBKeySbox128[i + j*80];
-	    key2[i] = ECBKeySbox128[i + 16 + j*80];
-	    gold_cypher[i] = ECBKeySbox128[i + 32 + j*80];
-	    gold_plain[i] = ECBKeySbox128[i + 48 + j*80];
-	    input[i] = ECBKeySbox128[i + 64 + j*80];
-	  }
-	  if (k == 2) {
-	    key[i] = ECBVarKey128[i + j*80];
-	    key2[i] = ECBVarKey128[i + 16 + j*80];
-	    gold_cypher[i] = ECBVarKey128[i + 32 + j*80];
-	    gold_plain[i] = ECBVarKey128[i + 48 + j*80];
-	    input[i] = ECBVarKey128[i + 64 + j*80];
+    base = 0;
+    for (k = 0; k < suite_count; k++) {
+      suite = &aes_suites[k];
+
+#if aes_batch_mode
+      if (suite->key_bits == 128 && suite->gen != aes_gen_packed && suite->count % aes_bs_blocks == 0) {
+	for (j = 0; j < suite->count; j += aes_bs_blocks) {
+	  if ((base + j) / aes_bs_blocks % shard_count != shard_id) {
+	    continue;
 	  }
-	  if (k == 3) {
-	    key[i] = ECBVarTxt128[i + j*80];
-	    key2[i] = ECBVarTxt128[i + 16 + j*80];
-	    gold_cypher[i] = ECBVarTxt128[i + 32 + j*80];
-	    gold_plain[i] = ECBVarTxt128[i + 48 + j*80];
-	    input[i] = ECBVarTxt128[i + 64 + j*80];
+	  aes_batch_load(suite, j);
+
+	  //run the whole group through the cipher first, keeping the
+	  //ciphertexts so each vector can be checked in order afterwards
+	  aes_batch_enc_dec(batch_enc, batch_key, 0);
+	  memcpy(batch_dec, batch_enc, sizeof(batch_dec));
+	  aes_batch_enc_dec(batch_dec, batch_key, 1);
+
+	  for (n = 0; n < aes_bs_blocks; n++) {
+	    aes_kat_get(suite, j + n, &vec);
+	    check_arrays(vec.input, vec.plain, 16, 'S');
+	    check_arrays(batch_enc + n * 16, vec.cypher, 16, 'E');
+	    check_arrays(batch_dec + n * 16, vec.plain, 16, 'D');
+
+	    total_errors += local_errors;
+	    aes_vector_end();
+	    ind++;
+	    aes_progress(total_errors, 250);
 	  }
-	  
 	}
+	base += suite->count;
+	continue;
+      }
+#endif
+      
+      for (j = 0; j < suite->count; j++){	
+	if ((base + j) % shard_count != shard_id) {
+	  continue;
+	}
+
+	//stored vectors are used straight out of flash
+	aes_kat_get(suite, j, &vec);
 	
-	check_arrays(input, gold_plain, sizeof(input), 'S');
+	check_arrays(vec.input, vec.plain, 16, 'S');
+
+#if aes_key_cache
+	ks = &key_cache[base + j];
+#else
+	aes_key_setup(vec.key, suite->key_bits, &ks_vector);
+	ks = &ks_vector;
+#endif
 	
-	aes_enc_dec(input,key,0);
+	aes_kat_crypt(&vec, ks, vec.input, state, 0);
 	
-	check_arrays(input, gold_cypher, sizeof(input), 'E');
+#if aes_checkpoints
+	errors_before = local_errors;
+#endif
+	check_arrays(state, vec.cypher, vec.len, 'E');
+#if aes_checkpoints
+	//the checkpoints hold the last block, the only one of a plain ECB vector
+	if (vec.len == 16 && vec.mode == aes_mode_ecb) {
+	  aes_localize(vec.key, suite->key_bits, errors_before, 'E');
+	}
+#endif
 	
-	aes_enc_dec(input,key2,1);
+	aes_kat_crypt(&vec, ks, state, state, 1);
 	
-	check_arrays(input, gold_plain, sizeof(input), 'D');
+#if aes_checkpoints
+	errors_before = local_errors;
+#endif
+	check_arrays(state, vec.plain, vec.len, 'D');
+#if aes_checkpoints
+	if (vec.len == 16 && vec.mode == aes_mode_ecb) {
+	  aes_localize(vec.key, suite->key_bits, errors_before, 'D');
+	}
+#endif
 	
 	total_errors += local_errors;
-	local_errors = 0;
-	in_block = 0;
+	aes_vector_end();
 	ind++;
+	aes_progress(total_errors, 250);
+      }
+      base += suite->count;
+    }
+  }
+}
+
+#if aes_mct_mode
+void aes_mct_test()
+{
+  unsigned int i = 0;
+  unsigned int j = 0;
+  unsigned int k = 0;
+  unsigned int stride = 0;
+  unsigned int base = 0;
+  int total_errors = 0;
+  const aes_mct_suite *suite;
+  const unsigned char *rec;
+  const unsigned char *cypher;
+  const unsigned char *plain;
+  aes_key_schedule ks;
+  unsigned char state[16];
+
+  while(1) {
+    base = 0;
+    for (k = 0; k < mct_suite_count; k++) {
+      suite = &aes_mct_suites[k];
+      stride = suite->key_bits / 8 + 16;
 
-	//print an "I am alive" message every once in a awhile
-	if (ind % 250 == 0 && ind != 0) {
-	  printf("# %n, %i\r\n", ind, total_errors);
+      for (j = 0; j < suite->count; j++) {
+	if ((base + j) % shard_count != shard_id) {
+	  continue;
 	}
+
+	//the plaintext of a record is the golden of the one before
+	rec = suite->records + j * stride;
+	cypher = rec + stride - 16;
+	plain = j == 0 ? suite->seed : rec - 16;
+	aes_key_setup(rec, suite->key_bits, &ks);
+
+	memcpy(state, plain, 16);
+	for (i = 0; i < aes_mct_chain; i++) {
+	  aes_crypt(state, state, &ks, 0);
+	}
+	check_arrays(state, cypher, 16, 'E');
+
+	memcpy(state, cypher, 16);
+	for (i = 0; i < aes_mct_chain; i++) {
+	  aes_crypt(state, state, &ks, 1);
+	}
+	check_arrays(state, plain, 16, 'D');
+
+	total_errors += local_errors;
+	aes_vector_end();
+	ind++;
+
+	//a record is 2000 blocks, so the heartbeat comes every 10
+	aes_progress(total_errors, 10);
+      }
+      base += suite->count;
+    }
+  }
+}
+#endif
+
+#if aes_stream_mode
+//the plaintext is a function of the offset, so it never has to be stored
+void aes_stream_fill(unsigned long off, unsigned char *p, unsigned long len) {
+  unsigned long i = 0;
+
+  for (i = 0; i < len; i++) {
+    p[i] = (unsigned char)((off + i) ^ ((off + i) >> 8) ^ ((off + i) >> 16));
+  }
+}
+
+//mode 0 is CBC, 1 is CTR, both from the SP 800-38A IV/counter, and 2 is
+//GCM with the 96-bit IV; tag gets the GCM tag of the ciphertext
+void aes_stream_crypt(unsigned char *buf, unsigned long len, int mode, unsigned char dir, unsigned char *tag) {
+  unsigned char iv[16];
+
+  if (mode == 0) {
+    memcpy(iv, SP800_38A_iv, 16);
+    if (dir == 0) {
+      aes_cbc_encrypt(buf, buf, len, &stream_gcm.ks, iv);
+    }
+    else {
+      aes_cbc_decrypt(buf, buf, len, &stream_gcm.ks, iv);
+    }
+  }
+  else if (mode == 1) {
+    memcpy(iv, SP800_38A_ctr, 16);
+    aes_ctr_crypt(buf, buf, len, &stream_gcm.ks, iv);
+  }
+  else {
+    aes_gcm_crypt(&stream_gcm, dir, SP800_38A_iv, 12, 0, 0, buf, buf, len, tag);
+  }
+}
+
+//the published examples of the mode; stream_gcm is left keyed with the
+//test key
+void aes_stream_kat(int mode) {
+  unsigned char kat[64];
+  unsigned char tag[16];
+  const aes_gcm_vector *v;
+  unsigned int i = 0;
+
+  if (mode < 2) {
+    memcpy(kat, SP800_38A_plain, 64);
+    aes_stream_crypt(kat, 64, mode, 0, tag);
+    check_arrays(kat, mode == 0 ? SP800_38A_cbc : SP800_38A_ctr_cypher, 64, 'K');
+    aes_stream_crypt(kat, 64, mode, 1, tag);
+    check_arrays(kat, SP800_38A_plain, 64, 'K');
+    return;
+  }
+
+  for (i = 0; i < GCMSpec_count; i++) {
+    v = &GCMSpec[i];
+    aes_gcm_init(&stream_gcm, v->key, v->key_bits);
+    aes_gcm_crypt(&stream_gcm, 0, v->iv, v->iv_len, v->aad, v->aad_len, v->plain, kat, v->len, tag);
+    check_arrays(kat, v->cypher, v->len, 'K');
+    check_arrays(tag, v->tag, 16, 'K');
+    aes_gcm_crypt(&stream_gcm, 1, v->iv, v->iv_len, v->aad, v->aad_len, kat, kat, v->len, tag);
+    check_arrays(kat, v->plain, v->len, 'K');
+    check_arrays(tag, v->tag, 16, 'K');
+  }
+  aes_gcm_init(&stream_gcm, SP800_38A_key, 128);
+}
+
+//one mode over this thread's part of the buffer; mac gets the digest of the
+//ciphertext
+void aes_stream_pass(int mode, unsigned char *mac) {
+  unsigned char *buf;
+  unsigned char block[16];
+  unsigned char tag[16];
+  unsigned long n = 0;
+  unsigned long start = 0;
+
+  aes_stream_kat(mode);
+
+  buf = stream_buf + stream_off;
+  aes_stream_fill(stream_off, buf, stream_len);
+  start = aes_clock_us();
+  aes_stream_crypt(buf, stream_len, mode, 0, mac);
+  stream_us += aes_clock_us() - start;
+  if (mode < 2) {
+    aes_cbc_mac(buf, stream_len, &stream_mac_ks, mac);
+  }
+  start = aes_clock_us();
+  aes_stream_crypt(buf, stream_len, mode, 1, tag);
+  stream_us += aes_clock_us() - start;
+
+  //the decryption recomputes the tag from the ciphertext
+  if (mode == 2) {
+    check_arrays(tag, mac, 16, 'T');
+  }
+  for (n = 0; n < stream_len; n += 16) {
+    aes_stream_fill(stream_off + n, block, 16);
+    check_arrays(buf + n, block, 16, 'D');
+  }
+}
+
+void aes_stream_test()
+{
+  int mode = 0;
+  int total_errors = 0;
+  unsigned char mac[16];
+
+  aes_gcm_init(&stream_gcm, SP800_38A_key, 128);
+  aes_key_setup(FIPS197_128[0].key, 128, &stream_mac_ks);
+
+  //the golden digests come from the first run, like the qsort goldens
+  for (mode = 0; mode < stream_modes; mode++) {
+    aes_stream_pass(mode, stream_golden[mode]);
+  }
+  total_errors += local_errors;
+  aes_vector_end();
+
+  while(1) {
+    stream_us = 0;
+    for (mode = 0; mode < stream_modes; mode++) {
+      aes_stream_pass(mode, mac);
+      check_arrays(mac, stream_golden[mode], 16, 'M');
+
+      total_errors += local_errors;
+      aes_vector_end();
+      ind++;
+    }
+
+    //every mode encrypts and decrypts the buffer
+#if aes_threaded
+    worker->ind = ind;
+    worker->errors = total_errors;
+    worker->bytes += 2ULL * stream_modes * stream_len;
+    worker->us += stream_us;
+#else
+    printf("# %n, %i, %n\r\n", ind, total_errors,
+	   stream_us ? (unsigned long)(2ULL * stream_modes * stream_len * 1000000 / stream_us) : 0);
+#endif
+  }
+}
+#endif
+
+//the test selected at build time, on this thread's share of the work
+void aes_run(void) {
+#if aes_mct_mode
+  aes_mct_test();
+#elif aes_stream_mode
+  aes_stream_test();
+#else
+  aes_test();
+#endif
+}
+
+#if aes_threaded
+void *aes_worker_main(void *arg) {
+  cpu_set_t cpu;
+#if aes_stream_mode
+  unsigned long blocks = aes_stream_bytes / 16 / worker_count;
+#endif
+
+  worker = (aes_worker *)arg;
+  shard_id = worker->id;
+  shard_count = worker_count;
+
+  CPU_ZERO(&cpu);
+  CPU_SET(worker->cpu, &cpu);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu), &cpu);
+
+#if aes_stream_mode
+  //equal parts, the last thread also takes what is left over
+  stream_off = worker->id * blocks * 16;
+  stream_len = blocks * 16;
+  if (worker->id == worker_count - 1) {
+    stream_len = aes_stream_bytes - stream_off;
+  }
+#endif
+
+  aes_run();
+  return 0;
+}
+
+//one worker per CPU we are allowed to run on, in that order, wrapping
+//around when aes_workers asks for more
+void aes_plan_workers(void) {
+  cpu_set_t allowed;
+  int cpu = 0;
+  int t = 0;
+
+  sched_getaffinity(0, sizeof(allowed), &allowed);
+  worker_count = aes_workers ? aes_workers : CPU_COUNT(&allowed);
+  if (worker_count > aes_max_workers) {
+    worker_count = aes_max_workers;
+  }
+
+  for (t = 0; t < worker_count; t++) {
+    while (!CPU_ISSET(cpu, &allowed)) {
+      cpu = (cpu + 1) % CPU_SETSIZE;
+    }
+    workers[t].id = t;
+    workers[t].cpu = cpu;
+    cpu = (cpu + 1) % CPU_SETSIZE;
+  }
+}
+
+void aes_run_workers(void) {
+  unsigned long long rate = 0;
+  unsigned long long bytes[aes_max_workers];
+  unsigned long long us[aes_max_workers];
+  unsigned long ind_sum = 0;
+  int errors = 0;
+  int t = 0;
+
+  for (t = 0; t < worker_count; t++) {
+    bytes[t] = 0;
+    us[t] = 0;
+    pthread_create(&workers[t].thread, 0, aes_worker_main, &workers[t]);
+  }
+
+  while(1) {
+    sleep(1);
+
+    ind_sum = 0;
+    errors = 0;
+    rate = 0;
+    for (t = 0; t < worker_count; t++) {
+      ind_sum += workers[t].ind;
+      errors += workers[t].errors;
+      //the rates of the workers over the last second add up
+      if (workers[t].us != us[t]) {
+	rate += (workers[t].bytes - bytes[t]) * 1000000 / (workers[t].us - us[t]);
       }
+      bytes[t] = workers[t].bytes;
+      us[t] = workers[t].us;
     }
+
+    aes_print_lock();
+#if aes_stream_mode
+    printf("# %n, %i, %n\r\n", ind_sum, errors, (unsigned long)rate);
+#else
+    printf("# %n, %i\r\n", ind_sum, errors);
+#endif
+    aes_print_unlock();
   }
 }
+#endif
 
 int main( void )
 {
   
   //set up part
   initMSP430();
+#if aes_hw
+  //before the threads, which only read what it found
+  aes_ni_init();
+#endif
+#if aes_key_cache
+  if (!aes_key_cache_alloc()) {
+    printf("# no memory for the key cache\r\n");
+    return 1;
+  }
+#endif
+#if aes_threaded
+  aes_plan_workers();
+#endif
   
   //print YAML header
   printf("\r\n---\r\n");
-  printf("hw: msp430f2619\r\n");
+  printf("hw: %s\r\n", hw_name);
   printf("test: aes\r\n");
   printf("mit: none\r\n");
   printf("printing: %i\r\n", robust_printing);
+  printf("eng: %s\r\n", aes_engine());
+  printf("mode: %s\r\n", aes_mode_name);
+#if aes_stream_mode
+  printf("len: %n\r\n", aes_stream_bytes);
+  printf("gh: %s\r\n", aes_gcm_engine());
+#endif
+#if aes_threaded
+  printf("threads: %i\r\n", worker_count);
+#endif
   printf("ver: 0.1\r\n");
   printf("fac: LANSCE Nov 2015\r\n");
   printf("d:\r\n");
   
   //run test
-  aes_test();
+#if aes_threaded
+  aes_run_workers();
+#else
+  aes_run();
+#endif
   
   //Code should never get here.
   return 0;
 }
 
+#ifdef __MSP430__
+
 void initMSP430() {
 	//MSP430F2619 initialization code
   WDTCTL = WDTPW + WDTHOLD;              // Stop WDT
@@ -268,6 +1020,12 @@ void initMSP430() {
   DCOCTL = CALDCO_1MHZ;
   
   initUART();
+
+#if aes_stream_mode
+  //Timer_A counts microseconds for the throughput figure
+  TACTL = TASSEL_2 + MC_2 + TAIE;        // 1MHz SMCLK, continuous, overflow IRQ
+  __enable_interrupt();
+#endif
 }
 
 /**
@@ -283,6 +1041,49 @@ void initUART(void) {
   UCA0CTL1 &= ~UCSWRST;                     // **Initialize USCI state machine**
 }
 
+#if aes_stream_mode
+//Timer_A overflows, the high half of the microsecond clock
+volatile unsigned int clock_wraps = 0;
+
+unsigned long aes_clock_us(void) {
+  unsigned int hi;
+  unsigned int lo;
+
+  __disable_interrupt();
+  hi = clock_wraps;
+  lo = TAR;
+  //an overflow that has not been serviced yet
+  if ((TACTL & TAIFG) && lo < 0x8000) {
+    hi++;
+  }
+  __enable_interrupt();
+  return ((unsigned long)hi << 16) | lo;
+}
+
+#pragma vector=TIMERA1_VECTOR
+__interrupt void TIMERA1_ISR(void)
+{
+  if (TAIV == 10) {                      // TAIFG
+    clock_wraps++;
+  }
+}
+#endif
+
+#else
+
+void initMSP430() {
+  //nothing to set up on a host, the output goes to stdout
+}
+
+unsigned long aes_clock_us(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#endif
+
 /**
  * puts() is used by printf() to display or send a string.. This function
  * determines where printf prints to. For this case it sends a string
@@ -307,6 +1108,8 @@ void putc(char b) {
   sendByte(b);
 }
 
+#ifdef __MSP430__
+
 /**
  * Sends a single byte out through UART
  **/
@@ -316,3 +1119,14 @@ void sendByte(char byte )
   UCA0TXBUF = byte; // TX -> RXed character
 }
 
+#else
+
+/**
+ * Host stand-in for the UART: sends a single byte to stdout
+ **/
+void sendByte(char byte)
+{
+  write(1, &byte, 1);
+}
+
+#endif
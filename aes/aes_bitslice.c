@@ -0,0 +1,515 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_bitslice.c
+//
+// Bitsliced AES-128, see aes_bitslice.h.  A bitsliced value is 128 words,
+// word 8 * i + b holding bit b of byte i of every block.  The S-box is the
+// Boyar-Peralta circuit (113 gates), the inverse S-box reuses it between two
+// inverse affine maps, and the round keys are derived on the fly so only one
+// round key is live at a time.
+//
+//*****************************************************************************
+
+#include "aes_bitslice.h"
+
+#define		aes_rounds		10
+
+static const unsigned char aes_bs_rcon[10] = {
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+};
+
+//q[0] is the least significant bit of the byte
+static void bs_sbox(aes_bs_word *q) {
+  aes_bs_word x0, x1, x2, x3, x4, x5, x6, x7;
+  aes_bs_word y1, y2, y3, y4, y5, y6, y7, y8, y9;
+  aes_bs_word y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+  aes_bs_word y20, y21;
+  aes_bs_word z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  aes_bs_word z10, z11, z12, z13, z14, z15, z16, z17;
+  aes_bs_word t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+  aes_bs_word t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  aes_bs_word t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+  aes_bs_word t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  aes_bs_word t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+  aes_bs_word t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  aes_bs_word t60, t61, t62, t63, t64, t65, t66, t67;
+  aes_bs_word s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7];
+  x1 = q[6];
+  x2 = q[5];
+  x3 = q[4];
+  x4 = q[3];
+  x5 = q[2];
+  x6 = q[1];
+  x7 = q[0];
+
+  //top linear transformation
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9 = x0 ^ x3;
+  y8 = x0 ^ x5;
+  t0 = x1 ^ x2;
+  y1 = t0 ^ x7;
+  y4 = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2 = y1 ^ x0;
+  y5 = y1 ^ x6;
+  y3 = y5 ^ y8;
+  t1 = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6 = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7 = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  //non-linear section
+  t2 = y12 & y15;
+  t3 = y3 & y6;
+  t4 = t3 ^ t2;
+  t5 = y4 & x7;
+  t6 = t5 ^ t2;
+  t7 = y13 & y16;
+  t8 = y5 & y1;
+  t9 = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15;
+  z1 = t37 & y6;
+  z2 = t33 & x7;
+  z3 = t43 & y16;
+  z4 = t40 & y1;
+  z5 = t29 & y7;
+  z6 = t42 & y11;
+  z7 = t45 & y17;
+  z8 = t41 & y10;
+  z9 = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  //bottom linear transformation
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  s0 = t59 ^ t63;
+  s6 = t56 ^ ~t62;
+  s7 = t48 ^ ~t60;
+  t67 = t64 ^ t65;
+  s3 = t53 ^ t66;
+  s4 = t51 ^ t66;
+  s5 = t47 ^ t65;
+  s1 = t64 ^ ~s3;
+  s2 = t55 ^ ~t67;
+
+  q[7] = s0;
+  q[6] = s1;
+  q[5] = s2;
+  q[4] = s3;
+  q[3] = s4;
+  q[2] = s5;
+  q[1] = s6;
+  q[0] = s7;
+}
+
+//inverse of the S-box affine map including its constant:
+//A'(v) = A^-1(v + 0x63) = A^-1(v) + 0x05
+static void bs_inv_affine(aes_bs_word *q) {
+  aes_bs_word v[8];
+  int i = 0;
+
+  for (i = 0; i < 8; i++) {
+    v[i] = q[i];
+  }
+  for (i = 0; i < 8; i++) {
+    q[i] = v[(i + 2) & 7] ^ v[(i + 5) & 7] ^ v[(i + 7) & 7];
+  }
+  q[0] = ~q[0];
+  q[2] = ~q[2];
+}
+
+//S(x) = A(x^-1) + 0x63, so S^-1(y) = A'(S(A'(y))) with A' the inverse
+//affine map above
+static void bs_inv_sbox(aes_bs_word *q) {
+  bs_inv_affine(q);
+  bs_sbox(q);
+  bs_inv_affine(q);
+}
+
+//multiply the byte in x by {02} in place
+static void bs_xtime(aes_bs_word *x) {
+  aes_bs_word hi = x[7];
+
+  x[7] = x[6];
+  x[6] = x[5];
+  x[5] = x[4];
+  x[4] = x[3] ^ hi;
+  x[3] = x[2] ^ hi;
+  x[2] = x[1];
+  x[1] = x[0] ^ hi;
+  x[0] = hi;
+}
+
+static void bs_sub_bytes(aes_bs_word *s) {
+  int i = 0;
+
+  for (i = 0; i < 16; i++) {
+    bs_sbox(s + 8 * i);
+  }
+}
+
+static void bs_inv_sub_bytes(aes_bs_word *s) {
+  int i = 0;
+
+  for (i = 0; i < 16; i++) {
+    bs_inv_sbox(s + 8 * i);
+  }
+}
+
+//byte i = 4 * column + row, row r rotates left by r columns
+static void bs_shift_rows(aes_bs_word *s, int inverse) {
+  aes_bs_word t[128];
+  int i = 0;
+  int b = 0;
+  int src = 0;
+
+  for (i = 0; i < 16; i++) {
+    if (inverse) {
+      src = (i + 16 - 4 * (i & 3)) & 15;
+    }
+    else {
+      src = (i + 4 * (i & 3)) & 15;
+    }
+    for (b = 0; b < 8; b++) {
+      t[8 * i + b] = s[8 * src + b];
+    }
+  }
+  for (i = 0; i < 128; i++) {
+    s[i] = t[i];
+  }
+}
+
+static void bs_mix_columns(aes_bs_word *s) {
+  aes_bs_word t[8], u[8], x[8];
+  aes_bs_word *a0, *a1, *a2, *a3;
+  int c = 0;
+  int b = 0;
+
+  for (c = 0; c < 4; c++) {
+    a0 = s + 32 * c;
+    a1 = a0 + 8;
+    a2 = a0 + 16;
+    a3 = a0 + 24;
+    for (b = 0; b < 8; b++) {
+      t[b] = a0[b] ^ a1[b] ^ a2[b] ^ a3[b];
+      u[b] = a0[b];
+    }
+
+    for (b = 0; b < 8; b++) x[b] = a0[b] ^ a1[b];
+    bs_xtime(x);
+    for (b = 0; b < 8; b++) a0[b] ^= t[b] ^ x[b];
+
+    for (b = 0; b < 8; b++) x[b] = a1[b] ^ a2[b];
+    bs_xtime(x);
+    for (b = 0; b < 8; b++) a1[b] ^= t[b] ^ x[b];
+
+    for (b = 0; b < 8; b++) x[b] = a2[b] ^ a3[b];
+    bs_xtime(x);
+    for (b = 0; b < 8; b++) a2[b] ^= t[b] ^ x[b];
+
+    for (b = 0; b < 8; b++) x[b] = a3[b] ^ u[b];
+    bs_xtime(x);
+    for (b = 0; b < 8; b++) a3[b] ^= t[b] ^ x[b];
+  }
+}
+
+static void bs_inv_mix_columns(aes_bs_word *s) {
+  aes_bs_word u[8], v[8];
+  aes_bs_word *a0;
+  int c = 0;
+  int b = 0;
+
+  for (c = 0; c < 4; c++) {
+    a0 = s + 32 * c;
+    for (b = 0; b < 8; b++) {
+      u[b] = a0[b] ^ a0[16 + b];
+      v[b] = a0[8 + b] ^ a0[24 + b];
+    }
+    bs_xtime(u);
+    bs_xtime(u);
+    bs_xtime(v);
+    bs_xtime(v);
+    for (b = 0; b < 8; b++) {
+      a0[b] ^= u[b];
+      a0[8 + b] ^= v[b];
+      a0[16 + b] ^= u[b];
+      a0[24 + b] ^= v[b];
+    }
+  }
+  bs_mix_columns(s);
+}
+
+static void bs_add_round_key(aes_bs_word *s, const aes_bs_word *k) {
+  int i = 0;
+
+  for (i = 0; i < 128; i++) {
+    s[i] ^= k[i];
+  }
+}
+
+//SubWord(RotWord(w3)) ^ rcon, as needed by both key schedule directions
+static void bs_key_core(aes_bs_word *t, const aes_bs_word *k, int round) {
+  int i = 0;
+  int b = 0;
+
+  for (i = 0; i < 4; i++) {
+    for (b = 0; b < 8; b++) {
+      t[8 * i + b] = k[8 * (12 + ((i + 1) & 3)) + b];
+    }
+    bs_sbox(t + 8 * i);
+  }
+  for (b = 0; b < 8; b++) {
+    if ((aes_bs_rcon[round - 1] >> b) & 1) {
+      t[b] = ~t[b];
+    }
+  }
+}
+
+//advance k from round key round - 1 to round key round
+static void bs_next_key(aes_bs_word *k, int round) {
+  aes_bs_word t[32];
+  int i = 0;
+
+  bs_key_core(t, k, round);
+  for (i = 0; i < 32; i++) {
+    k[i] ^= t[i];
+  }
+  for (i = 32; i < 128; i++) {
+    k[i] ^= k[i - 32];
+  }
+}
+
+//step k back from round key round to round key round - 1
+static void bs_prev_key(aes_bs_word *k, int round) {
+  aes_bs_word t[32];
+  int i = 0;
+
+  for (i = 127; i >= 32; i--) {
+    k[i] ^= k[i - 32];
+  }
+  bs_key_core(t, k, round);
+  for (i = 0; i < 32; i++) {
+    k[i] ^= t[i];
+  }
+}
+
+//transpose an 8x8 bit matrix, row m in byte m, column b in bit b
+static uint64_t bs_transpose8(uint64_t x) {
+  uint64_t t;
+
+  t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL;
+  x = x ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL;
+  x = x ^ t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL;
+  x = x ^ t ^ (t << 28);
+  return x;
+}
+
+//blocks are converted eight at a time: byte i of eight blocks is an 8x8 bit
+//matrix whose transpose is bit 0..7 of byte i for those eight blocks
+static void bs_pack(aes_bs_word *s, const unsigned char *in) {
+  int g = 0;
+  int i = 0;
+  int b = 0;
+  int m = 0;
+  uint64_t x;
+
+  for (i = 0; i < 128; i++) {
+    s[i] = 0;
+  }
+
+  for (g = 0; g < aes_bs_blocks / 8; g++) {
+    for (i = 0; i < 16; i++) {
+      x = 0;
+      for (m = 0; m < 8; m++) {
+	x |= (uint64_t)in[16 * (8 * g + m) + i] << (8 * m);
+      }
+      x = bs_transpose8(x);
+      for (b = 0; b < 8; b++) {
+	s[8 * i + b] |= (aes_bs_word)((aes_bs_word)((x >> (8 * b)) & 0xff) << (8 * g));
+      }
+    }
+  }
+}
+
+static void bs_unpack(unsigned char *out, const aes_bs_word *s) {
+  int g = 0;
+  int i = 0;
+  int b = 0;
+  int m = 0;
+  uint64_t x;
+
+  for (g = 0; g < aes_bs_blocks / 8; g++) {
+    for (i = 0; i < 16; i++) {
+      x = 0;
+      for (b = 0; b < 8; b++) {
+	x |= (uint64_t)((s[8 * i + b] >> (8 * g)) & 0xff) << (8 * b);
+      }
+      x = bs_transpose8(x);
+      for (m = 0; m < 8; m++) {
+	out[16 * (8 * g + m) + i] = (unsigned char)(x >> (8 * m));
+      }
+    }
+  }
+}
+
+void aes_bs_enc_dec(unsigned char *state, const unsigned char *key, unsigned char dir) {
+  aes_bs_word s[128];
+  aes_bs_word k[128];
+  int r = 0;
+
+  bs_pack(s, state);
+  bs_pack(k, key);
+
+  if (dir == 0) {
+    bs_add_round_key(s, k);
+    for (r = 1; r <= aes_rounds; r++) {
+      bs_sub_bytes(s);
+      bs_shift_rows(s, 0);
+      if (r != aes_rounds) {
+	bs_mix_columns(s);
+      }
+      bs_next_key(k, r);
+      bs_add_round_key(s, k);
+    }
+  }
+  else {
+    for (r = 1; r <= aes_rounds; r++) {
+      bs_next_key(k, r);
+    }
+    bs_add_round_key(s, k);
+    for (r = aes_rounds; r >= 1; r--) {
+      bs_shift_rows(s, 1);
+      bs_inv_sub_bytes(s);
+      bs_prev_key(k, r);
+      bs_add_round_key(s, k);
+      if (r != 1) {
+	bs_inv_mix_columns(s);
+      }
+    }
+  }
+
+  bs_unpack(state, s);
+}
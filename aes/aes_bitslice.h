@@ -0,0 +1,93 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_bitslice.h
+//
+// Bitsliced AES-128 that runs aes_bs_blocks independent blocks at once, each
+// with its own key.  Bit j of every block is gathered into one machine word,
+// so all rounds are plain AND/XOR/NOT over aes_bs_width-bit words and every
+// word of the register file is busy for the whole cipher.
+//
+// state and key both hold aes_bs_blocks consecutive 16-byte blocks.  The
+// state is encrypted (dir = 0) or decrypted (dir = 1) in place, block n
+// with key n.
+//
+//*****************************************************************************
+
+#ifndef AES_BITSLICE_H
+#define AES_BITSLICE_H
+
+#include <stdint.h>
+
+//number of blocks per call: 8, 16, 32 or 64.  Default to the native
+//register width on the MSP430 and to 64 on hosts.
+#ifndef aes_bs_width
+#ifdef __MSP430__
+#define aes_bs_width		16
+#else
+#define aes_bs_width		64
+#endif
+#endif
+
+#if aes_bs_width == 8
+typedef uint8_t aes_bs_word;
+#elif aes_bs_width == 16
+typedef uint16_t aes_bs_word;
+#elif aes_bs_width == 32
+typedef uint32_t aes_bs_word;
+#elif aes_bs_width == 64
+typedef uint64_t aes_bs_word;
+#else
+#error "aes_bs_width must be 8, 16, 32 or 64"
+#endif
+
+#define aes_bs_blocks		aes_bs_width
+
+void aes_bs_enc_dec(unsigned char *state, const unsigned char *key, unsigned char dir);
+
+#endif
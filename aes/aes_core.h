@@ -0,0 +1,150 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_core.h
+//
+// In-tree AES engine used by aes.c in place of the TI AES-128 download.
+// aes_enc_dec() keeps the TI signature: dir = 0 encrypts the 16-byte state
+// in place with a 128-bit key, dir = 1 decrypts it.  Unlike the TI code the
+// key is never modified, so the same key buffer can be used for both
+// directions.
+//
+// Two implementations are available and selected at build time:
+//
+//   aes_ttable 1  32-bit T-table rounds (four encrypt and four decrypt
+//                 tables, ~8 KB of flash).  Fastest on hosts and on parts
+//                 with 32-bit datapaths.
+//   aes_ttable 0  byte-wise S-box rounds with xtime MixColumns (~512 bytes
+//                 of tables).  For small-flash parts.
+//
+// aes_key_setup() expands a 128, 192 or 256-bit key (10, 12 or 14 rounds)
+// into an aes_key_schedule holding the encryption and, for the T-table and
+// AES-NI engines, the decryption round keys, and aes_crypt() runs only the
+// rounds against such a schedule, from in to out (which may be the same
+// buffer).  aes_enc_dec() is the two together.  The schedule layout
+// belongs to the engine that filled it in.
+//
+// On x86 hosts (aes_hw 1) aes_enc_dec() checks CPUID once and hands the
+// block to the AES-NI backend in aes_ni.c when the part has it, so the
+// hardware unit is what gets measured.  aes_engine() names the engine in
+// use for the YAML header.
+//
+// With aes_checkpoints every engine behind aes_crypt() leaves the round
+// states of the last block in aes_ckpt.  The T-table and AES-NI decryptions
+// use the equivalent inverse cipher, whose round states are the same as
+// those of the straightforward one, so all engines can be checked against
+// one reference.
+//
+//*****************************************************************************
+
+#ifndef AES_CORE_H
+#define AES_CORE_H
+
+#ifndef aes_ttable
+#define aes_ttable		1
+#endif
+
+#include <stdint.h>
+
+#ifndef aes_hw
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define aes_hw			1
+#else
+#define aes_hw			0
+#endif
+#endif
+
+//1 makes aes_crypt() record its input and the state after every round in
+//aes_ckpt, so a block that fails its check can be replayed against the
+//reference in aes_ref.c to find the first round that went wrong.  Costs a
+//16-byte store per round; 0 compiles the recording out.
+#ifndef aes_checkpoints
+#define aes_checkpoints		0
+#endif
+
+//room for the 15 round keys of AES-256
+#define		aes_rk_words		60
+#define		aes_max_rounds		14
+
+//the S-box rounds decrypt straight from the encryption round keys, so only
+//the T-table and AES-NI engines keep a second set
+#define		aes_dec_keys		(aes_ttable || aes_hw)
+
+typedef struct {
+  uint32_t enc[aes_rk_words];
+#if aes_dec_keys
+  uint32_t dec[aes_rk_words];
+#endif
+  int rounds;
+} aes_key_schedule;
+
+#if aes_checkpoints
+//round 0 is the state after the first AddRoundKey, round r the state after
+//round r of the encryption or the decryption
+typedef struct {
+  unsigned char in[16];
+  unsigned char round[aes_max_rounds + 1][16];
+  int rounds;
+  unsigned char dir;
+} aes_checkpoint;
+
+#ifdef __MSP430__
+extern aes_checkpoint aes_ckpt;
+#else
+extern __thread aes_checkpoint aes_ckpt;
+#endif
+#endif
+
+void aes_key_setup(const unsigned char *key, int key_bits, aes_key_schedule *ks);
+//word-oriented key expansion, shared with the AES-NI backend
+int aes_expand_key(const unsigned char *key, int nk, uint32_t *rk);
+void aes_crypt(const unsigned char *in, unsigned char *out, const aes_key_schedule *ks, unsigned char dir);
+void aes_enc_dec(unsigned char *state, unsigned char *key, unsigned char dir);
+const char *aes_engine(void);
+
+#endif
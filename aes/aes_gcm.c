@@ -0,0 +1,243 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_gcm.c
+//
+// AES-GCM with table-driven or carry-less multiply GHASH, see aes_gcm.h.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "aes_gcm.h"
+#if aes_hw
+#include "aes_ni.h"
+#endif
+
+//the reduction of a nibble shifted out of the low end, as the top 16 bits
+static const uint16_t gcm_last4[16] = {
+  0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+  0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+static uint64_t gcm_get64(const unsigned char *p) {
+  uint64_t v = 0;
+  int i = 0;
+
+  for (i = 0; i < 8; i++) {
+    v = (v << 8) | p[i];
+  }
+  return v;
+}
+
+static void gcm_put64(unsigned char *p, uint64_t v) {
+  int i = 0;
+
+  for (i = 7; i >= 0; i--) {
+    p[i] = (unsigned char)v;
+    v >>= 8;
+  }
+}
+
+//GCM reflects the bits, so index 8 is H itself and every halving of the
+//index is one multiplication by x
+static void gcm_table(aes_gcm_ctx *ctx) {
+  uint64_t vh = gcm_get64(ctx->h);
+  uint64_t vl = gcm_get64(ctx->h + 8);
+  uint64_t carry = 0;
+  int i = 0;
+  int j = 0;
+
+  ctx->hh[0] = 0;
+  ctx->hl[0] = 0;
+  ctx->hh[8] = vh;
+  ctx->hl[8] = vl;
+  for (i = 4; i > 0; i >>= 1) {
+    carry = (vl & 1) ? 0xe100000000000000ULL : 0;
+    vl = (vh << 63) | (vl >> 1);
+    vh = (vh >> 1) ^ carry;
+    ctx->hh[i] = vh;
+    ctx->hl[i] = vl;
+  }
+  for (i = 2; i <= 8; i *= 2) {
+    for (j = 1; j < i; j++) {
+      ctx->hh[i + j] = ctx->hh[i] ^ ctx->hh[j];
+      ctx->hl[i + j] = ctx->hl[i] ^ ctx->hl[j];
+    }
+  }
+}
+
+//x = x * H, a nibble at a time from the last byte back
+static void gcm_mult(const aes_gcm_ctx *ctx, unsigned char *x) {
+  uint64_t zh = 0;
+  uint64_t zl = 0;
+  unsigned char rem = 0;
+  unsigned char nib = 0;
+  int i = 0;
+  int half = 0;
+
+  for (i = 15; i >= 0; i--) {
+    for (half = 0; half < 2; half++) {
+      nib = half == 0 ? x[i] & 0x0f : x[i] >> 4;
+      if (i != 15 || half != 0) {
+	rem = (unsigned char)(zl & 0x0f);
+	zl = (zh << 60) | (zl >> 4);
+	zh = (zh >> 4) ^ ((uint64_t)gcm_last4[rem] << 48);
+      }
+      zh ^= ctx->hh[nib];
+      zl ^= ctx->hl[nib];
+    }
+  }
+  gcm_put64(x, zh);
+  gcm_put64(x + 8, zl);
+}
+
+//fold len bytes into the hash x, the last partial block zero padded
+static void gcm_ghash(const aes_gcm_ctx *ctx, unsigned char *x, const unsigned char *data, unsigned long len) {
+  unsigned long n = 0;
+  int i = 0;
+
+#if aes_hw
+  if (aes_ni_has_clmul()) {
+    n = len & ~15UL;
+    aes_ni_ghash(ctx->h, x, data, n / 16);
+  }
+#endif
+
+  for (; n < len; n += 16) {
+    for (i = 0; i < 16 && n + i < len; i++) {
+      x[i] ^= data[n + i];
+    }
+    gcm_mult(ctx, x);
+  }
+}
+
+//the lengths block closes the hash
+static void gcm_lengths(const aes_gcm_ctx *ctx, unsigned char *x, unsigned long aad_len, unsigned long len) {
+  unsigned char b[16];
+
+  gcm_put64(b, (uint64_t)aad_len * 8);
+  gcm_put64(b + 8, (uint64_t)len * 8);
+  gcm_ghash(ctx, x, b, 16);
+}
+
+//GCTR's increment only runs over the last 32 bits
+static void gcm_inc32(unsigned char *cb) {
+  int i = 15;
+
+  while (i >= 12 && ++cb[i] == 0) {
+    i--;
+  }
+}
+
+void aes_gcm_init(aes_gcm_ctx *ctx, const unsigned char *key, int key_bits) {
+  aes_key_setup(key, key_bits, &ctx->ks);
+  memset(ctx->h, 0, 16);
+  aes_crypt(ctx->h, ctx->h, &ctx->ks, 0);
+  gcm_table(ctx);
+}
+
+void aes_gcm_crypt(const aes_gcm_ctx *ctx, unsigned char dir, const unsigned char *iv, unsigned int iv_len,
+		   const unsigned char *aad, unsigned long aad_len,
+		   const unsigned char *in, unsigned char *out, unsigned long len, unsigned char *tag) {
+  unsigned char j0[16];
+  unsigned char cb[16];
+  unsigned char stream[16];
+  unsigned char x[16];
+  unsigned long n = 0;
+  int i = 0;
+
+  if (iv_len == 12) {
+    memcpy(j0, iv, 12);
+    j0[12] = 0;
+    j0[13] = 0;
+    j0[14] = 0;
+    j0[15] = 1;
+  }
+  else {
+    memset(j0, 0, 16);
+    gcm_ghash(ctx, j0, iv, iv_len);
+    gcm_lengths(ctx, j0, 0, iv_len);
+  }
+
+  memset(x, 0, 16);
+  gcm_ghash(ctx, x, aad, aad_len);
+
+  //the tag covers the ciphertext, so a decryption hashes before it
+  //overwrites an in-place buffer
+  if (dir != 0) {
+    gcm_ghash(ctx, x, in, len);
+  }
+
+  memcpy(cb, j0, 16);
+  for (n = 0; n < len; n += 16) {
+    gcm_inc32(cb);
+    aes_crypt(cb, stream, &ctx->ks, 0);
+    for (i = 0; i < 16 && n + i < len; i++) {
+      out[n + i] = in[n + i] ^ stream[i];
+    }
+  }
+
+  if (dir == 0) {
+    gcm_ghash(ctx, x, out, len);
+  }
+  gcm_lengths(ctx, x, aad_len, len);
+
+  aes_crypt(j0, stream, &ctx->ks, 0);
+  for (i = 0; i < 16; i++) {
+    tag[i] = x[i] ^ stream[i];
+  }
+}
+
+const char *aes_gcm_engine(void) {
+#if aes_hw
+  if (aes_ni_has_clmul()) {
+    return "clmul";
+  }
+#endif
+  return "table4";
+}
@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_gcm.h
+//
+// AES-GCM on top of the aes_core.h engine.  aes_gcm_init() expands the key
+// and derives the hash key H = E(K, 0); aes_gcm_crypt() runs GCTR over len
+// bytes from in to out (which may be the same buffer) and writes the tag of
+// the ciphertext, so a decryption is checked by comparing the tag it
+// returns with the expected one.  IVs of 12 bytes are used as they are,
+// any other length is hashed into the first counter block.
+//
+// GHASH multiplies by H with Shoup's 4-bit tables: sixteen multiples of H
+// (256 bytes of RAM per key) and a 16-entry reduction table, one nibble per
+// step, which suits parts without a wide multiplier.  On x86 hosts with
+// PCLMULQDQ the carry-less multiplier in aes_ni.c does the work instead;
+// aes_gcm_engine() names the one in use.
+//
+//*****************************************************************************
+
+#ifndef AES_GCM_H
+#define AES_GCM_H
+
+#include <stdint.h>
+#include "aes_core.h"
+
+typedef struct {
+  aes_key_schedule ks;
+  unsigned char h[16];
+  //multiples of H by each 4-bit value, high and low halves
+  uint64_t hh[16];
+  uint64_t hl[16];
+} aes_gcm_ctx;
+
+void aes_gcm_init(aes_gcm_ctx *ctx, const unsigned char *key, int key_bits);
+void aes_gcm_crypt(const aes_gcm_ctx *ctx, unsigned char dir, const unsigned char *iv, unsigned int iv_len,
+		   const unsigned char *aad, unsigned long aad_len,
+		   const unsigned char *in, unsigned char *out, unsigned long len, unsigned char *tag);
+const char *aes_gcm_engine(void);
+
+#endif
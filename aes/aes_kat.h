@@ -0,0 +1,207 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_kat.h
+//
+// Layout of the NIST known-answer test vectors used by aes.c.  Each suite
+// header (ECBGFSbox128.h, ...) is an array of aes_kat_record (or its 192 and
+// 256-bit key variants), and aes.c lists the suites in a table of
+// aes_kat_suite, so adding a suite is one #include and one table entry.
+//
+// All fields are byte arrays, so a record is the key plus 48 bytes with no
+// padding, and the test reads the vectors straight out of flash through an
+// aes_kat_vector of pointers.
+//
+// The VarKey and VarTxt suites only vary a 0x80, 0xc0, 0xe0, ... bit prefix
+// in the key or the plaintext, so their headers store just the ciphertexts
+// and the suite entry names the generator (aes_gen_varkey/aes_gen_vartxt)
+// that rebuilds the rest of the record from the vector number.
+//
+// Suites imported with tools/rsp2h (see there) are packed: every distinct
+// key is stored once, and the vectors follow each other in one aligned byte
+// array, [IV] plaintext ciphertext, without the duplicated [DECRYPT] half
+// of the NIST file, so the test walks flash front to back.  They also carry
+// the chained modes (CBC, OFB, CFB128) and multi-block messages.
+//
+// The Monte Carlo chains of ECBMCT.h are aes_mct_record arrays listed in a
+// table of aes_mct_suite, and the GCM cases of GCMSpec.h aes_gcm_vector.
+//
+//*****************************************************************************
+
+#ifndef AES_KAT_H
+#define AES_KAT_H
+
+typedef struct {
+  unsigned char key[16];
+  unsigned char cypher[16];
+  unsigned char plain[16];
+  unsigned char input[16];
+} aes_kat_record;
+
+typedef struct {
+  unsigned char key[24];
+  unsigned char cypher[16];
+  unsigned char plain[16];
+  unsigned char input[16];
+} aes_kat_record192;
+
+typedef struct {
+  unsigned char key[32];
+  unsigned char cypher[16];
+  unsigned char plain[16];
+  unsigned char input[16];
+} aes_kat_record256;
+
+//modes of a packed suite
+#define		aes_mode_ecb		0
+#define		aes_mode_cbc		1
+#define		aes_mode_ofb		2
+#define		aes_mode_cfb		3
+
+//the longest message of a packed suite (the MMT files go to 10 blocks)
+#define		aes_kat_max_len		160
+
+typedef struct {
+  const unsigned char *key;
+  const unsigned char *cypher;
+  const unsigned char *plain;
+  const unsigned char *input;
+  const unsigned char *iv;		//0 in ECB
+  unsigned short len;			//bytes of plain and of cypher
+  unsigned char mode;
+} aes_kat_vector;
+
+//a packed suite, defined by its generated header
+typedef struct {
+  const unsigned char *keys;		//distinct keys, key_bits / 8 bytes each
+  const unsigned short *key_index;	//key of each vector
+  const unsigned short *offset;		//start of each vector in data, then the end
+  const unsigned char *data;		//[iv] plain cypher, vector after vector
+  unsigned char mode;
+} aes_packed;
+
+#define		aes_gen_none		0
+#define		aes_gen_varkey		1
+#define		aes_gen_vartxt		2
+#define		aes_gen_packed		3
+
+typedef struct {
+  const char *name;
+  const unsigned char *records;		//full records, aes_gen_none only
+  const unsigned char (*cypher)[16];	//ciphertexts of a generated suite
+  unsigned int count;
+  unsigned short key_bits;
+  unsigned char gen;
+  const aes_packed *packed;		//aes_gen_packed only
+} aes_kat_suite;
+
+//the packed data starts on a 16-byte boundary, so every block does
+#ifdef __GNUC__
+#define aes_aligned		__attribute__((aligned(16)))
+#else
+#define aes_aligned
+#endif
+
+//number of vectors in a stored suite and in a generated one; like a packed
+//suite, a generated one leaves out the [DECRYPT] half of the NIST file,
+//which repeats the [ENCRYPT] vectors
+#define aes_stored_vectors(records)	(sizeof(records) / sizeof(records[0]))
+#define aes_gen_vectors(cypher)		(sizeof(cypher) / sizeof(cypher[0]))
+
+//registry entries for the suite arrays defined in the headers
+#define aes_suite(records, key_bits) \
+  { #records, (const unsigned char *)records, 0, aes_stored_vectors(records), key_bits, aes_gen_none, 0 }
+#define aes_gen_suite(cypher, key_bits, gen) \
+  { #cypher, 0, cypher, aes_gen_vectors(cypher), key_bits, gen, 0 }
+#define aes_packed_suite(name, key_bits) \
+  { #name, 0, 0, aes_stored_vectors(name##_key_index), key_bits, aes_gen_packed, &name }
+
+//Monte Carlo chains (ECBMCT.h): one record per outer iteration, the key and
+//the output of the 1000th chained encryption
+typedef struct {
+  unsigned char key[16];
+  unsigned char cypher[16];
+} aes_mct_record;
+
+typedef struct {
+  unsigned char key[24];
+  unsigned char cypher[16];
+} aes_mct_record192;
+
+typedef struct {
+  unsigned char key[32];
+  unsigned char cypher[16];
+} aes_mct_record256;
+
+typedef struct {
+  const char *name;
+  const unsigned char *records;
+  const unsigned char *seed;		//plaintext of the first iteration
+  unsigned int count;
+  unsigned short key_bits;
+} aes_mct_suite;
+
+#define aes_mct(records, key_bits) \
+  { #records, (const unsigned char *)records, records##_seed, aes_stored_vectors(records), key_bits }
+
+//GCM test cases (GCMSpec.h) have variable lengths, so they point into
+//shared byte arrays
+typedef struct {
+  const unsigned char *key;
+  const unsigned char *iv;
+  const unsigned char *aad;
+  const unsigned char *plain;
+  const unsigned char *cypher;
+  const unsigned char *tag;
+  unsigned short key_bits;
+  unsigned short iv_len;
+  unsigned short aad_len;
+  unsigned short len;
+} aes_gcm_vector;
+
+#endif
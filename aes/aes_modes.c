@@ -0,0 +1,178 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_modes.c
+//
+// CBC, CTR, OFB and CFB modes, see aes_modes.h.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "aes_modes.h"
+#if aes_hw
+#include "aes_ni.h"
+#endif
+
+static void aes_ctr_inc(unsigned char *ctr) {
+  int i = 15;
+
+  while (i >= 0 && ++ctr[i] == 0) {
+    i--;
+  }
+}
+
+void aes_cbc_encrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv) {
+  unsigned long n = 0;
+  int i = 0;
+
+  for (n = 0; n < len; n += 16) {
+    for (i = 0; i < 16; i++) {
+      iv[i] ^= in[n + i];
+    }
+    aes_crypt(iv, iv, ks, 0);
+    memcpy(out + n, iv, 16);
+  }
+}
+
+void aes_cbc_decrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv) {
+  unsigned char c[16];
+  unsigned long n = 0;
+  int i = 0;
+
+#if aes_hw
+  if (aes_ni_level() > 0) {
+    aes_ni_cbc_decrypt(in, out, len / 16, ks, iv);
+    return;
+  }
+#endif
+
+  for (n = 0; n < len; n += 16) {
+    //keep the ciphertext, out may be in
+    memcpy(c, in + n, 16);
+    aes_crypt(c, out + n, ks, 1);
+    for (i = 0; i < 16; i++) {
+      out[n + i] ^= iv[i];
+    }
+    memcpy(iv, c, 16);
+  }
+}
+
+void aes_ctr_crypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *ctr) {
+  unsigned char stream[16];
+  unsigned long n = 0;
+  int i = 0;
+
+#if aes_hw
+  if (aes_ni_level() > 0) {
+    n = len & ~15UL;
+    aes_ni_ctr_crypt(in, out, n / 16, ks, ctr);
+  }
+#endif
+
+  for (; n < len; n += 16) {
+    aes_crypt(ctr, stream, ks, 0);
+    aes_ctr_inc(ctr);
+    for (i = 0; i < 16 && n + i < len; i++) {
+      out[n + i] = in[n + i] ^ stream[i];
+    }
+  }
+}
+
+void aes_ofb_crypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv) {
+  unsigned long n = 0;
+  int i = 0;
+
+  for (n = 0; n < len; n += 16) {
+    aes_crypt(iv, iv, ks, 0);
+    for (i = 0; i < 16 && n + i < len; i++) {
+      out[n + i] = in[n + i] ^ iv[i];
+    }
+  }
+}
+
+void aes_cfb_encrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv) {
+  unsigned long n = 0;
+  int i = 0;
+
+  for (n = 0; n < len; n += 16) {
+    aes_crypt(iv, iv, ks, 0);
+    for (i = 0; i < 16; i++) {
+      iv[i] ^= in[n + i];
+    }
+    memcpy(out + n, iv, 16);
+  }
+}
+
+void aes_cfb_decrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv) {
+  unsigned char c[16];
+  unsigned long n = 0;
+  int i = 0;
+
+  for (n = 0; n < len; n += 16) {
+    //keep the ciphertext, out may be in
+    memcpy(c, in + n, 16);
+    aes_crypt(iv, iv, ks, 0);
+    for (i = 0; i < 16; i++) {
+      out[n + i] = c[i] ^ iv[i];
+    }
+    memcpy(iv, c, 16);
+  }
+}
+
+void aes_cbc_mac(const unsigned char *in, unsigned long len, const aes_key_schedule *ks, unsigned char *mac) {
+  unsigned long n = 0;
+  int i = 0;
+
+  memset(mac, 0, 16);
+  for (n = 0; n < len; n += 16) {
+    for (i = 0; i < 16; i++) {
+      mac[i] ^= in[n + i];
+    }
+    aes_crypt(mac, mac, ks, 0);
+  }
+}
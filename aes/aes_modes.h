@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_modes.h
+//
+// CBC, CTR, OFB and CFB over buffers of any number of blocks, on top of an
+// aes_key_schedule from aes_core.h.  in and out may be the same buffer.
+// The iv/ctr argument is updated as the buffer goes through, so a long
+// stream can be fed in pieces and the chaining state is carried between
+// the calls exactly as it is between the blocks of one call.
+//
+//   aes_cbc_encrypt/aes_cbc_decrypt  len must be a multiple of 16
+//   aes_ctr_crypt                    big-endian 128-bit counter, any len;
+//                                    a partial last block uses the front
+//                                    of its key stream block
+//   aes_ofb_crypt                    any len, iv carries the output block
+//   aes_cfb_encrypt/aes_cfb_decrypt  CFB128, len must be a multiple of 16
+//   aes_cbc_mac                      CBC-MAC of len bytes (multiple of 16)
+//                                    with a zero IV, written to mac
+//
+// On x86 hosts CBC decryption and CTR go through the AES-NI backend,
+// which keeps four blocks in flight; CBC encryption and the MAC are
+// serial by construction and use aes_crypt(), as do OFB and CFB, which
+// are only used for the NIST vectors.
+//
+//*****************************************************************************
+
+#ifndef AES_MODES_H
+#define AES_MODES_H
+
+#include "aes_core.h"
+
+void aes_cbc_encrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv);
+void aes_cbc_decrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv);
+void aes_ctr_crypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *ctr);
+void aes_ofb_crypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv);
+void aes_cfb_encrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv);
+void aes_cfb_decrypt(const unsigned char *in, unsigned char *out, unsigned long len, const aes_key_schedule *ks, unsigned char *iv);
+void aes_cbc_mac(const unsigned char *in, unsigned long len, const aes_key_schedule *ks, unsigned char *mac);
+
+#endif
@@ -0,0 +1,397 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_ni.c
+//
+// AES-NI and VAES backend, see aes_ni.h.  Every function that uses the
+// instructions carries its own target attribute, so the file builds with
+// the default compiler flags and the instructions are only reached after
+// aes_ni_level() has seen them in CPUID.
+//
+//*****************************************************************************
+
+#include "aes_ni.h"
+
+#if aes_hw
+
+#include <string.h>
+#include <immintrin.h>
+
+//rounds of the 128-bit multi-block path
+#define		aes_rounds		10
+
+#define AES_NI		__attribute__((target("aes,sse2")))
+#define AES_VAES	__attribute__((target("aes,sse2,vaes,avx512f")))
+#define AES_CLMUL	__attribute__((target("pclmul,ssse3,sse2")))
+
+//set once by aes_ni_init(), only read afterwards, so the threads share them
+int aes_ni_cpu_level = 0;
+int aes_ni_cpu_clmul = 0;
+
+void aes_ni_init(void) {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("aes")) {
+    aes_ni_cpu_level = 1;
+    if (__builtin_cpu_supports("vaes") && __builtin_cpu_supports("avx512f")) {
+      aes_ni_cpu_level = 2;
+    }
+  }
+  aes_ni_cpu_clmul = __builtin_cpu_supports("pclmul") ? 1 : 0;
+}
+
+int aes_ni_level(void) {
+  return aes_ni_cpu_level;
+}
+
+int aes_ni_has_clmul(void) {
+  return aes_ni_cpu_clmul;
+}
+
+static AES_NI __m128i aes_ni_key_step(__m128i k, __m128i t) {
+  t = _mm_shuffle_epi32(t, 0xff);
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+  k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+  return _mm_xor_si128(k, t);
+}
+
+//the round constant has to be an immediate, hence the macro
+#define KEY_STEP(r, rcon) \
+  rk[r] = aes_ni_key_step(rk[r - 1], _mm_aeskeygenassist_si128(rk[r - 1], rcon))
+
+static AES_NI void aes_ni_expand_key(const unsigned char *key, __m128i *rk) {
+  rk[0] = _mm_loadu_si128((const __m128i *)key);
+  KEY_STEP(1, 0x01);
+  KEY_STEP(2, 0x02);
+  KEY_STEP(3, 0x04);
+  KEY_STEP(4, 0x08);
+  KEY_STEP(5, 0x10);
+  KEY_STEP(6, 0x20);
+  KEY_STEP(7, 0x40);
+  KEY_STEP(8, 0x80);
+  KEY_STEP(9, 0x1b);
+  KEY_STEP(10, 0x36);
+}
+
+//schedule for aesdec: reversed, with InvMixColumns on the inner round keys
+static AES_NI void aes_ni_invert_key(const __m128i *rk, __m128i *dk) {
+  int r = 0;
+
+  dk[0] = rk[aes_rounds];
+  for (r = 1; r < aes_rounds; r++) {
+    dk[r] = _mm_aesimc_si128(rk[aes_rounds - r]);
+  }
+  dk[aes_rounds] = rk[0];
+}
+
+//the key expansion is not on the hot path, so all key sizes share the
+//word-oriented expansion of aes_core.c; only the decryption keys need the
+//aesimc instruction
+AES_NI void aes_ni_key_setup(const unsigned char *key, int key_bits, aes_key_schedule *ks) {
+  uint32_t rk[aes_rk_words];
+  unsigned char b[16];
+  __m128i k;
+  int rounds = 0;
+  int r = 0;
+  int i = 0;
+
+  rounds = aes_expand_key(key, key_bits / 32, rk);
+  ks->rounds = rounds;
+
+  for (r = 0; r <= rounds; r++) {
+    for (i = 0; i < 16; i++) {
+      b[i] = (unsigned char)(rk[4 * r + i / 4] >> (24 - 8 * (i % 4)));
+    }
+    k = _mm_loadu_si128((const __m128i *)b);
+    _mm_storeu_si128((__m128i *)(ks->enc + 4 * r), k);
+    if (r != 0 && r != rounds) {
+      k = _mm_aesimc_si128(k);
+    }
+    _mm_storeu_si128((__m128i *)(ks->dec + 4 * (rounds - r)), k);
+  }
+}
+
+#if aes_checkpoints
+#define CKPT(r, s)	_mm_storeu_si128((__m128i *)aes_ckpt.round[r], s)
+#else
+#define CKPT(r, s)
+#endif
+
+AES_NI void aes_ni_crypt(const unsigned char *in, unsigned char *out, const aes_key_schedule *ks, unsigned char dir) {
+  const __m128i *k;
+  __m128i s;
+  int rounds = ks->rounds;
+  int r = 0;
+
+  s = _mm_loadu_si128((const __m128i *)in);
+
+  if (dir == 0) {
+    k = (const __m128i *)ks->enc;
+    s = _mm_xor_si128(s, _mm_loadu_si128(k));
+    CKPT(0, s);
+    for (r = 1; r < rounds; r++) {
+      s = _mm_aesenc_si128(s, _mm_loadu_si128(k + r));
+      CKPT(r, s);
+    }
+    s = _mm_aesenclast_si128(s, _mm_loadu_si128(k + rounds));
+  }
+  else {
+    k = (const __m128i *)ks->dec;
+    s = _mm_xor_si128(s, _mm_loadu_si128(k));
+    CKPT(0, s);
+    for (r = 1; r < rounds; r++) {
+      s = _mm_aesdec_si128(s, _mm_loadu_si128(k + r));
+      CKPT(r, s);
+    }
+    s = _mm_aesdeclast_si128(s, _mm_loadu_si128(k + rounds));
+  }
+  CKPT(rounds, s);
+
+  _mm_storeu_si128((__m128i *)out, s);
+}
+
+AES_NI void aes_ni_enc_dec(unsigned char *state, unsigned char *key, unsigned char dir) {
+  aes_key_schedule ks;
+
+  aes_ni_key_setup(key, 128, &ks);
+  aes_ni_crypt(state, state, &ks, dir);
+}
+
+//CTR and CBC decryption have no dependency between blocks, so four are
+//kept in flight to cover the latency of the aesenc/aesdec unit
+
+static unsigned char *aes_ni_ctr_next(unsigned char *ctr, unsigned char *block) {
+  int i = 15;
+
+  memcpy(block, ctr, 16);
+  while (i >= 0 && ++ctr[i] == 0) {
+    i--;
+  }
+  return block;
+}
+
+AES_NI void aes_ni_ctr_crypt(const unsigned char *in, unsigned char *out, unsigned long blocks, const aes_key_schedule *ks, unsigned char *ctr) {
+  const __m128i *k = (const __m128i *)ks->enc;
+  unsigned char b[16];
+  __m128i s[4];
+  __m128i rk;
+  unsigned long n = 0;
+  int rounds = ks->rounds;
+  int r = 0;
+  int l = 0;
+
+  for (; n + 4 <= blocks; n += 4) {
+    rk = _mm_loadu_si128(k);
+    for (l = 0; l < 4; l++) {
+      s[l] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)aes_ni_ctr_next(ctr, b)), rk);
+    }
+    for (r = 1; r < rounds; r++) {
+      rk = _mm_loadu_si128(k + r);
+      for (l = 0; l < 4; l++) {
+	s[l] = _mm_aesenc_si128(s[l], rk);
+      }
+    }
+    rk = _mm_loadu_si128(k + rounds);
+    for (l = 0; l < 4; l++) {
+      s[l] = _mm_aesenclast_si128(s[l], rk);
+      s[l] = _mm_xor_si128(s[l], _mm_loadu_si128((const __m128i *)(in + 16 * (n + l))));
+      _mm_storeu_si128((__m128i *)(out + 16 * (n + l)), s[l]);
+    }
+  }
+  for (; n < blocks; n++) {
+    aes_ni_crypt(aes_ni_ctr_next(ctr, b), b, ks, 0);
+    s[0] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)b), _mm_loadu_si128((const __m128i *)(in + 16 * n)));
+    _mm_storeu_si128((__m128i *)(out + 16 * n), s[0]);
+  }
+}
+
+AES_NI void aes_ni_cbc_decrypt(const unsigned char *in, unsigned char *out, unsigned long blocks, const aes_key_schedule *ks, unsigned char *iv) {
+  const __m128i *k = (const __m128i *)ks->dec;
+  __m128i c[4];
+  __m128i s[4];
+  __m128i rk;
+  __m128i v;
+  unsigned long n = 0;
+  int rounds = ks->rounds;
+  int r = 0;
+  int l = 0;
+
+  v = _mm_loadu_si128((const __m128i *)iv);
+  for (; n + 4 <= blocks; n += 4) {
+    rk = _mm_loadu_si128(k);
+    for (l = 0; l < 4; l++) {
+      c[l] = _mm_loadu_si128((const __m128i *)(in + 16 * (n + l)));
+      s[l] = _mm_xor_si128(c[l], rk);
+    }
+    for (r = 1; r < rounds; r++) {
+      rk = _mm_loadu_si128(k + r);
+      for (l = 0; l < 4; l++) {
+	s[l] = _mm_aesdec_si128(s[l], rk);
+      }
+    }
+    rk = _mm_loadu_si128(k + rounds);
+    for (l = 0; l < 4; l++) {
+      s[l] = _mm_aesdeclast_si128(s[l], rk);
+      s[l] = _mm_xor_si128(s[l], l == 0 ? v : c[l - 1]);
+      _mm_storeu_si128((__m128i *)(out + 16 * (n + l)), s[l]);
+    }
+    v = c[3];
+  }
+  for (; n < blocks; n++) {
+    c[0] = _mm_loadu_si128((const __m128i *)(in + 16 * n));
+    aes_ni_crypt(in + 16 * n, out + 16 * n, ks, 1);
+    s[0] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(out + 16 * n)), v);
+    _mm_storeu_si128((__m128i *)(out + 16 * n), s[0]);
+    v = c[0];
+  }
+  _mm_storeu_si128((__m128i *)iv, v);
+}
+
+//four blocks with four keys: lane l of round key r is block l's round key
+static AES_VAES void aes_vaes_enc_dec4(unsigned char *state, const unsigned char *key, unsigned char dir) {
+  unsigned char lanes[aes_rounds + 1][64];
+  __m128i rk[aes_rounds + 1];
+  __m128i dk[aes_rounds + 1];
+  __m512i k[aes_rounds + 1];
+  __m512i s;
+  int l = 0;
+  int r = 0;
+
+  for (l = 0; l < 4; l++) {
+    aes_ni_expand_key(key + 16 * l, rk);
+    if (dir != 0) {
+      aes_ni_invert_key(rk, dk);
+    }
+    for (r = 0; r <= aes_rounds; r++) {
+      _mm_storeu_si128((__m128i *)(lanes[r] + 16 * l), dir == 0 ? rk[r] : dk[r]);
+    }
+  }
+  for (r = 0; r <= aes_rounds; r++) {
+    k[r] = _mm512_loadu_si512(lanes[r]);
+  }
+
+  s = _mm512_loadu_si512(state);
+  s = _mm512_xor_si512(s, k[0]);
+  if (dir == 0) {
+    for (r = 1; r < aes_rounds; r++) {
+      s = _mm512_aesenc_epi128(s, k[r]);
+    }
+    s = _mm512_aesenclast_epi128(s, k[aes_rounds]);
+  }
+  else {
+    for (r = 1; r < aes_rounds; r++) {
+      s = _mm512_aesdec_epi128(s, k[r]);
+    }
+    s = _mm512_aesdeclast_epi128(s, k[aes_rounds]);
+  }
+  _mm512_storeu_si512(state, s);
+}
+
+void aes_ni_enc_dec_multi(unsigned char *state, const unsigned char *key, int n, unsigned char dir) {
+  int i = 0;
+
+  if (aes_ni_level() > 1) {
+    for (; i + 4 <= n; i += 4) {
+      aes_vaes_enc_dec4(state + 16 * i, key + 16 * i, dir);
+    }
+  }
+  for (; i < n; i++) {
+    aes_ni_enc_dec(state + 16 * i, (unsigned char *)key + 16 * i, dir);
+  }
+}
+
+//GHASH product of two byte-reversed blocks: the 256-bit carry-less product
+//of the four 64-bit halves, shifted left once for the bit reflection of
+//GCM and reduced modulo x^128 + x^7 + x^2 + x + 1
+static AES_CLMUL __m128i aes_ni_gfmul(__m128i a, __m128i b) {
+  __m128i lo, hi, mid, t1, t2, t3;
+
+  lo = _mm_clmulepi64_si128(a, b, 0x00);
+  hi = _mm_clmulepi64_si128(a, b, 0x11);
+  mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01));
+  lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+  hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+  //256-bit shift left by one
+  t1 = _mm_srli_epi32(lo, 31);
+  t2 = _mm_srli_epi32(hi, 31);
+  lo = _mm_slli_epi32(lo, 1);
+  hi = _mm_slli_epi32(hi, 1);
+  t3 = _mm_srli_si128(t1, 12);
+  t2 = _mm_slli_si128(t2, 4);
+  t1 = _mm_slli_si128(t1, 4);
+  lo = _mm_or_si128(lo, t1);
+  hi = _mm_or_si128(hi, t2);
+  hi = _mm_or_si128(hi, t3);
+
+  //reduction, first and second phase
+  t1 = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)), _mm_slli_epi32(lo, 25));
+  t2 = _mm_srli_si128(t1, 4);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(t1, 12));
+  t1 = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)), _mm_srli_epi32(lo, 7));
+  t1 = _mm_xor_si128(t1, t2);
+  lo = _mm_xor_si128(lo, t1);
+  return _mm_xor_si128(hi, lo);
+}
+
+AES_CLMUL void aes_ni_ghash(const unsigned char *h, unsigned char *x, const unsigned char *data, unsigned long blocks) {
+  const __m128i rev = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  __m128i hv;
+  __m128i xv;
+  unsigned long n = 0;
+
+  hv = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)h), rev);
+  xv = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)x), rev);
+  for (n = 0; n < blocks; n++) {
+    xv = _mm_xor_si128(xv, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * n)), rev));
+    xv = aes_ni_gfmul(xv, hv);
+  }
+  _mm_storeu_si128((__m128i *)x, _mm_shuffle_epi8(xv, rev));
+}
+
+#endif
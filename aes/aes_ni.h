@@ -0,0 +1,90 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_ni.h
+//
+// AES-NI backend for x86 hosts.  aes_ni_init() probes CPUID once, from main
+// before any thread starts, and aes_ni_level() then reports:
+//
+//   0  no AES instructions, callers fall back to aes_core.c
+//   1  AES-NI, one 128-bit block per instruction
+//   2  AES-NI plus VAES with AVX-512, four blocks per instruction
+//
+// aes_ni_key_setup() and aes_ni_crypt() back aes_key_setup() and aes_crypt();
+// the schedule then holds the 128-bit round keys of each direction exactly
+// as the aesenc/aesdec instructions consume them.
+// aes_ni_enc_dec() has the aes_enc_dec() signature.  aes_ni_enc_dec_multi()
+// takes n consecutive blocks and n consecutive 128-bit keys like
+// aes_bs_enc_dec() and uses the widest unit the part has.
+// aes_ni_ctr_crypt() and aes_ni_cbc_decrypt() back the streaming modes of
+// aes_modes.c over whole blocks.  aes_ni_has_clmul() tells whether CPUID had
+// PCLMULQDQ and aes_ni_ghash() folds whole blocks into a GCM hash with it.
+//
+//*****************************************************************************
+
+#ifndef AES_NI_H
+#define AES_NI_H
+
+#include "aes_core.h"
+
+#if aes_hw
+
+void aes_ni_init(void);
+int aes_ni_level(void);
+void aes_ni_key_setup(const unsigned char *key, int key_bits, aes_key_schedule *ks);
+void aes_ni_crypt(const unsigned char *in, unsigned char *out, const aes_key_schedule *ks, unsigned char dir);
+void aes_ni_enc_dec(unsigned char *state, unsigned char *key, unsigned char dir);
+void aes_ni_enc_dec_multi(unsigned char *state, const unsigned char *key, int n, unsigned char dir);
+void aes_ni_ctr_crypt(const unsigned char *in, unsigned char *out, unsigned long blocks, const aes_key_schedule *ks, unsigned char *ctr);
+void aes_ni_cbc_decrypt(const unsigned char *in, unsigned char *out, unsigned long blocks, const aes_key_schedule *ks, unsigned char *iv);
+int aes_ni_has_clmul(void);
+void aes_ni_ghash(const unsigned char *h, unsigned char *x, const unsigned char *data, unsigned long blocks);
+
+#endif
+
+#endif
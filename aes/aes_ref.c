@@ -0,0 +1,234 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// aes_ref.c
+//
+// Table-free reference AES for fault localization, see aes_ref.h.
+//
+//*****************************************************************************
+
+#include <string.h>
+#include "aes_ref.h"
+
+static unsigned char ref_xtime(unsigned char x) {
+  return (unsigned char)((x << 1) ^ ((x & 0x80) ? 0x1b : 0x00));
+}
+
+static unsigned char ref_mul(unsigned char a, unsigned char b) {
+  unsigned char p = 0;
+
+  while (b) {
+    if (b & 1) {
+      p ^= a;
+    }
+    a = ref_xtime(a);
+    b >>= 1;
+  }
+  return p;
+}
+
+static unsigned char ref_rotl(unsigned char x, int n) {
+  return (unsigned char)((x << n) | (x >> (8 - n)));
+}
+
+//x^254 is the inverse in GF(2^8), and maps 0 to 0 as the S-box wants
+static unsigned char ref_inv(unsigned char x) {
+  unsigned char y = x;
+  int i = 0;
+
+  for (i = 0; i < 6; i++) {
+    y = ref_mul(ref_mul(y, y), x);
+  }
+  return ref_mul(y, y);
+}
+
+static unsigned char ref_sbox(unsigned char x) {
+  x = ref_inv(x);
+  return x ^ ref_rotl(x, 1) ^ ref_rotl(x, 2) ^ ref_rotl(x, 3) ^ ref_rotl(x, 4) ^ 0x63;
+}
+
+static unsigned char ref_inv_sbox(unsigned char x) {
+  return ref_inv(ref_rotl(x, 1) ^ ref_rotl(x, 3) ^ ref_rotl(x, 6) ^ 0x05);
+}
+
+//round keys as 16-byte blocks, (rounds + 1) of them
+static int ref_expand(const unsigned char *key, int key_bits, unsigned char w[][16]) {
+  unsigned char *b = w[0];
+  unsigned char t[4];
+  unsigned char rcon = 1;
+  unsigned char x = 0;
+  int nk = key_bits / 32;
+  int rounds = nk + 6;
+  int i = 0;
+
+  memcpy(b, key, 4 * nk);
+  for (i = nk; i < 4 * (rounds + 1); i++) {
+    memcpy(t, b + 4 * (i - 1), 4);
+    if (i % nk == 0) {
+      x = t[0];
+      t[0] = ref_sbox(t[1]) ^ rcon;
+      t[1] = ref_sbox(t[2]);
+      t[2] = ref_sbox(t[3]);
+      t[3] = ref_sbox(x);
+      rcon = ref_xtime(rcon);
+    }
+    else if (nk > 6 && i % nk == 4) {
+      t[0] = ref_sbox(t[0]);
+      t[1] = ref_sbox(t[1]);
+      t[2] = ref_sbox(t[2]);
+      t[3] = ref_sbox(t[3]);
+    }
+    b[4 * i] = b[4 * (i - nk)] ^ t[0];
+    b[4 * i + 1] = b[4 * (i - nk) + 1] ^ t[1];
+    b[4 * i + 2] = b[4 * (i - nk) + 2] ^ t[2];
+    b[4 * i + 3] = b[4 * (i - nk) + 3] ^ t[3];
+  }
+  return rounds;
+}
+
+static void ref_add_key(unsigned char *s, const unsigned char *k) {
+  int i = 0;
+
+  for (i = 0; i < 16; i++) {
+    s[i] ^= k[i];
+  }
+}
+
+//SubBytes and ShiftRows: byte i of the state is row i % 4, column i / 4
+static void ref_sub_shift(unsigned char *s, unsigned char inv) {
+  unsigned char t[16];
+  int i = 0;
+  int row = 0;
+  int col = 0;
+
+  for (i = 0; i < 16; i++) {
+    row = i % 4;
+    col = i / 4;
+    if (!inv) {
+      t[i] = ref_sbox(s[row + 4 * ((col + row) % 4)]);
+    }
+    else {
+      t[i] = ref_inv_sbox(s[row + 4 * ((col + 4 - row) % 4)]);
+    }
+  }
+  memcpy(s, t, 16);
+}
+
+static void ref_mix(unsigned char *s, unsigned char inv) {
+  static const unsigned char m[2][4] = { { 2, 3, 1, 1 }, { 14, 11, 13, 9 } };
+  unsigned char t[4];
+  int c = 0;
+  int row = 0;
+  int i = 0;
+
+  for (c = 0; c < 4; c++) {
+    for (row = 0; row < 4; row++) {
+      t[row] = 0;
+      for (i = 0; i < 4; i++) {
+	t[row] ^= ref_mul(m[inv][(i + 4 - row) % 4], s[4 * c + i]);
+      }
+    }
+    memcpy(s + 4 * c, t, 4);
+  }
+}
+
+int aes_ref_rounds(const unsigned char *in, const unsigned char *key, int key_bits, unsigned char dir, unsigned char states[][16]) {
+  unsigned char w[aes_max_rounds + 1][16];
+  unsigned char s[16];
+  int rounds = 0;
+  int r = 0;
+
+  rounds = ref_expand(key, key_bits, w);
+  memcpy(s, in, 16);
+
+  if (dir == 0) {
+    ref_add_key(s, w[0]);
+    memcpy(states[0], s, 16);
+    for (r = 1; r <= rounds; r++) {
+      ref_sub_shift(s, 0);
+      if (r != rounds) {
+	ref_mix(s, 0);
+      }
+      ref_add_key(s, w[r]);
+      memcpy(states[r], s, 16);
+    }
+  }
+  else {
+    ref_add_key(s, w[rounds]);
+    memcpy(states[0], s, 16);
+    for (r = 1; r <= rounds; r++) {
+      ref_sub_shift(s, 1);
+      ref_add_key(s, w[rounds - r]);
+      if (r != rounds) {
+	ref_mix(s, 1);
+      }
+      memcpy(states[r], s, 16);
+    }
+  }
+  return rounds;
+}
+
+#if aes_checkpoints
+int aes_ckpt_first_fault(const unsigned char *key, int key_bits) {
+  unsigned char states[aes_max_rounds + 1][16];
+  int rounds = 0;
+  int r = 0;
+
+  rounds = aes_ref_rounds(aes_ckpt.in, key, key_bits, aes_ckpt.dir, states);
+  //a wrong round count is itself a fault before round 1
+  if (rounds != aes_ckpt.rounds) {
+    return 0;
+  }
+  for (r = 0; r <= rounds; r++) {
+    if (memcmp(states[r], aes_ckpt.round[r], 16) != 0) {
+      return r;
+    }
+  }
+  return -1;
+}
+#endif
@@ -0,0 +1,466 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// rsp2h.c
+//
+// Host tool that turns a NIST AESAVS response file into a test vector
+// header for aes.c:
+//
+//   cc -o rsp2h tools/rsp2h.c
+//   ./rsp2h rsp/ECBGFSbox128.rsp > ECBGFSbox128.h
+//
+// The mode comes from the file name (ECB, CBC, OFB or CFB128 in front) and
+// the array names from the file name without .rsp.  The KAT and MMT files
+// (GFSbox, KeySbox, VarKey, VarTxt, MMT) become a packed suite (aes_packed
+// in aes_kat.h):
+//
+//   name_keys       every distinct key once, in order of first use
+//   name_key_index  the key of each vector
+//   name_offset     where each vector starts in name_data, then the end
+//   name_data       [IV] plaintext ciphertext of each vector, aligned
+//
+// A vector that appears again, as every KAT vector does under [DECRYPT],
+// is dropped, since aes.c checks both directions of each vector anyway.
+// The header is listed in aes.c with aes_packed_suite(name, key_bits),
+// which the tool prints on stderr.
+// Keys that are not 16, 24 or 32 bytes are refused, and so is a file with
+// more than 64 KB of vector data, which name_offset (unsigned short) cannot
+// reach.
+//
+// An ECB MCT file becomes the aes_mct_record array and _seed of ECBMCT.h
+// from its [ENCRYPT] half; aes.c lists it with aes_mct().  The Monte Carlo
+// procedures of the chained modes and the 1 and 8-bit CFB files are not
+// supported and are refused.
+//
+//*****************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define max_vectors		4096
+#define max_len			160	//aes_kat_max_len
+
+#define mode_ecb		0
+#define mode_cbc		1
+#define mode_ofb		2
+#define mode_cfb		3
+
+typedef struct {
+  unsigned char key[32];
+  unsigned char iv[16];
+  unsigned char plain[max_len];
+  unsigned char cypher[max_len];
+  int key_len;
+  int len;
+  int has_plain;
+  int has_cypher;
+  int encrypt;
+} rsp_vector;
+
+const char *license[] = {
+  "/*",
+  "Copyright (c) 2015, Los Alamos National Security, LLC",
+  "All rights reserved.",
+  "",
+  "Copyright 2015. Los Alamos National Security, LLC. This software was",
+  "produced under U.S. Government contract DE-AC52-06NA25396 for Los",
+  "Alamos National Laboratory (LANL), which is operated by Los Alamos",
+  "National Security, LLC for the U.S. Department of Energy. The",
+  "U.S. Government has rights to use, reproduce, and distribute this",
+  "software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,",
+  "LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY",
+  "FOR THE USE OF THIS SOFTWARE.  If software is modified to produce",
+  "derivative works, such modified software should be clearly marked, so",
+  "as not to confuse it with the version available from LANL.",
+  "",
+  "Additionally, redistribution and use in source and binary forms, with",
+  "or without modification, are permitted provided that the following",
+  "conditions are met:",
+  "",
+  "• Redistributions of source code must retain the above copyright",
+  "         notice, this list of conditions and the following disclaimer.",
+  "",
+  "• Redistributions in binary form must reproduce the above copyright",
+  "         notice, this list of conditions and the following disclaimer",
+  "         in the documentation and/or other materials provided with the",
+  "         distribution.",
+  "",
+  "• Neither the name of Los Alamos National Security, LLC, Los Alamos",
+  "         National Laboratory, LANL, the U.S. Government, nor the names",
+  "         of its contributors may be used to endorse or promote",
+  "         products derived from this software without specific prior",
+  "         written permission.",
+  "",
+  "THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND",
+  "CONTRIBUTORS \"AS IS\" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,",
+  "BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND",
+  "FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS",
+  "ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY",
+  "DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL",
+  "DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE",
+  "GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS",
+  "INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER",
+  "IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR",
+  "OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF",
+  "ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/",
+};
+
+const char *mode_names[] = { "aes_mode_ecb", "aes_mode_cbc", "aes_mode_ofb", "aes_mode_cfb" };
+
+rsp_vector vectors[max_vectors];
+int vector_count = 0;
+int key_index[max_vectors];
+int keys[max_vectors];		//vector holding each distinct key
+int key_count = 0;
+
+void fail(const char *what, const char *arg) {
+  fprintf(stderr, "rsp2h: %s%s\n", what, arg);
+  exit(1);
+}
+
+//hex string to bytes, returns the number of bytes
+int parse_hex(const char *hex, unsigned char *out, int max) {
+  int n = 0;
+  unsigned int byte = 0;
+
+  while (hex[0] && hex[1]) {
+    if (n == max) {
+      fail("value too long: ", hex);
+    }
+    if (sscanf(hex, "%2x", &byte) != 1) {
+      fail("bad hex: ", hex);
+    }
+    out[n++] = (unsigned char)byte;
+    hex += 2;
+  }
+  return n;
+}
+
+void print_bytes(const unsigned char *p, int len, const char *indent, const char *end) {
+  int i = 0;
+
+  printf("%s", indent);
+  for (i = 0; i < len; i++) {
+    printf("0x%02x%s", p[i], i + 1 < len ? ", " : "");
+  }
+  printf("%s", end);
+}
+
+//read the vectors of the file, a new vector starts at each COUNT line
+void read_rsp(FILE *f) {
+  char line[1024];
+  char *value;
+  char *end;
+  int encrypt = 1;
+  rsp_vector *v = 0;
+  int len = 0;
+
+  while (fgets(line, sizeof(line), f)) {
+    end = line + strlen(line);
+    while (end > line && (end[-1] == '\n' || end[-1] == '\r' || end[-1] == ' ')) {
+      *--end = 0;
+    }
+    if (line[0] == '#' || line[0] == 0) {
+      continue;
+    }
+    if (line[0] == '[') {
+      encrypt = strcmp(line, "[DECRYPT]") != 0;
+      continue;
+    }
+    value = strstr(line, " = ");
+    if (!value) {
+      fail("cannot parse: ", line);
+    }
+    *value = 0;
+    value += 3;
+
+    if (strcmp(line, "COUNT") == 0) {
+      if (vector_count == max_vectors) {
+	fail("too many vectors", "");
+      }
+      v = &vectors[vector_count++];
+      memset(v, 0, sizeof(*v));
+      v->encrypt = encrypt;
+      continue;
+    }
+    if (!v) {
+      fail("value before COUNT: ", line);
+    }
+    if (strcmp(line, "KEY") == 0) {
+      v->key_len = parse_hex(value, v->key, 32);
+      if (v->key_len != 16 && v->key_len != 24 && v->key_len != 32) {
+	fail("key is not 16, 24 or 32 bytes: ", value);
+      }
+    }
+    else if (strcmp(line, "IV") == 0) {
+      if (parse_hex(value, v->iv, 16) != 16) {
+	fail("IV is not 16 bytes: ", value);
+      }
+    }
+    else if (strcmp(line, "PLAINTEXT") == 0 || strcmp(line, "CIPHERTEXT") == 0) {
+      len = parse_hex(value, line[0] == 'P' ? v->plain : v->cypher, max_len);
+      if (len == 0 || len % 16 || (v->len && len != v->len)) {
+	fail("bad message length: ", value);
+      }
+      v->len = len;
+      if (line[0] == 'P') {
+	v->has_plain = 1;
+      }
+      else {
+	v->has_cypher = 1;
+      }
+    }
+    else {
+      fail("unknown field: ", line);
+    }
+  }
+}
+
+int same_vector(const rsp_vector *a, const rsp_vector *b) {
+  return a->key_len == b->key_len && a->len == b->len &&
+    memcmp(a->key, b->key, a->key_len) == 0 && memcmp(a->iv, b->iv, 16) == 0 &&
+    memcmp(a->plain, b->plain, a->len) == 0 && memcmp(a->cypher, b->cypher, a->len) == 0;
+}
+
+//drop repeated vectors and number the distinct keys
+void pack(void) {
+  int i = 0;
+  int j = 0;
+  int kept = 0;
+
+  for (i = 0; i < vector_count; i++) {
+    if (!vectors[i].has_plain || !vectors[i].has_cypher || vectors[i].key_len != vectors[0].key_len) {
+      fail("incomplete vector or mixed key sizes", "");
+    }
+    for (j = 0; j < kept; j++) {
+      if (same_vector(&vectors[i], &vectors[j])) {
+	break;
+      }
+    }
+    if (j < kept) {
+      continue;
+    }
+    vectors[kept] = vectors[i];
+
+    for (j = 0; j < key_count; j++) {
+      if (memcmp(vectors[keys[j]].key, vectors[kept].key, vectors[kept].key_len) == 0) {
+	break;
+      }
+    }
+    if (j == key_count) {
+      keys[key_count++] = kept;
+    }
+    key_index[kept++] = j;
+  }
+  vector_count = kept;
+}
+
+void print_packed(const char *name, int mode) {
+  int i = 0;
+  int n = 0;
+  int key_len = vectors[0].key_len;
+  int offset = 0;
+  int iv = mode != mode_ecb ? 16 : 0;
+
+  //the offsets are unsigned short in aes_packed
+  for (i = 0; i < vector_count; i++) {
+    offset += iv + 2 * vectors[i].len;
+  }
+  if (offset > 0xffff) {
+    fail("more than 64 KB of vector data, split the file", "");
+  }
+  offset = 0;
+
+  printf("//%s in the packed layout of aes_kat.h: %i vectors under %i key%s.\n", name, vector_count, key_count, key_count == 1 ? "" : "s");
+  printf("//Each vector is ");
+  printf(iv ? "its IV, its plaintext and its ciphertext.\n\n" : "its plaintext followed by its ciphertext.\n\n");
+
+  printf("const unsigned char %s_keys[%i][%i] = {\n", name, key_count, key_len);
+  for (i = 0; i < key_count; i++) {
+    print_bytes(vectors[keys[i]].key, key_len, "\t{ ", " },\n");
+  }
+  printf("};\n\n");
+
+  printf("const unsigned short %s_key_index[%i] = {\n", name, vector_count);
+  for (i = 0; i < vector_count; i++) {
+    printf("%s%i%s", i % 16 ? " " : "\t", key_index[i], i + 1 == vector_count ? "\n" : i % 16 == 15 ? ",\n" : ",");
+  }
+  printf("};\n\n");
+
+  printf("const unsigned short %s_offset[%i] = {\n", name, vector_count + 1);
+  for (i = 0; i <= vector_count; i++) {
+    printf("%s%i%s", i % 16 ? " " : "\t", offset, i == vector_count ? "\n" : i % 16 == 15 ? ",\n" : ",");
+    if (i < vector_count) {
+      offset += iv + 2 * vectors[i].len;
+    }
+  }
+  printf("};\n\n");
+
+  printf("const unsigned char %s_data[%i] aes_aligned = {\n", name, offset);
+  for (i = 0; i < vector_count; i++) {
+    if (iv) {
+      print_bytes(vectors[i].iv, 16, "\t", ",\n");
+    }
+    for (n = 0; n < vectors[i].len; n += 16) {
+      print_bytes(vectors[i].plain + n, 16, "\t", ",\n");
+    }
+    for (n = 0; n < vectors[i].len; n += 16) {
+      print_bytes(vectors[i].cypher + n, 16, "\t", ",\n");
+    }
+  }
+  printf("};\n\n");
+
+  printf("const aes_packed %s = { (const unsigned char *)%s_keys, %s_key_index, %s_offset, %s_data, %s };\n",
+	 name, name, name, name, name, mode_names[mode]);
+
+  fprintf(stderr, "  aes_packed_suite(%s, %i),\n", name, key_len * 8);
+}
+
+//the [ENCRYPT] records of an ECB MCT file, each plaintext has to be the
+//previous ciphertext
+void print_mct(const char *name) {
+  int i = 0;
+  int count = 0;
+  int key_len = vectors[0].key_len;
+
+  for (i = 0; i < vector_count && vectors[i].encrypt; i++) {
+    if (!vectors[i].has_plain || !vectors[i].has_cypher || vectors[i].len != 16 || vectors[i].key_len != key_len) {
+      fail("bad MCT record", "");
+    }
+    if (i > 0 && memcmp(vectors[i].plain, vectors[i - 1].cypher, 16) != 0) {
+      fail("MCT records do not chain", "");
+    }
+  }
+  count = i;
+  if (count == 0) {
+    fail("no [ENCRYPT] records", "");
+  }
+
+  printf("//%s: the [ENCRYPT] chain of the NIST file in the ECBMCT.h layout.\n\n", name);
+  printf("const unsigned char %s_seed[16] = ", name);
+  print_bytes(vectors[0].plain, 16, "{ ", " };\n\n");
+
+  printf("const aes_mct_record%s %s[] = {\n", key_len == 16 ? "" : key_len == 24 ? "192" : "256", name);
+  for (i = 0; i < count; i++) {
+    print_bytes(vectors[i].key, key_len, "\t{ { ", " },\n");
+    print_bytes(vectors[i].cypher, 16, "\t  { ", " } },\n");
+  }
+  printf("};\n");
+
+  fprintf(stderr, "  aes_mct(%s, %i),\n", name, key_len * 8);
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  char name[256];
+  const char *base;
+  char *dot;
+  int mode = mode_ecb;
+  int mct = 0;
+  int i = 0;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: rsp2h file.rsp > file.h\n");
+    return 1;
+  }
+
+  base = strrchr(argv[1], '/');
+  base = base ? base + 1 : argv[1];
+  strncpy(name, base, sizeof(name) - 1);
+  name[sizeof(name) - 1] = 0;
+  dot = strrchr(name, '.');
+  if (dot) {
+    *dot = 0;
+  }
+
+  if (strncmp(name, "ECB", 3) == 0) {
+    mode = mode_ecb;
+  }
+  else if (strncmp(name, "CBC", 3) == 0) {
+    mode = mode_cbc;
+  }
+  else if (strncmp(name, "OFB", 3) == 0) {
+    mode = mode_ofb;
+  }
+  else if (strncmp(name, "CFB128", 6) == 0) {
+    mode = mode_cfb;
+  }
+  else {
+    fail("unsupported mode: ", name);
+  }
+  mct = strstr(name, "MCT") != 0;
+  if (mct && mode != mode_ecb) {
+    fail("only the ECB Monte Carlo procedure is supported: ", name);
+  }
+
+  f = fopen(argv[1], "r");
+  if (!f) {
+    fail("cannot open ", argv[1]);
+  }
+  read_rsp(f);
+  fclose(f);
+  if (vector_count == 0) {
+    fail("no vectors in ", argv[1]);
+  }
+
+  for (i = 0; i < (int)(sizeof(license) / sizeof(license[0])); i++) {
+    printf("%s\n", license[i]);
+  }
+  printf("\n//Generated from %s by tools/rsp2h, do not edit.\n\n", base);
+  printf("#include \"aes_kat.h\"\n\n");
+
+  if (mct) {
+    print_mct(name);
+  }
+  else {
+    pack();
+    print_packed(name, mode);
+  }
+  return 0;
+}
@@ -55,11 +55,22 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 // This test is a simple program for instrumenting SRAM memory blocks or caches.
 // It tests the foura mostly 0s memory pattern.  A simple sum of
 // memory array elements is also done to check for transients in logic.
-// Keep in mind that the sum checker is hardcoded.  If the memory arrays change
-// size or values, it is necessary to change the sum values, too.
+// The data pattern is chosen with data_pattern, and its expected values and
+// the sum it should add up to are closed-form macros, so the sum constant
+// follows the array size and the pattern at compile time.
+//
+// With march_test set the same memory is run through a March test instead
+// (March C-, March SS or MATS+), which writes as well as reads every word
+// and catches stuck-at, transition and coupling faults the read pattern
+// cannot see.
 //
 // This software is otimized for TI microcontrollers, specifically the
-// MSP430F2619.
+// MSP430F2619.  When __MSP430__ is not defined the part initialization is
+// skipped and sendByte() writes to stdout, so it also runs on a Linux host,
+// where cache_sweep_mode reads the cache topology from sysfs and runs the
+// sum check over one array sized for each cache level and one for memory,
+// and cache_threaded runs the test on one pinned thread per core, each on
+// its own region, so the private caches of every core are under test.
 //
 // The output is designed to go out the UART at a speed of 9,600 baud and uses a
 // tiny printf to reduce printf footprint.  The tiny printf can be downloaded from 
@@ -70,68 +81,877 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 //*****************************************************************************
 
 
+#ifdef __MSP430__
 #include <msp430.h>
+#else
+#define _GNU_SOURCE
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <stdlib.h>
+#include <time.h>
+#endif
+#if defined(__x86_64__) && !defined(__MSP430__)
+#include <immintrin.h>
+#endif
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
 
 void sendByte(char);
 void printf(char *, ...);
 void initUART(void);
 void initMSP430();
-void cache_test(void);
-void init_array(int array[]);
-int calc_sum(int array[]);
+void scrub_wait(void);
+unsigned long cache_clock_ns(void);
+void cache_test(int *mem, int n);
+void init_array(int array[], int n);
+int calc_sum(int array[], int n);
+void scan_init(void);
+int calc_scan(const int *array, int from, int n, unsigned int *sum);
+const char *scan_engine(void);
+void block_start(void);
+void report_word(int i, int value, unsigned int good, int first);
+void upset_note(int i, unsigned int flipped);
+void upset_cluster(void);
+void upset_report(void);
+void print_lock(void);
+void print_unlock(void);
+void march_pass(void);
+void march_fault(int element, int addr, unsigned long value);
+void march_close(void);
 
 #define 	robust_printing			1
 #define		data_array_elements		600
-#define		sum_const			-16908
+
+//1 sweeps the cache levels of a host instead of testing the array above:
+//each level gets an array of half its size (memory four times the last
+//level), they are checked one after the other on every pass, and every
+//sweep_every passes a "# l<level>, ps/element, MB/s, errors" line gives
+//the speed and the errors of each level, "# mem, ..." for memory.  Error
+//blocks carry an l: line, the level number or mem.
+#ifdef __MSP430__
+#define		cache_sweep_mode		0
+#else
+#define		cache_sweep_mode		0
+#endif
+#define		sweep_every			10
+#define		sweep_max_levels		8
+
+//1 makes the sweep chase pointers instead of summing: each array holds a
+//random cyclic permutation (Sattolo's shuffle seeded from chase_seed and
+//the level), every element the index of the next, and a pass follows the
+//whole cycle from element 0.  Each load depends on the one before, so the
+//prefetchers cannot help and ps/element is the load-to-use latency of the
+//level.  A pass checks that every index is in range, that the cycle closes
+//after exactly n loads and that the indices add up to 0 + 1 + ... + n-1.
+//When a check fails, the permutation is rebuilt from the seed to find and
+//repair the bad links: "C: {load: index}" says where the walk went wrong,
+//followed by the usual E: list.  A dependent walk of memory takes seconds,
+//so the memory array is chase_mem times the last level instead of four,
+//the levels are reported every chase_every passes and each level line is
+//printed as soon as that level has been walked, ahead of the pass line.
+#define		sweep_chase			0
+#define		chase_seed			0x2545f4914f6cdd1dULL
+#define		chase_mem			2
+#define		chase_every			1
+
+#if sweep_chase
+#define		sweep_report			chase_every
+#define		sweep_mem			chase_mem
+#else
+#define		sweep_report			sweep_every
+#define		sweep_mem			4
+#endif
+
+//1 runs the test on cache_workers threads (0 = one per CPU the process may
+//use), each pinned to its own CPU.  Every thread allocates its own
+//cache-line aligned region of thread_bytes (0 = half the L2 of its CPU)
+//after pinning, so first touch places it on the thread's NUMA node, and
+//keeps its own counters.  Error blocks carry a t: line with the thread
+//number.  The main thread prints the summed heartbeat once a second and a
+//"# t<thread>, cpu, passes, errors" line per thread every thread_report
+//seconds.  Hosts only; build with -pthread.
+#ifdef __MSP430__
+#define		cache_threaded			0
+#else
+#define		cache_threaded			0
+#endif
+#define		cache_workers			0
+#define		cache_max_workers		256
+#define		thread_bytes			0
+#define		thread_report			10
+
+#if cache_threaded
+#define		cache_tls			__thread
+#else
+#define		cache_tls
+#endif
+
+#if cache_threaded && cache_sweep_mode
+#error cache_sweep_mode runs on a single thread
+#endif
+
+//1 tests one cache level set by set instead of the array above.  The
+//region is as large as the cache, cover_ways lines of cover_line_bytes for
+//each of cover_sets sets, and a pass checks all the ways of set 0, then all
+//the ways of set 1, and so on, so every set/way slot holds a line under
+//test.  Way w of set s is the line at (w * cover_sets + s) *
+//cover_line_bytes; that is the set the cache picks when the set index bits
+//lie inside a page, always for an L1 of 4 KB per way and for larger levels
+//with huge pages.  On a host the geometry of cache level cover_level of the
+//CPU the test is pinned to comes from sysfs, the cover_* values are the
+//fallback; on an MCU they describe its cache.  The heartbeat is followed by
+//"# c, lines with errors since the last heartbeat, sets that have had an
+//error, lines of the cache".
+#define		cache_cover			0
+#define		cover_level			1
+#define		cover_line_bytes		16
+#define		cover_sets			16
+#define		cover_ways			2
+
+#if cache_cover && !defined(__MSP430__)
+#define		cover_sysfs			1
+#else
+#define		cover_sysfs			0
+#endif
+
+#if cache_cover && (cache_sweep_mode || cache_threaded)
+#error cache_cover tests one level on one thread
+#endif
+
+//1 rewrites a buffer of refresh_bytes (0 = four times the largest cache
+//of cpu0, so the writes reach memory) with the pattern every refresh_every
+//passes, by turns with ordinary stores through the cache and with
+//non-temporal stores that go around it to the memory controller.  Before
+//each rewrite the buffer is checked like the array, so a write that went
+//wrong on the way to memory is reported; its error blocks carry an r: 1
+//line instead of l: and count with the pass.  The region under test stays
+//as it is.  When threaded every thread rewrites its own share of
+//refresh_bytes, allocated after pinning.  Each rewrite is timed, and the
+//heartbeat is followed by "# r, cached GB/s, streaming GB/s" from the last
+//rewrite of each kind, summed over the threads when threaded.  x86-64
+//hosts only.
+#ifdef __MSP430__
+#define		refresh_mode			0
+#else
+#define		refresh_mode			0
+#endif
+#define		refresh_every			100
+#define		refresh_bytes			0
+
+#if refresh_mode && !defined(__x86_64__)
+#error the streaming refresh is written with SSE2 non-temporal stores
+#endif
+
+//1 backs the sweep arrays and the thread regions of huge_page_bytes or
+//more with huge pages, so the TLB keeps up with a scan of a large region:
+//MAP_HUGETLB from the reserved pool (vm.nr_hugepages) when it has room,
+//else transparent huge pages through madvise, else small pages.  The
+//mapping is faulted in when it is made, not on the first pass.  The
+//backend of the largest region is printed as pages:.
+#define		region_huge			1
+#define		huge_page_bytes			(2UL << 20)
+
+#define		pages_small			0
+#define		pages_thp			1
+#define		pages_hugetlb			2
+
+#ifdef __MSP430__
+#define		hw_name				"msp430f2619"
+#else
+#define		hw_name				"host"
+#endif
+#define		data_pattern			pattern_address
+#define		pattern_seed			0x1234u
+
+#define		pattern_zeros			0
+#define		pattern_ones			1
+#define		pattern_checkerboard		2	//0x55.. and 0xaa.. alternating
+#define		pattern_walking_ones		3	//1 << (i % int bits)
+#define		pattern_walking_zeros		4
+#define		pattern_address			5	//i, the original pattern
+#define		pattern_random			6	//seeded Weyl sequence
+
+//pattern_value(i) is the expected word at index i and pattern_sum(n) the
+//sum of the first n, both in unsigned int so the sum wraps the way the
+//running sum of calc_sum does.  The pseudo-random pattern steps by the
+//golden ratio of the word size from pattern_seed, which keeps its sum in
+//closed form.  Every pattern repeats within scan_chunk words up to a step
+//of pattern_step per index, so the fast scan below needs one chunk of
+//expected values: pattern_value(i + j) = pattern_value(j) + i * pattern_step
+//when i is a multiple of scan_chunk.
+#define		int_bits			((unsigned int)(8 * sizeof(int)))
+#define		pattern_tri(n)			((n) % 2 ? (n) * (((n) - 1) / 2) : ((n) / 2) * ((n) - 1))
+#if UINT_MAX == 0xffff
+#define		pattern_golden			0x9e37u
+#else
+#define		pattern_golden			0x9e3779b9u
+#endif
+
+#if data_pattern == pattern_zeros
+#define		pattern_name			"zeros"
+#define		pattern_value(i)		0u
+#define		pattern_sum(n)			0u
+#define		pattern_step			0u
+#elif data_pattern == pattern_ones
+#define		pattern_name			"ones"
+#define		pattern_value(i)		(~0u)
+#define		pattern_sum(n)			((n) * ~0u)
+#define		pattern_step			0u
+#elif data_pattern == pattern_checkerboard
+#define		pattern_name			"checkerboard"
+#define		pattern_value(i)		((i) & 1 ? ~0u / 3 * 2 : ~0u / 3)
+#define		pattern_sum(n)			(((n) + 1) / 2 * (~0u / 3) + (n) / 2 * (~0u / 3 * 2))
+#define		pattern_step			0u
+#elif data_pattern == pattern_walking_ones
+#define		pattern_name			"walking ones"
+#define		pattern_value(i)		(1u << ((i) % int_bits))
+#define		pattern_sum(n)			((n) / int_bits * ~0u + ((1u << ((n) % int_bits)) - 1u))
+#define		pattern_step			0u
+#elif data_pattern == pattern_walking_zeros
+#define		pattern_name			"walking zeros"
+#define		pattern_value(i)		(~(1u << ((i) % int_bits)))
+#define		pattern_sum(n)			((n) * ~0u - ((n) / int_bits * ~0u + ((1u << ((n) % int_bits)) - 1u)))
+#define		pattern_step			0u
+#elif data_pattern == pattern_address
+#define		pattern_name			"address"
+#define		pattern_value(i)		((unsigned int)(i))
+#define		pattern_sum(n)			pattern_tri(n)
+#define		pattern_step			1u
+#else
+#define		pattern_name			"random"
+#define		pattern_value(i)		(pattern_seed + pattern_golden * (unsigned int)(i))
+#define		pattern_sum(n)			(pattern_seed * (n) + pattern_golden * pattern_tri(n))
+#define		pattern_step			pattern_golden
+#endif
+
+#define		sum_const			pattern_sum((unsigned int)data_array_elements)
+
+//1 lets calc_sum check the array scan_chunk words at a time first: each
+//chunk is xored with its expected values and the differences ored into
+//one mask, with no branch per word.  calc_sum only goes word by word, and
+//prints, through a chunk with a non-zero mask, then scans on from the next
+//one, so a bad word does not slow the rest of the pass.  x86-64 hosts scan
+//with AVX-512, AVX2 or SSE2, whichever the CPU has, everything else with
+//an unrolled loop over native ints.
+#define		scan_fast			1
+#define		scan_chunk			64
+
+#if scan_fast && defined(__x86_64__) && !defined(__MSP430__)
+#define		scan_simd			1
+#else
+#define		scan_simd			0
+#endif
+
+//1 reports which bits of a bad word flipped instead of the word read:
+//"X: {index: bit,...}", or a list "index: [bit, bit]" for a word with more
+//than one.  The bad words of a check that are at most upset_span indices
+//apart are one upset, a single-bit upset (SBU) if it is one word with one
+//bit flipped, a multiple-bit upset (MBU) if it is one word with more and a
+//multiple-cell upset (MCU) if it spans words.  A "U: [SBU, MBU, MCU]" line
+//after the list counts them.
+#define		upset_classify			0
+#define		upset_span			1
+
+//0 checks the array on every pass.  Otherwise every check (a scrub) is
+//followed by scrub_idle passes that leave the array alone, each a wait of
+//scrub_idle_ms milliseconds, so the cells hold their data unread for
+//scrub_idle * scrub_idle_ms ms and upsets accumulate between scrubs.  The
+//heartbeat then comes after every scrub.  scrub_repair 0 makes the scrubs
+//read only: bad words are reported but not rewritten, so each scrub lists
+//every upset since the start and the error count grows with the exposure.
+#define		scrub_idle			0
+#define		scrub_idle_ms			100
+#define		scrub_repair			1
+
+#if scrub_idle && cache_sweep_mode
+#error the sweep times every pass, it has no idle passes
+#endif
+
+//0 runs the read pattern above, 1 a March test over the same array.
+//march_word_bits (8, 16 or 32) sets the width of the words the test reads
+//and writes, march_either_down the address order of the elements that may
+//run either way (0 up, 1 down).
+#define		march_test			0
+#define		march_algorithm			march_c_minus
+#define		march_word_bits			16
+#define		march_either_down		0
+
+#define		march_c_minus			0	//10n
+#define		march_ss			1	//22n
+#define		mats_plus			2	//5n
+
+#if !scrub_repair && march_test
+#error a March test writes the array on every pass
+#endif
+#if cache_cover && march_test
+#error a March test walks the array in address order
+#endif
 
 int array[data_array_elements];
 
-unsigned long int ind = 0;
-int local_errors = 0;
-int sum_errors = 0;
-int in_block = 0;
+#if march_word_bits == 8
+typedef uint8_t march_word;
+#elif march_word_bits == 16
+typedef uint16_t march_word;
+#else
+typedef uint32_t march_word;
+#endif
+
+
+//a March element is an address order and up to five operations applied to
+//each address before moving to the next.  An operation is a read or a
+//write of the all-0 or the all-1 word: bit 0 is the data, bit 1 the write.
+#define		march_up			0
+#define		march_down			1
+#define		march_either			2
+
+#define		march_r0			0
+#define		march_r1			1
+#define		march_w0			2
+#define		march_w1			3
+
+typedef struct {
+  unsigned char order;
+  unsigned char count;
+  unsigned char ops[5];
+} march_element;
+
+typedef struct {
+  const char *name;
+  const march_element *elements;
+  int count;
+} march_algo;
+
+const march_element march_c_minus_elements[] = {
+  { march_either, 1, { march_w0 } },
+  { march_up,     2, { march_r0, march_w1 } },
+  { march_up,     2, { march_r1, march_w0 } },
+  { march_down,   2, { march_r0, march_w1 } },
+  { march_down,   2, { march_r1, march_w0 } },
+  { march_either, 1, { march_r0 } },
+};
+
+const march_element march_ss_elements[] = {
+  { march_either, 1, { march_w0 } },
+  { march_up,     5, { march_r0, march_r0, march_w0, march_r0, march_w1 } },
+  { march_up,     5, { march_r1, march_r1, march_w1, march_r1, march_w0 } },
+  { march_down,   5, { march_r0, march_r0, march_w0, march_r0, march_w1 } },
+  { march_down,   5, { march_r1, march_r1, march_w1, march_r1, march_w0 } },
+  { march_either, 1, { march_r0 } },
+};
+
+const march_element mats_plus_elements[] = {
+  { march_either, 1, { march_w0 } },
+  { march_up,     2, { march_r0, march_w1 } },
+  { march_down,   2, { march_r1, march_w0 } },
+};
+
+//indexed by march_algorithm
+const march_algo march_algorithms[] = {
+  { "C-", march_c_minus_elements, sizeof(march_c_minus_elements) / sizeof(march_element) },
+  { "SS", march_ss_elements, sizeof(march_ss_elements) / sizeof(march_element) },
+  { "MATS+", mats_plus_elements, sizeof(mats_plus_elements) / sizeof(march_element) },
+};
+
+//volatile, so every operation of an element really goes to the memory
+cache_tls volatile march_word *march_mem;
+cache_tls int march_words = 0;
+cache_tls int march_open = -1;		//element whose error list is being printed
+cache_tls int march_count = 0;		//errors of that element, non-robust printing
+
+cache_tls unsigned long int ind = 0;
+cache_tls int local_errors = 0;
+cache_tls int sum_errors = 0;
+cache_tls int in_block = 0;
+
+#if cache_threaded
+void cache_plan_workers(void);
+void cache_start_workers(void);
+void cache_run_workers(void);
+void *cache_worker_main(void *arg);
+
+typedef struct {
+  pthread_t thread;
+  int id;
+  int cpu;
+  int n;				//elements of the region
+  //published after every pass for the main thread's heartbeat
+  volatile unsigned long ind;
+  volatile int errors;
+  volatile int tests_with_errors;
+  volatile int sum_errors;
+#if refresh_mode
+  volatile unsigned long refresh_mbs[2];
+#endif
+} cache_worker;
+
+cache_worker workers[cache_max_workers];
+int worker_count = 0;
+cache_tls cache_worker *worker;
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_barrier_t workers_ready;		//regions made, then header out
+#endif
+
+#if cache_cover
+void cover_plan(void);
+void cover_pass(int *mem);
+
+int cover_sets_n = cover_sets;		//geometry under test
+int cover_ways_n = cover_ways;
+int cover_line_n = cover_line_bytes;
+int *cover_mem;
+int cover_words = 0;
+unsigned long cover_bad_lines = 0;	//lines with errors since the heartbeat
+unsigned long cover_bad_sets = 0;	//sets that have had an error
+#if cover_sysfs
+unsigned char *cover_hit;		//bit per set, set once it had an error
+#else
+unsigned char cover_hit[(cover_sets + 7) / 8];
+int cover_array[cover_sets * cover_ways * cover_line_bytes / sizeof(int)];
+#endif
+#endif
+
+#if refresh_mode
+void refresh_plan(void);
+void refresh_init(void);
+void refresh(void);
+void refresh_stream(int *mem, int n);
+void refresh_report(unsigned long cached, unsigned long streaming);
+
+int refresh_n = 0;				//elements each thread rewrites
+cache_tls int *refresh_mem;
+cache_tls int refresh_checking = 0;		//error blocks are of the buffer
+cache_tls unsigned long refresh_count = 0;
+cache_tls unsigned long refresh_mbs[2];		//MB/s, cached and streaming
+#endif
+
+#if cache_sweep_mode
+void cache_sweep_plan(void);
+void cache_sweep(void);
+
+//one array per cache level, the last one for memory
+typedef struct {
+  int level;				//0 for memory
+  unsigned long cache_bytes;		//0 for memory
+  int n;				//elements under test
+  int *mem;
+  unsigned long errors;
+  unsigned long ns;			//since the last report
+} sweep_level;
 
-void init_array(int *array) {
+void sweep_name(const char *prefix, int level);
+void sweep_account(sweep_level *lv, int *total_errors, int *tests_with_errors);
+void sweep_report_level(sweep_level *lv);
+void sweep_check(sweep_level *lv);
+#if sweep_chase
+void chase_build(int *mem, int n, int level);
+void chase(int *mem, int n, int level);
+void chase_locate(int *mem, int n, int level);
+#endif
+
+sweep_level levels[sweep_max_levels];
+int level_count = 0;
+int sweep_current = 0;			//level of the error blocks
+#endif
+
+void init_array(int *array, int n) {
   int i = 0;
   
-  for ( i = 0; i < data_array_elements; i++ ) {
-    array[i] = i;  
+  for ( i = 0; i < n; i++ ) {
+    array[i] = (int)pattern_value(i);
   }
 }
 
-int calc_sum(int *array) {
+#if refresh_mode
+//rewrite the pattern with non-temporal stores, 16 bytes at a time from the
+//first aligned element
+void refresh_stream(int *mem, int n) {
   int i = 0;
-  int sum = 0;
+
+  for (i = 0; i < n && ((uintptr_t)(mem + i) & 15); i++) {
+    mem[i] = (int)pattern_value(i);
+  }
+  for (; i + 4 <= n; i += 4) {
+    _mm_stream_si128((__m128i *)(mem + i), _mm_set_epi32((int)pattern_value(i + 3), (int)pattern_value(i + 2),
+							 (int)pattern_value(i + 1), (int)pattern_value(i)));
+  }
+  for (; i < n; i++) {
+    mem[i] = (int)pattern_value(i);
+  }
+  _mm_sfence();
+}
+
+//check what the last rewrite left in the buffer, then rewrite it, cached
+//and streaming by turns, and time the rewrite
+void refresh(void) {
+  int streaming = refresh_count++ & 1;
+  unsigned long ns = 0;
+
+  refresh_checking = 1;
+  calc_sum(refresh_mem, refresh_n);
+  refresh_checking = 0;
+  if (in_block) {
+    print_unlock();
+    in_block = 0;
+  }
+
+  ns = cache_clock_ns();
+  if (streaming) {
+    refresh_stream(refresh_mem, refresh_n);
+  }
+  else {
+    init_array(refresh_mem, refresh_n);
+  }
+  ns = cache_clock_ns() - ns;
+  refresh_mbs[streaming] = (unsigned long)refresh_n * sizeof(int) * 1000 / (ns ? ns : 1);
+}
+
+//"# r" line, MB/s printed as GB/s to the MB/s since the tiny printf has
+//no %f
+void refresh_report(unsigned long cached, unsigned long streaming) {
+  printf("# r, %n.%i%i%i, ", cached / 1000, (int)(cached / 100 % 10), (int)(cached / 10 % 10), (int)(cached % 10));
+  printf("%n.%i%i%i\r\n", streaming / 1000, (int)(streaming / 100 % 10), (int)(streaming / 10 % 10), (int)(streaming % 10));
+}
+#endif
+
+//" - i:" line of a new error block, with the level when sweeping and the
+//thread when threaded.  The block is printed under the lock until the
+//check is done, so blocks from different threads never interleave.
+void block_start(void) {
+  print_lock();
+  printf(" - i: %n\r\n", ind);
+#if refresh_mode
+  if (refresh_checking) {
+    printf("   r: 1\r\n");
+  }
+#endif
+#if cache_sweep_mode
+#if refresh_mode
+  if (!refresh_checking)
+#endif
+  {
+    printf("   l: ");
+    sweep_name("", sweep_current);
+    printf("\r\n");
+  }
+#endif
+#if cache_threaded
+  printf("   t: %i\r\n", worker->id);
+#endif
+}
+
+#if cache_threaded
+void print_lock(void) {
+  pthread_mutex_lock(&lock);
+}
+
+void print_unlock(void) {
+  pthread_mutex_unlock(&lock);
+}
+#else
+void print_lock(void) {
+}
+
+void print_unlock(void) {
+}
+#endif
+
+#if scan_fast
+//expected values of the first chunk, the others are offsets of these
+int scan_expected[scan_chunk];
+
+void scan_init(void) {
+  int j = 0;
+
+  for (j = 0; j < scan_chunk; j++) {
+    scan_expected[j] = (int)pattern_value((unsigned int)j);
+  }
+}
+
+#if scan_simd
+//the SSE2 scan is the x86-64 baseline, the wider ones are compiled for
+//their own target and picked at run time
+int scan_level(void) {
+  static int level = 0;
+
+  if (!level) {
+    __builtin_cpu_init();
+    level = 1;
+    if (__builtin_cpu_supports("avx2"))
+      level = 2;
+    if (__builtin_cpu_supports("avx512f"))
+      level = 3;
+  }
+  return level;
+}
+
+int scan_sse2(const int *array, int from, int n, unsigned int *sum) {
+  __m128i total = _mm_setzero_si128();
+  __m128i part, diff, off, x;
+  unsigned int lanes[4];
+  int i = 0;
+  int j = 0;
+
+  for (i = from; i + scan_chunk <= n; i += scan_chunk) {
+    off = _mm_set1_epi32((int)(pattern_step * (unsigned int)i));
+    part = _mm_setzero_si128();
+    diff = _mm_setzero_si128();
+    for (j = 0; j < scan_chunk; j += 4) {
+      x = _mm_loadu_si128((const __m128i *)(array + i + j));
+      part = _mm_add_epi32(part, x);
+      x = _mm_xor_si128(x, _mm_add_epi32(_mm_loadu_si128((const __m128i *)(scan_expected + j)), off));
+      diff = _mm_or_si128(diff, x);
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(diff, _mm_setzero_si128())) != 0xffff)
+      break;
+    total = _mm_add_epi32(total, part);
+  }
+  _mm_storeu_si128((__m128i *)lanes, total);
+  *sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  return i;
+}
+
+__attribute__((target("avx2")))
+int scan_avx2(const int *array, int from, int n, unsigned int *sum) {
+  __m256i total = _mm256_setzero_si256();
+  __m256i part, diff, off, x;
+  unsigned int lanes[8];
+  int i = 0;
+  int j = 0;
+
+  for (i = from; i + scan_chunk <= n; i += scan_chunk) {
+    off = _mm256_set1_epi32((int)(pattern_step * (unsigned int)i));
+    part = _mm256_setzero_si256();
+    diff = _mm256_setzero_si256();
+    for (j = 0; j < scan_chunk; j += 8) {
+      x = _mm256_loadu_si256((const __m256i *)(array + i + j));
+      part = _mm256_add_epi32(part, x);
+      x = _mm256_xor_si256(x, _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)(scan_expected + j)), off));
+      diff = _mm256_or_si256(diff, x);
+    }
+    if (!_mm256_testz_si256(diff, diff))
+      break;
+    total = _mm256_add_epi32(total, part);
+  }
+  _mm256_storeu_si256((__m256i *)lanes, total);
+  *sum = 0;
+  for (j = 0; j < 8; j++)
+    *sum += lanes[j];
+  return i;
+}
+
+__attribute__((target("avx512f")))
+int scan_avx512(const int *array, int from, int n, unsigned int *sum) {
+  __m512i total = _mm512_setzero_si512();
+  __m512i part, diff, off, x;
+  int i = 0;
+  int j = 0;
+
+  for (i = from; i + scan_chunk <= n; i += scan_chunk) {
+    off = _mm512_set1_epi32((int)(pattern_step * (unsigned int)i));
+    part = _mm512_setzero_si512();
+    diff = _mm512_setzero_si512();
+    for (j = 0; j < scan_chunk; j += 16) {
+      x = _mm512_loadu_si512((const void *)(array + i + j));
+      part = _mm512_add_epi32(part, x);
+      x = _mm512_xor_si512(x, _mm512_add_epi32(_mm512_loadu_si512((const void *)(scan_expected + j)), off));
+      diff = _mm512_or_si512(diff, x);
+    }
+    if (_mm512_test_epi32_mask(diff, diff))
+      break;
+    total = _mm512_add_epi32(total, part);
+  }
+  *sum = (unsigned int)_mm512_reduce_add_epi32(total);
+  return i;
+}
+#endif
+
+//sum the clean chunks from index from, a multiple of scan_chunk, and
+//return the index of the first chunk with a difference, or of the tail
+//after the last chunk
+int calc_scan(const int *array, int from, int n, unsigned int *sum) {
+  unsigned int diff = 0;
+  unsigned int part = 0;
+  unsigned int off = 0;
+  unsigned int x0, x1, x2, x3;
+  int i = 0;
+  int j = 0;
+
+#if scan_simd
+  switch (scan_level()) {
+  case 3:
+    return scan_avx512(array, from, n, sum);
+  case 2:
+    return scan_avx2(array, from, n, sum);
+  default:
+    return scan_sse2(array, from, n, sum);
+  }
+#endif
+
+  *sum = 0;
+  for (i = from; i + scan_chunk <= n; i += scan_chunk) {
+    off = pattern_step * (unsigned int)i;
+    part = 0;
+    diff = 0;
+    for (j = 0; j < scan_chunk; j += 4) {
+      x0 = array[i + j];
+      x1 = array[i + j + 1];
+      x2 = array[i + j + 2];
+      x3 = array[i + j + 3];
+      part += x0 + x1 + x2 + x3;
+      diff |= (x0 ^ (scan_expected[j] + off)) | (x1 ^ (scan_expected[j + 1] + off))
+	| (x2 ^ (scan_expected[j + 2] + off)) | (x3 ^ (scan_expected[j + 3] + off));
+    }
+    if (diff)
+      break;
+    *sum += part;
+  }
+  return i;
+}
+
+const char *scan_engine(void) {
+#if scan_simd
+  static const char *names[] = { "", "sse2", "avx2", "avx512" };
+
+  return names[scan_level()];
+#else
+  return "unrolled";
+#endif
+}
+#endif
+
+//print one bad word of an error list, first opens the list
+void report_word(int i, int value, unsigned int good, int first) {
+#if upset_classify
+  unsigned int flipped = (unsigned int)value ^ good;
+  unsigned int bit = 0;
+  int more = flipped & (flipped - 1);
+
+  printf(first ? "   X: {%l: " : "%l: ", (long)i);
+  if (more) {
+    printf("[");
+  }
+  for (bit = 0; bit < int_bits; bit++) {
+    if (flipped >> bit & 1) {
+      flipped &= ~(1u << bit);
+      printf(flipped ? "%i, " : "%i", (int)bit);
+    }
+  }
+  printf(more ? "]," : ",");
+#else
+  printf(first ? "   E: {%l: %l," : "%l: %l,", (long)i, (long)value);
+#endif
+}
+
+#if upset_classify
+#define		upset_sbu			0
+#define		upset_mbu			1
+#define		upset_mcu			2
+
+cache_tls int upset_last = 0;		//index of the last bad word
+cache_tls int upset_words = 0;		//bad words of the open upset
+cache_tls int upset_bits = 0;		//flipped bits of the open upset
+cache_tls int upset_counts[3];		//upsets of the check by kind
+
+//add a bad word of a check, one that is before the last or more than
+//upset_span after it starts a new upset
+void upset_note(int i, unsigned int flipped) {
+  if (upset_words && (unsigned int)(i - upset_last) > upset_span) {
+    upset_cluster();
+  }
+  upset_last = i;
+  upset_words++;
+  while (flipped) {
+    flipped &= flipped - 1;
+    upset_bits++;
+  }
+}
+
+//close the open upset
+void upset_cluster(void) {
+  if (upset_words > 1) {
+    upset_counts[upset_mcu]++;
+  }
+  else if (upset_bits > 1) {
+    upset_counts[upset_mbu]++;
+  }
+  else if (upset_words) {
+    upset_counts[upset_sbu]++;
+  }
+  upset_words = 0;
+  upset_bits = 0;
+}
+
+//at the end of a check, print and clear its upsets
+void upset_report(void) {
+  upset_cluster();
+  if (upset_counts[upset_sbu] || upset_counts[upset_mbu] || upset_counts[upset_mcu]) {
+    printf("   U: [%i, %i, %i]\r\n", upset_counts[upset_sbu], upset_counts[upset_mbu], upset_counts[upset_mcu]);
+  }
+  upset_counts[upset_sbu] = 0;
+  upset_counts[upset_mbu] = 0;
+  upset_counts[upset_mcu] = 0;
+}
+#endif
+
+int calc_sum(int *array, int n) {
+  int i = 0;
+  unsigned int sum = 0;
+  unsigned int expected = pattern_sum((unsigned int)n);
   int first_error = 0;
   int numberOfErrors = 0;
+#if scan_fast
+  int end = 0;				//of the chunk gone through word by word
+  unsigned int part = 0;
+#endif
   
-  for ( i = 0; i < data_array_elements; i++) {
+  for ( ; i < n; i++) {
+#if scan_fast
+    //the clean chunks from here in one go, then word by word through the
+    //first dirty chunk or the tail
+    if (i == end) {
+      i = calc_scan(array, i, n, &part);
+      sum += part;
+      if (i == n) {
+	break;
+      }
+      end = n - i > scan_chunk ? i + scan_chunk : n;
+    }
+#endif
     sum += array[i];
     
-    if ( array[i] != i ) {
+    if ( (unsigned int)array[i] != pattern_value(i) ) {
       numberOfErrors++;
       
       //there is an error, start block of code for printing
       if (!first_error) {
 	if (!in_block && robust_printing) {
-	  printf(" - i: %n\r\n", ind);
-	  printf("   E: {%i: %i,", i, array[i]);
+	  block_start();
+	  report_word(i, array[i], pattern_value(i), 1);
 	  first_error = 1;
 	  in_block = 1;  
 	}
 	else if (in_block && robust_printing){
-	  printf("   E: {%i: %i,", i, array[i]);
+	  report_word(i, array[i], pattern_value(i), 1);
 	  first_error = 1;
 	}
       }
       else{
 	if (robust_printing)
-	  printf("%i: %i,", i, array[i]);
+	  report_word(i, array[i], pattern_value(i), 0);
       }
+#if upset_classify
+      upset_note(i, (unsigned int)array[i] ^ pattern_value(i));
+#endif
 
       //fix and record error
-      array[i] = i;
+#if scrub_repair
+      array[i] = (int)pattern_value(i);
+#endif
       local_errors++;
     }
     
@@ -146,7 +966,7 @@ int calc_sum(int *array) {
   //handle the less robust printing case
   if (!robust_printing && numberOfErrors > 0) {
     if (!in_block) {
-      printf(" - i: %n\r\n", ind);
+      block_start();
       printf("   E: %i\r\n", numberOfErrors);
       in_block = 1;
     }
@@ -154,9 +974,12 @@ int calc_sum(int *array) {
       printf("   E: %i\r\n", numberOfErrors);
     }
   }
+#if upset_classify
+  upset_report();
+#endif
 
   //check for a math error
-  if (sum != sum_const) {
+  if (sum != expected) {
     //the difference between robust and not robust printing is trivial for this one, so let it go
 
     //only count sum errors if there have been no other errors
@@ -165,37 +988,680 @@ int calc_sum(int *array) {
       local_errors++;
 
       if (!in_block) {
-	printf(" - i: %n\r\n", ind);
-	printf("   S: {%i: %i}\r\n", sum_const, sum);
+	block_start();
+	printf("   S: {%i: %i}\r\n", (int)expected, (int)sum);
 	first_error = 1;
 	in_block = 1;
       }
       else if (in_block){
-	printf("   S: {%i: %i}\r\n", sum_const, sum);
+	printf("   S: {%i: %i}\r\n", (int)expected, (int)sum);
 	first_error = 1;
       }
     }
   }
   
-  return sum;
+  return (int)sum;
 }
 
-void cache_test(void) {
-  int sum = 0;
+//one pass of the selected March test; a read that does not return the
+//background is reported and the word is set back to it, as calc_sum does
+void march_pass(void) {
+  const march_algo *algo = &march_algorithms[march_algorithm];
+  const march_element *el;
+  int e = 0;
+  int o = 0;
+  int k = 0;
+  int addr = 0;
+  int step = 1;
+  unsigned char op;
+  march_word value;
+  march_word got;
+
+  for (e = 0; e < algo->count; e++) {
+    el = &algo->elements[e];
+    if (el->order == march_down || (el->order == march_either && march_either_down)) {
+      addr = march_words - 1;
+      step = -1;
+    }
+    else {
+      addr = 0;
+      step = 1;
+    }
+
+    for (k = 0; k < march_words; k++, addr += step) {
+      for (o = 0; o < el->count; o++) {
+	op = el->ops[o];
+	value = (op & 1) ? (march_word)~0 : 0;
+	if (op & 2) {
+	  march_mem[addr] = value;
+	}
+	else {
+	  got = march_mem[addr];
+	  if (got != value) {
+	    march_fault(e, addr, got);
+	    march_mem[addr] = value;
+	  }
+	}
+      }
+    }
+  }
+  march_close();
+}
+
+//errors are listed per element, "m3: {addr: value read, ...}"
+void march_fault(int element, int addr, unsigned long value) {
+  if (!in_block) {
+    block_start();
+    in_block = 1;
+  }
+  if (element != march_open) {
+    march_close();
+    if (robust_printing) {
+      printf("   m%i: {", element);
+    }
+    march_open = element;
+  }
+  if (robust_printing) {
+    printf("%i: %n,", addr, value);
+  }
+  march_count++;
+  local_errors++;
+}
+
+//finish the error list of the open element
+void march_close(void) {
+  if (march_open >= 0) {
+    if (robust_printing) {
+      printf("}\r\n");
+    }
+    else {
+      printf("   m%i: %i\r\n", march_open, march_count);
+    }
+  }
+  march_open = -1;
+  march_count = 0;
+}
+
+#if cache_sweep_mode || cache_threaded || cover_sysfs || refresh_mode
+const char *page_names[] = { "small", "thp", "hugetlb" };
+volatile int region_pages = -1;		//backend of the largest region
+unsigned long region_largest = 0;
+
+//cache-line aligned memory for a sweep array, a thread region or a
+//refresh buffer
+int *region_alloc(unsigned long bytes) {
+  int pages = pages_small;
+  char *p = 0;
+#if region_huge
+  unsigned long len = (bytes + huge_page_bytes - 1) & ~(huge_page_bytes - 1);
+  unsigned long off = 0;
+
+  if (bytes >= huge_page_bytes) {
+    p = mmap(0, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+    if (p != MAP_FAILED) {
+      pages = pages_hugetlb;
+    }
+    else {
+      //one extra huge page to start on a huge page boundary
+      p = mmap(0, len + huge_page_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED) {
+	p = 0;
+      }
+      else {
+	p += (huge_page_bytes - (unsigned long)p % huge_page_bytes) % huge_page_bytes;
+	if (madvise(p, len, MADV_HUGEPAGE) == 0) {
+	  pages = pages_thp;
+	}
+	//fault it in now, a huge page at a time where the kernel can
+	for (off = 0; off < len; off += 4096) {
+	  p[off] = 0;
+	}
+      }
+    }
+  }
+#endif
+  if (!p) {
+    p = aligned_alloc(64, (bytes + 63) & ~63UL);
+  }
+  if (bytes >= region_largest) {
+    region_largest = bytes;
+    region_pages = pages;
+  }
+  return (int *)p;
+}
+
+//read "name" of a sysfs cache index directory, 0 if it is not there
+int sysfs_read(const char *dir, const char *name, char *buf, int len) {
+  char path[96];
+  int fd = 0;
+  int got = 0;
+
+  strcpy(path, dir);
+  strcat(path, name);
+  fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return 0;
+  }
+  got = read(fd, buf, len - 1);
+  close(fd);
+  if (got <= 0) {
+    return 0;
+  }
+  buf[got] = 0;
+  return got;
+}
+
+//path of cache index directory "index" of cpu
+void sysfs_cache_dir(char *dir, int cpu, int index) {
+  char *p;
+  char digits[8];
+  int d = 0;
+
+  strcpy(dir, "/sys/devices/system/cpu/cpu");
+  p = dir + strlen(dir);
+  do {
+    digits[d++] = '0' + cpu % 10;
+    cpu /= 10;
+  } while (cpu);
+  while (d) {
+    *p++ = digits[--d];
+  }
+  strcpy(p, "/cache/index");
+  p += strlen(p);
+  if (index >= 10) {
+    *p++ = '1';
+  }
+  *p++ = '0' + index % 10;
+  strcpy(p, "/");
+}
+
+//bytes of a sysfs size ("48K", "2048K", "32M")
+unsigned long sysfs_size(const char *buf) {
+  char *end;
+  unsigned long bytes = strtoul(buf, &end, 10);
+
+  if (*end == 'K') {
+    bytes <<= 10;
+  }
+  else if (*end == 'M') {
+    bytes <<= 20;
+  }
+  return bytes;
+}
+#endif
+
+#if refresh_mode
+//size the refresh buffer of each thread
+void refresh_plan(void) {
+  char dir[80];
+  char buf[32];
+  unsigned long bytes = refresh_bytes;
+  unsigned long largest = 0;
+  int index = 0;
+
+  for (index = 0; bytes == 0 && index < 16; index++) {
+    sysfs_cache_dir(dir, 0, index);
+    if (sysfs_read(dir, "size", buf, sizeof(buf)) && sysfs_size(buf) > largest) {
+      largest = sysfs_size(buf);
+    }
+  }
+  if (bytes == 0) {
+    bytes = largest ? 4 * largest : 256UL << 20;
+  }
+#if cache_threaded
+  bytes /= worker_count;
+#endif
+  refresh_n = bytes / sizeof(int);
+}
+
+//allocate and fill the buffer from the thread that rewrites it
+void refresh_init(void) {
+  refresh_mem = region_alloc((unsigned long)refresh_n * sizeof(int));
+  init_array(refresh_mem, refresh_n);
+}
+#endif
+
+#if cache_cover
+//find the geometry of the level and allocate a region of its size
+void cover_plan(void) {
+#if cover_sysfs
+  char dir[80];
+  char buf[32];
+  cpu_set_t set;
+  int cpu = sched_getcpu();
+  int index = 0;
+  int line = 0;
+  int sets = 0;
+  int ways = 0;
+
+  //stay on the CPU whose cache is measured
+  if (cpu < 0) {
+    cpu = 0;
+  }
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  sched_setaffinity(0, sizeof(set), &set);
+
+  for (index = 0; index < 16; index++) {
+    sysfs_cache_dir(dir, cpu, index);
+    if (!sysfs_read(dir, "type", buf, sizeof(buf)) || strncmp(buf, "Instruction", 11) == 0) {
+      continue;
+    }
+    if (!sysfs_read(dir, "level", buf, sizeof(buf)) || atoi(buf) != cover_level) {
+      continue;
+    }
+    if (sysfs_read(dir, "coherency_line_size", buf, sizeof(buf))) {
+      line = atoi(buf);
+    }
+    if (sysfs_read(dir, "number_of_sets", buf, sizeof(buf))) {
+      sets = atoi(buf);
+    }
+    if (sysfs_read(dir, "ways_of_associativity", buf, sizeof(buf))) {
+      ways = atoi(buf);
+    }
+    break;
+  }
+  if (line >= (int)sizeof(int) && sets > 0 && ways > 0) {
+    cover_line_n = line;
+    cover_sets_n = sets;
+    cover_ways_n = ways;
+  }
+  else {
+    printf("# no l%i geometry in sysfs, cover_* used\r\n", cover_level);
+  }
+
+  cover_words = cover_sets_n * cover_ways_n * (cover_line_n / sizeof(int));
+  cover_mem = region_alloc((unsigned long)cover_words * sizeof(int));
+  cover_hit = calloc((cover_sets_n + 7) / 8, 1);
+#else
+  cover_words = sizeof(cover_array) / sizeof(int);
+  cover_mem = cover_array;
+#endif
+}
+
+//check the region a set at a time, the ways of a set one after the other
+void cover_pass(int *mem) {
+  int words = cover_line_n / sizeof(int);
+  int stride = cover_sets_n * words;	//from one way of a set to the next
+  int set = 0;
+  int way = 0;
+  int j = 0;
+  int i = 0;
+  int set_errors = 0;
+  int line_errors = 0;
+  int numberOfErrors = 0;
+  int first_error = 0;
+
+  for (set = 0; set < cover_sets_n; set++) {
+    set_errors = 0;
+    for (way = 0; way < cover_ways_n; way++) {
+      i = way * stride + set * words;
+      line_errors = set_errors;
+      for (j = 0; j < words; j++, i++) {
+	if ((unsigned int)mem[i] != pattern_value(i)) {
+	  if (!in_block) {
+	    block_start();
+	    in_block = 1;
+	  }
+	  if (robust_printing) {
+	    report_word(i, mem[i], pattern_value(i), !first_error);
+	  }
+	  first_error = 1;
+#if upset_classify
+	  upset_note(i, (unsigned int)mem[i] ^ pattern_value(i));
+#endif
+#if scrub_repair
+	  mem[i] = (int)pattern_value(i);
+#endif
+	  set_errors++;
+	}
+      }
+      if (set_errors != line_errors) {
+	cover_bad_lines++;
+      }
+    }
+    if (set_errors) {
+      if (!(cover_hit[set >> 3] & (1 << (set & 7)))) {
+	cover_hit[set >> 3] |= 1 << (set & 7);
+	cover_bad_sets++;
+      }
+      numberOfErrors += set_errors;
+    }
+  }
+
+  if (first_error && robust_printing) {
+    printf("}\r\n");
+  }
+  if (!robust_printing && numberOfErrors > 0) {
+    printf("   E: %i\r\n", numberOfErrors);
+  }
+#if upset_classify
+  upset_report();
+#endif
+  local_errors += numberOfErrors;
+}
+#endif
+
+#if cache_sweep_mode
+//size the arrays from the data and unified caches of cpu0, smallest level
+//first, and add one for memory
+void cache_sweep_plan(void) {
+  char dir[80];
+  char buf[32];
+  int index = 0;
+  int level = 0;
+  int i = 0;
+  unsigned long bytes = 0;
+  unsigned long largest = 0;
+
+  for (index = 0; index < 16 && level_count < sweep_max_levels - 1; index++) {
+    sysfs_cache_dir(dir, 0, index);
+
+    if (!sysfs_read(dir, "type", buf, sizeof(buf)) || strncmp(buf, "Instruction", 11) == 0) {
+      continue;
+    }
+    if (!sysfs_read(dir, "level", buf, sizeof(buf))) {
+      continue;
+    }
+    level = atoi(buf);
+    if (!sysfs_read(dir, "size", buf, sizeof(buf))) {
+      continue;
+    }
+    bytes = sysfs_size(buf);
+
+    //keep the levels in order
+    for (i = level_count; i > 0 && levels[i - 1].level > level; i--) {
+      levels[i] = levels[i - 1];
+    }
+    levels[i].level = level;
+    levels[i].cache_bytes = bytes;
+    level_count++;
+    if (bytes > largest) {
+      largest = bytes;
+    }
+  }
+
+  if (level_count == 0) {
+    printf("# no cache topology in sysfs, memory only\r\n");
+    largest = 8UL << 20;
+  }
+  levels[level_count].level = 0;
+  levels[level_count].cache_bytes = 0;
+  level_count++;
+
+  for (i = 0; i < level_count; i++) {
+    bytes = levels[i].cache_bytes ? levels[i].cache_bytes / 2 : sweep_mem * largest;
+    levels[i].n = bytes / sizeof(int);
+    levels[i].mem = region_alloc(levels[i].n * sizeof(int));
+    levels[i].errors = 0;
+    levels[i].ns = 0;
+#if sweep_chase
+    chase_build(levels[i].mem, levels[i].n, levels[i].level);
+#else
+    init_array(levels[i].mem, levels[i].n);
+#endif
+  }
+}
+
+//one sweep of a level
+void sweep_check(sweep_level *lv) {
+#if sweep_chase
+  chase(lv->mem, lv->n, lv->level);
+#else
+  calc_sum(lv->mem, lv->n);
+#endif
+}
+
+#if sweep_chase
+//xorshift64, one stream per level
+unsigned long long chase_rand(unsigned long long *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+//Sattolo's shuffle of the identity, a single cycle through all n elements
+void chase_build(int *mem, int n, int level) {
+  unsigned long long state = chase_seed ^ level;
+  int i = 0;
+  int j = 0;
+  int t = 0;
+
+  for (i = 0; i < n; i++) {
+    mem[i] = i;
+  }
+  for (i = n - 1; i > 0; i--) {
+    j = (int)(chase_rand(&state) % (unsigned long long)i);
+    t = mem[i];
+    mem[i] = mem[j];
+    mem[j] = t;
+  }
+}
+
+//follow the cycle once from element 0
+void chase(int *mem, int n, int level) {
+  unsigned int sum = 0;
+  int load = 0;
+  int next = 0;
+  int idx = 0;
+
+  for (load = 0; load < n; load++) {
+    next = mem[idx];
+    if ((unsigned int)next >= (unsigned int)n) {
+      break;
+    }
+    sum += next;
+    idx = next;
+    if (idx == 0) {
+      break;
+    }
+  }
+
+  //a whole cycle ends on element 0 with its last load
+  if (load != n - 1 || idx != 0 || sum != pattern_tri((unsigned int)n)) {
+    if (!in_block) {
+      block_start();
+      in_block = 1;
+    }
+    printf("   C: {%l: %l}\r\n", (long)load, (long)next);
+    chase_locate(mem, n, level);
+  }
+}
+
+//rebuild the permutation next to the array, report and repair the links
+//that differ; if none do, the walk itself went wrong and counts once
+void chase_locate(int *mem, int n, int level) {
+  int *good = malloc(n * sizeof(int));
+  int first_error = 0;
+  int numberOfErrors = 0;
+  int i = 0;
+
+  if (!good) {
+    local_errors++;
+    return;
+  }
+  chase_build(good, n, level);
+  for (i = 0; i < n; i++) {
+    if (mem[i] != good[i]) {
+      if (robust_printing) {
+	report_word(i, mem[i], good[i], !first_error);
+      }
+#if upset_classify
+      upset_note(i, (unsigned int)(mem[i] ^ good[i]));
+#endif
+      first_error = 1;
+#if scrub_repair
+      mem[i] = good[i];
+#endif
+      numberOfErrors++;
+    }
+  }
+  free(good);
+
+  if (first_error && robust_printing) {
+    printf("}\r\n");
+  }
+  if (!robust_printing && numberOfErrors > 0) {
+    printf("   E: %i\r\n", numberOfErrors);
+  }
+#if upset_classify
+  upset_report();
+#endif
+  local_errors += numberOfErrors ? numberOfErrors : 1;
+}
+#endif
+
+//prefix and number of a cache level, mem for memory
+void sweep_name(const char *prefix, int level) {
+  if (level) {
+    printf("%s%i", prefix, level);
+  }
+  else {
+    printf("mem");
+  }
+}
+
+//close the error block of a sweep and count its errors
+void sweep_account(sweep_level *lv, int *total_errors, int *tests_with_errors) {
+  lv->errors += local_errors;
+  *total_errors += local_errors;
+  if (local_errors > 0) {
+    (*tests_with_errors)++;
+  }
+  local_errors = 0;
+  in_block = 0;
+}
+
+//the "# l<level>" line of a level, then its time starts over
+void sweep_report_level(sweep_level *lv) {
+  printf("# ");
+  sweep_name("l", lv->level);
+  printf(", %n, %n, %n\r\n",
+	 lv->ns * 1000 / ((unsigned long)lv->n * sweep_report),
+	 (unsigned long)lv->n * sizeof(int) * sweep_report * 1000 / (lv->ns ? lv->ns : 1),
+	 lv->errors);
+  lv->ns = 0;
+}
+
+//every level once per pass, timed on its own
+void cache_sweep(void) {
   int total_errors = 0;
   int tests_with_errors = 0;
+  int k = 0;
+  unsigned long t = 0;
+  sweep_level *lv;
 
-  init_array(array);
+#if refresh_mode
+  refresh_init();
+#endif
+  while (1) {
+    for (k = 0; k < level_count; k++) {
+      lv = &levels[k];
+      sweep_current = lv->level;
+      //the larger levels evicted this one, so a cache level is read in
+      //(and checked) once before the timed sweep
+      if (lv->cache_bytes) {
+	sweep_check(lv);
+	sweep_account(lv, &total_errors, &tests_with_errors);
+      }
+      t = cache_clock_ns();
+      sweep_check(lv);
+      lv->ns += cache_clock_ns() - t;
+      sweep_account(lv, &total_errors, &tests_with_errors);
+#if sweep_chase
+      //a walk of memory takes seconds, each level reports once it is done
+      if ((ind + 1) % sweep_report == 0) {
+	sweep_report_level(lv);
+      }
+#endif
+    }
+#if refresh_mode
+    //between the timed sweeps, so it does not count against a level
+    if (ind % refresh_every == refresh_every - 1) {
+      refresh();
+      total_errors += local_errors;
+      if (local_errors > 0) {
+	tests_with_errors++;
+      }
+      local_errors = 0;
+    }
+#endif
+    ind++;
+
+    if (ind % sweep_report == 0) {
+      printf("# %n, %i, %i, %i\r\n", ind, total_errors, tests_with_errors, sum_errors);
+#if refresh_mode
+      refresh_report(refresh_mbs[0], refresh_mbs[1]);
+#endif
+#if !sweep_chase
+      for (k = 0; k < level_count; k++) {
+	sweep_report_level(&levels[k]);
+      }
+#endif
+    }
+  }
+}
+#endif
+
+void cache_test(int *mem, int n) {
+  int total_errors = 0;
+  int tests_with_errors = 0;
+
+  init_array(mem, n);
+#if refresh_mode
+  refresh_init();
+#endif
+  march_mem = (volatile march_word *)mem;
+  march_words = n * sizeof(int) / sizeof(march_word);
 
   // Read Pattern
   while (1) {
     
-    sum = calc_sum(array);
+#if march_test
+    march_pass();
+#elif cache_cover
+    cover_pass(mem);
+#else
+    calc_sum(mem, n);
+#endif
+    //close the error block before refreshing or idling, the other threads
+    //print in the meantime
+    if (in_block) {
+      print_unlock();
+      in_block = 0;
+    }
+#if refresh_mode
+    if (ind % refresh_every == refresh_every - 1) {
+      refresh();
+    }
+#endif
+#if scrub_idle
+    scrub_wait();
+#endif
     
+#if cache_threaded
+    worker->ind = ind + 1;
+    worker->errors = total_errors + local_errors;
+    worker->tests_with_errors = tests_with_errors + (local_errors > 0);
+    worker->sum_errors = sum_errors;
+#if refresh_mode
+    worker->refresh_mbs[0] = refresh_mbs[0];
+    worker->refresh_mbs[1] = refresh_mbs[1];
+#endif
+#else
     //acking every few seconds to make certain the program is still alive/
-    if (ind % 1000 == 0 && ind != 0) {
+    if (ind % (scrub_idle ? 1 : march_test ? 100 : 1000) == 0 && ind != 0) {
       printf("# %n, %i, %i, %i\r\n", ind, total_errors, tests_with_errors, sum_errors);
+#if cache_cover
+      printf("# c, %n, %n, %n\r\n", cover_bad_lines, cover_bad_sets, (unsigned long)cover_sets_n * cover_ways_n);
+      cover_bad_lines = 0;
+#endif
+#if refresh_mode
+      refresh_report(refresh_mbs[0], refresh_mbs[1]);
+#endif
     }
+#endif
     
     ind++;
     total_errors += local_errors;
@@ -203,32 +1669,220 @@ void cache_test(void) {
       tests_with_errors++;
     }
     local_errors = 0;
-    in_block = 0;
   }
 }
 
+#if cache_threaded
+//pin, then allocate and fill the region from the pinned thread
+void *cache_worker_main(void *arg) {
+  cpu_set_t cpu;
+  int *mem;
+
+  worker = (cache_worker *)arg;
+
+  CPU_ZERO(&cpu);
+  CPU_SET(worker->cpu, &cpu);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu), &cpu);
+
+  mem = region_alloc(worker->n * sizeof(int));
+  //the header names the pages of the regions, so it waits for all of them
+  pthread_barrier_wait(&workers_ready);
+  pthread_barrier_wait(&workers_ready);
+  cache_test(mem, worker->n);
+  return 0;
+}
+
+//one worker per CPU we are allowed to run on, in that order, wrapping
+//around when cache_workers asks for more; each region is half of the L2
+//of its CPU unless thread_bytes says otherwise
+void cache_plan_workers(void) {
+  cpu_set_t allowed;
+  char dir[80];
+  char buf[32];
+  unsigned long bytes = 0;
+  int index = 0;
+  int cpu = 0;
+  int t = 0;
+
+  sched_getaffinity(0, sizeof(allowed), &allowed);
+  worker_count = cache_workers ? cache_workers : CPU_COUNT(&allowed);
+  if (worker_count > cache_max_workers) {
+    worker_count = cache_max_workers;
+  }
+
+  for (t = 0; t < worker_count; t++) {
+    while (!CPU_ISSET(cpu, &allowed)) {
+      cpu = (cpu + 1) % CPU_SETSIZE;
+    }
+    workers[t].id = t;
+    workers[t].cpu = cpu;
+
+    bytes = thread_bytes;
+    for (index = 0; bytes == 0 && index < 16; index++) {
+      sysfs_cache_dir(dir, cpu, index);
+      if (sysfs_read(dir, "level", buf, sizeof(buf)) && atoi(buf) == 2 &&
+	  sysfs_read(dir, "size", buf, sizeof(buf))) {
+	bytes = sysfs_size(buf) / 2;
+      }
+    }
+    if (bytes == 0) {
+      bytes = 128UL << 10;
+    }
+    workers[t].n = bytes / sizeof(int);
+    cpu = (cpu + 1) % CPU_SETSIZE;
+  }
+}
+
+//start the workers and wait until each has made its region
+void cache_start_workers(void) {
+  int t = 0;
+
+  pthread_barrier_init(&workers_ready, 0, worker_count + 1);
+  for (t = 0; t < worker_count; t++) {
+    pthread_create(&workers[t].thread, 0, cache_worker_main, &workers[t]);
+  }
+  pthread_barrier_wait(&workers_ready);
+}
+
+void cache_run_workers(void) {
+  unsigned long ind_sum = 0;
+  unsigned long seconds = 0;
+  int errors = 0;
+  int tests = 0;
+  int sums = 0;
+  int t = 0;
+#if refresh_mode
+  unsigned long mbs[2];
+#endif
+
+  //the header is out, let the workers go
+  pthread_barrier_wait(&workers_ready);
+  while (1) {
+    sleep(1);
+    seconds++;
+
+    ind_sum = 0;
+    errors = 0;
+    tests = 0;
+    sums = 0;
+#if refresh_mode
+    mbs[0] = 0;
+    mbs[1] = 0;
+#endif
+    for (t = 0; t < worker_count; t++) {
+      ind_sum += workers[t].ind;
+      errors += workers[t].errors;
+      tests += workers[t].tests_with_errors;
+      sums += workers[t].sum_errors;
+#if refresh_mode
+      mbs[0] += workers[t].refresh_mbs[0];
+      mbs[1] += workers[t].refresh_mbs[1];
+#endif
+    }
+
+    print_lock();
+    printf("# %n, %i, %i, %i\r\n", ind_sum, errors, tests, sums);
+#if refresh_mode
+    refresh_report(mbs[0], mbs[1]);
+#endif
+    if (seconds % thread_report == 0) {
+      for (t = 0; t < worker_count; t++) {
+	printf("# t%i, %i, %n, %i\r\n", t, workers[t].cpu, workers[t].ind, workers[t].errors);
+      }
+    }
+    print_unlock();
+  }
+}
+#endif
+
 
 int main(void)
 {
+#if cache_sweep_mode
+  int k = 0;
+#endif
 
   //init part
   initMSP430();
+#if scan_fast
+  scan_init();
+#endif
+#if cache_sweep_mode
+  cache_sweep_plan();
+#endif
+#if cache_threaded
+  cache_plan_workers();
+#endif
+#if cache_cover
+  cover_plan();
+#endif
+#if refresh_mode
+  refresh_plan();
+#endif
+#if cache_threaded
+  cache_start_workers();
+#endif
   
   //print YAML header
   printf("\r\n---\r\n");
-  printf("hw: msp430f2619\r\n");
+  printf("hw: %s\r\n", hw_name);
   printf("test: cache\r\n");
   printf("mit: none\r\n");
   printf("printing: %i\r\n", robust_printing);
   printf("Array size: %i\r\n", data_array_elements);
+  printf("pattern: %s\r\n", pattern_name);
+  printf("upsets: %i\r\n", upset_classify);
+#if scrub_idle || !scrub_repair
+  printf("scrub: {idle: %i, ms: %i, repair: %i}\r\n", scrub_idle, scrub_idle_ms, scrub_repair);
+#endif
+#if scan_fast
+  printf("scan: %s\r\n", scan_engine());
+#endif
+#if march_test
+  printf("march: %s\r\n", march_algorithms[march_algorithm].name);
+  printf("word: %i\r\n", march_word_bits);
+#endif
+#if cache_sweep_mode
+  //bytes under test per level, the last level is memory
+  for (k = 0; k < level_count; k++) {
+    sweep_name("l", levels[k].level);
+    printf(": %n\r\n", (unsigned long)levels[k].n * sizeof(int));
+  }
+  printf("chase: %i\r\n", sweep_chase);
+  printf("pages: %s\r\n", page_names[region_pages]);
+#endif
+#if cache_cover
+  printf("cover: {level: %i, line: %i, sets: %n, ways: %i}\r\n", cover_level, cover_line_n, (unsigned long)cover_sets_n, cover_ways_n);
+#if cover_sysfs
+  printf("pages: %s\r\n", page_names[region_pages]);
+#endif
+#endif
+#if refresh_mode
+  printf("refresh: {every: %i, bytes: %n}\r\n", refresh_every, (unsigned long)refresh_n * sizeof(int));
+#endif
+#if cache_threaded
+  printf("threads: %i\r\n", worker_count);
+  printf("region: %n\r\n", (unsigned long)workers[0].n * sizeof(int));
+  printf("pages: %s\r\n", page_names[region_pages]);
+#endif
   printf("ver: 0.1\r\n");
   printf("fac: LANSCE Nov 2015\r\n");
   printf("d:\r\n");
   
   //start test
-  cache_test();
+#if cache_sweep_mode
+  cache_sweep();
+#elif cache_threaded
+  cache_run_workers();
+#elif cache_cover
+  cache_test(cover_mem, cover_words);
+#else
+  cache_test(array, data_array_elements);
+#endif
 }
 
+#ifdef __MSP430__
+
 void initMSP430() {
   //MSP430F2619 initialization code
   WDTCTL = WDTPW + WDTHOLD;                 // Stop WDT
@@ -243,6 +1897,18 @@ void initMSP430() {
   initUART();
 }
 
+//the idle passes after a scrub, the DCO runs at 1 MHz
+void scrub_wait(void) {
+  unsigned int pass = 0;
+  unsigned int ms = 0;
+
+  for (pass = 0; pass < scrub_idle; pass++) {
+    for (ms = 0; ms < scrub_idle_ms; ms++) {
+      __delay_cycles(1000);
+    }
+  }
+}
+
 /**
  * Initializes the UART for 9600 baud with a RX interrupt
  **/
@@ -255,6 +1921,34 @@ void initUART(void) {
   UCA0CTL1 &= ~UCSWRST;                     // **Initialize USCI state machine**
 }
 
+#else
+
+void initMSP430() {
+  //nothing to set up on a host, the output goes to stdout
+}
+
+//the idle passes after a scrub
+void scrub_wait(void) {
+  unsigned long ms = (unsigned long)scrub_idle * scrub_idle_ms;
+  struct timespec ts;
+
+  ts.tv_sec = ms / 1000;
+  ts.tv_nsec = (ms % 1000) * 1000000;
+  while (nanosleep(&ts, &ts) != 0) {
+  }
+}
+
+#if cache_sweep_mode || refresh_mode
+unsigned long cache_clock_ns(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+#endif
+
 /**
  * puts() is used by printf() to display or send a string.. This function
  * determines where printf prints to. For this case it sends a string
@@ -279,6 +1973,8 @@ void putc(char b) {
   sendByte(b);
 }
 
+#ifdef __MSP430__
+
 /**
  * Sends a single byte out through UART
  **/
@@ -296,3 +1992,15 @@ __interrupt void USCI0RX_ISR(void)
 	while (!(IFG2&UCA0TXIFG));                // USCI_A0 TX buffer ready?
 	UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
 }
+
+#else
+
+/**
+ * Host stand-in for the UART: sends a single byte to stdout
+ **/
+void sendByte(char byte)
+{
+  write(1, &byte, 1);
+}
+
+#endif
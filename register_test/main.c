@@ -0,0 +1,764 @@
+/*
+Copyright (c) 2015, Los Alamos National Security, LLC
+All rights reserved.
+
+Copyright 2015. Los Alamos National Security, LLC. This software was
+produced under U.S. Government contract DE-AC52-06NA25396 for Los
+Alamos National Laboratory (LANL), which is operated by Los Alamos
+National Security, LLC for the U.S. Department of Energy. The
+U.S. Government has rights to use, reproduce, and distribute this
+software.  NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY,
+LLC MAKES ANY WARRANTY, EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY
+FOR THE USE OF THIS SOFTWARE.  If software is modified to produce
+derivative works, such modified software should be clearly marked, so
+as not to confuse it with the version available from LANL.
+
+Additionally, redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the following
+conditions are met:
+
+• Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+
+• Redistributions in binary form must reproduce the above copyright
+         notice, this list of conditions and the following disclaimer
+         in the documentation and/or other materials provided with the
+         distribution.
+
+• Neither the name of Los Alamos National Security, LLC, Los Alamos
+         National Laboratory, LANL, the U.S. Government, nor the names
+         of its contributors may be used to endorse or promote
+         products derived from this software without specific prior
+         written permission.
+
+THIS SOFTWARE IS PROVIDED BY LOS ALAMOS NATIONAL SECURITY, LLC AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL LOS
+ALAMOS NATIONAL SECURITY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+//*****************************************************************************
+//
+// register_test.c
+//
+// This test soaks the register file.  Every pass loads a known pattern into
+// all the general-purpose registers the code may touch, leaves them alone
+// for dwell_cycles CPU cycles and stores them back, then does the same with
+// the vector registers, and checks what came back.  A register that comes
+// back wrong is reported by the bits that flipped.  The pattern changes
+// every pass: checkerboard, inverted checkerboard, ones, zeros, and a value
+// unique to each register so a read of the wrong register shows up too.
+//
+// The load, the dwell loop and the store are one piece of assembly per
+// architecture, so nothing the compiler does can spill a register to the
+// stack in between:
+//
+//   MSP430   R4-R15, the dwell counter is a 32-bit variable in RAM
+//   x86-64   rax-r15 but rsp, the counter in RAM; xmm0-15 with SSE2,
+//            ymm0-15 with AVX2 or zmm0-31 and k0-k7 with AVX-512,
+//            whichever the CPU has; all 64 bits of the masks with
+//            AVX512BW, else the low 16 (kbits: in the header)
+//   AArch64  x1-x30 but the platform register x18, x0 counts; v0-v31
+//
+// On the MSP430 a dwell loop is exactly 10 cycles.  On x86-64 the loops are
+// timed against the TSC once at start, on AArch64 a loop is taken as one
+// cycle.
+//
+// An error block gives the pattern of the pass under p: and lists the bad
+// general-purpose registers under G: and the bad vector (and mask)
+// registers under V:, each with the bits that flipped, counted from bit 0
+// of the register ("zmm3: [7, 300]"), or just the number of bad registers
+// without robust printing.
+//
+// This software is otimized for TI microcontrollers, specifically the
+// MSP430F2619.  When __MSP430__ is not defined the part initialization is
+// skipped and sendByte() writes to stdout, so it also runs on a Linux host
+// (x86-64 or AArch64, ELF).
+//
+// The output is designed to go out the UART at a speed of 9,600 baud and uses a
+// tiny printf to reduce printf footprint.  The tiny printf can be downloaded from 
+// http://www.43oh.com/forum/viewtopic.php?f=10&t=1732  All of the output is YAML
+// parsable.
+//
+//*****************************************************************************
+
+
+#ifdef __MSP430__
+#include <msp430.h>
+#else
+#include <unistd.h>
+#endif
+#include <string.h>
+
+void sendByte(char);
+void printf(char *, ...);
+void initUART(void);
+void initMSP430();
+void register_test(void);
+void soak_plan(void);
+void soak_gpr(void);
+int soak_verify(int pattern, int vector);
+
+#define 	robust_printing			1
+#define		soak_patterns			5
+#define		pattern_unique			4
+
+//cycles the registers hold their pattern on every pass, and passes
+//between heartbeats
+#ifdef __MSP430__
+#define		dwell_cycles			10000UL
+#define		report_every			100
+#else
+#define		dwell_cycles			10000000UL
+#define		report_every			100
+#endif
+
+#if defined(__MSP430__)
+#define		hw_name				"msp430f2619"
+#define		soak_gprs			12
+#define		soak_vectors			0
+#define		loop_cycles			10
+typedef unsigned int reg_word;
+#elif defined(__x86_64__)
+#define		hw_name				"host"
+#define		soak_gprs			15
+#define		soak_vectors			1
+#define		soak_max_vregs			32
+#define		soak_masks			8
+typedef unsigned long reg_word;
+#elif defined(__aarch64__)
+#define		hw_name				"host"
+#define		soak_gprs			29
+#define		soak_vectors			1
+#define		soak_max_vregs			32
+#define		soak_masks			0
+#define		loop_cycles			1
+typedef unsigned long reg_word;
+#else
+#error no register soak for this architecture
+#endif
+
+//each vector register has a 64-byte slot, whatever its width
+#define		slot_words			(64 / sizeof(reg_word))
+#define		reg_bits			(8 * sizeof(reg_word))
+
+void soak_report(int vector, int reg, const reg_word *flipped, int words, int *first);
+
+unsigned long int ind = 0;
+int local_errors = 0;
+int in_block = 0;
+
+//read and written by the assembly
+reg_word soak_in[soak_gprs];
+reg_word soak_out[soak_gprs];
+unsigned long soak_count;
+unsigned long gpr_loops = 1;
+
+#if soak_vectors
+reg_word soak_vin[soak_max_vregs * slot_words];
+reg_word soak_vout[soak_max_vregs * slot_words];
+#if soak_masks
+reg_word soak_kin[soak_masks];
+reg_word soak_kout[soak_masks];
+#endif
+
+void (*soak_vec)(void);
+const char *vec_name;
+const char *vec_prefix;
+int vec_regs = 0;
+int vec_bytes = 0;
+int vec_masks = 0;
+int vec_mask_bits = 0;
+unsigned long vec_loops = 1;
+#endif
+
+//expected value of word k of a pattern
+reg_word soak_value(int pattern, int k) {
+  reg_word checker = (reg_word)~0 / 3;
+
+  switch (pattern) {
+  case 0:
+    return k & 1 ? ~checker : checker;
+  case 1:
+    return k & 1 ? checker : ~checker;
+  case 2:
+    return ~(reg_word)0;
+  case 3:
+    return 0;
+  default:
+    //pattern_unique: the word number in every 16 bits, inverted in odd
+    //words; a byte would wrap before the 264 words of zmm0-31 and k0-7
+    return ((reg_word)~0 / 0xffff) * (unsigned short)(k + 1) ^ (k & 1 ? ~(reg_word)0 : 0);
+  }
+}
+
+#if defined(__MSP430__)
+
+const char *gpr_names[soak_gprs] = {
+  "r4", "r5", "r6", "r7", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+};
+
+//sub #1 and subc #0 on absolute operands are 4 cycles each, jc is 2
+void soak_gpr(void) {
+  __asm__ volatile (
+    "	push	r4\n	push	r5\n	push	r6\n	push	r7\n"
+    "	push	r8\n	push	r9\n	push	r10\n	push	r11\n"
+    "	push	r12\n	push	r13\n	push	r14\n	push	r15\n"
+    "	mov	&soak_in, r4\n"
+    "	mov	&soak_in+2, r5\n"
+    "	mov	&soak_in+4, r6\n"
+    "	mov	&soak_in+6, r7\n"
+    "	mov	&soak_in+8, r8\n"
+    "	mov	&soak_in+10, r9\n"
+    "	mov	&soak_in+12, r10\n"
+    "	mov	&soak_in+14, r11\n"
+    "	mov	&soak_in+16, r12\n"
+    "	mov	&soak_in+18, r13\n"
+    "	mov	&soak_in+20, r14\n"
+    "	mov	&soak_in+22, r15\n"
+    "1:	sub	#1, &soak_count\n"
+    "	subc	#0, &soak_count+2\n"
+    "	jc	1b\n"
+    "	mov	r4, &soak_out\n"
+    "	mov	r5, &soak_out+2\n"
+    "	mov	r6, &soak_out+4\n"
+    "	mov	r7, &soak_out+6\n"
+    "	mov	r8, &soak_out+8\n"
+    "	mov	r9, &soak_out+10\n"
+    "	mov	r10, &soak_out+12\n"
+    "	mov	r11, &soak_out+14\n"
+    "	mov	r12, &soak_out+16\n"
+    "	mov	r13, &soak_out+18\n"
+    "	mov	r14, &soak_out+20\n"
+    "	mov	r15, &soak_out+22\n"
+    "	pop	r15\n	pop	r14\n	pop	r13\n	pop	r12\n"
+    "	pop	r11\n	pop	r10\n	pop	r9\n	pop	r8\n"
+    "	pop	r7\n	pop	r6\n	pop	r5\n	pop	r4\n"
+    ::: "memory");
+}
+
+//the loop runs soak_count + 1 times
+void soak_plan(void) {
+  gpr_loops = dwell_cycles / loop_cycles - 1;
+}
+
+#elif defined(__x86_64__)
+
+#define X86_GPRS(m)	m(0, rax) m(1, rbx) m(2, rcx) m(3, rdx) m(4, rsi) m(5, rdi) m(6, rbp) m(7, r8) \
+			m(8, r9) m(9, r10) m(10, r11) m(11, r12) m(12, r13) m(13, r14) m(14, r15)
+#define X86_NAME(k, r)		#r,
+#define X86_IN(k, r)		"	movq	soak_in+" #k "*8(%rip), %" #r "\n"
+#define X86_OUT(k, r)		"	movq	%" #r ", soak_out+" #k "*8(%rip)\n"
+
+#define X86_V16(m)	m(0) m(1) m(2) m(3) m(4) m(5) m(6) m(7) m(8) m(9) m(10) m(11) m(12) m(13) m(14) m(15)
+#define X86_V32(m)	X86_V16(m) m(16) m(17) m(18) m(19) m(20) m(21) m(22) m(23) \
+			m(24) m(25) m(26) m(27) m(28) m(29) m(30) m(31)
+#define X86_K8(m)	m(0) m(1) m(2) m(3) m(4) m(5) m(6) m(7)
+#define SSE_IN(n)	"	movdqu	soak_vin+" #n "*64(%rip), %xmm" #n "\n"
+#define SSE_OUT(n)	"	movdqu	%xmm" #n ", soak_vout+" #n "*64(%rip)\n"
+#define AVX2_IN(n)	"	vmovdqu	soak_vin+" #n "*64(%rip), %ymm" #n "\n"
+#define AVX2_OUT(n)	"	vmovdqu	%ymm" #n ", soak_vout+" #n "*64(%rip)\n"
+#define AVX512_IN(n)	"	vmovdqu64	soak_vin+" #n "*64(%rip), %zmm" #n "\n"
+#define AVX512_OUT(n)	"	vmovdqu64	%zmm" #n ", soak_vout+" #n "*64(%rip)\n"
+#define KMASK_IN(n)	"	kmovw	soak_kin+" #n "*8(%rip), %k" #n "\n"
+#define KMASK_OUT(n)	"	kmovw	%k" #n ", soak_kout+" #n "*8(%rip)\n"
+#define KMASK64_IN(n)	"	kmovq	soak_kin+" #n "*8(%rip), %k" #n "\n"
+#define KMASK64_OUT(n)	"	kmovq	%k" #n ", soak_kout+" #n "*8(%rip)\n"
+
+//the vector loops count in rsi, which they do not soak
+#define X86_DWELL	"	movq	soak_count(%rip), %rsi\n" \
+			"1:	subq	$1, %rsi\n" \
+			"	jnz	1b\n"
+#define X86_FUNC(name)	"	.text\n	.p2align	4\n	.globl	" #name "\n	.type	" #name ", @function\n" #name ":\n"
+#define X86_END(name)	"	ret\n	.size	" #name ", .-" #name "\n"
+
+const char *gpr_names[soak_gprs] = { X86_GPRS(X86_NAME) };
+
+//every general-purpose register holds a pattern, so the loop counts in RAM
+__asm__(
+  X86_FUNC(soak_gpr)
+  "	pushq	%rbx\n	pushq	%rbp\n	pushq	%r12\n	pushq	%r13\n	pushq	%r14\n	pushq	%r15\n"
+  X86_GPRS(X86_IN)
+  "1:	subq	$1, soak_count(%rip)\n"
+  "	jnz	1b\n"
+  X86_GPRS(X86_OUT)
+  "	popq	%r15\n	popq	%r14\n	popq	%r13\n	popq	%r12\n	popq	%rbp\n	popq	%rbx\n"
+  X86_END(soak_gpr)
+
+  X86_FUNC(soak_sse2)
+  X86_V16(SSE_IN)
+  X86_DWELL
+  X86_V16(SSE_OUT)
+  X86_END(soak_sse2)
+
+  X86_FUNC(soak_avx2)
+  X86_V16(AVX2_IN)
+  X86_DWELL
+  X86_V16(AVX2_OUT)
+  "	vzeroupper\n"
+  X86_END(soak_avx2)
+
+  X86_FUNC(soak_avx512)
+  X86_V32(AVX512_IN)
+  X86_K8(KMASK_IN)
+  X86_DWELL
+  X86_V32(AVX512_OUT)
+  X86_K8(KMASK_OUT)
+  "	vzeroupper\n"
+  X86_END(soak_avx512)
+
+  X86_FUNC(soak_avx512bw)
+  X86_V32(AVX512_IN)
+  X86_K8(KMASK64_IN)
+  X86_DWELL
+  X86_V32(AVX512_OUT)
+  X86_K8(KMASK64_OUT)
+  "	vzeroupper\n"
+  X86_END(soak_avx512bw)
+);
+
+void soak_sse2(void);
+void soak_avx2(void);
+void soak_avx512(void);
+void soak_avx512bw(void);
+
+//loops of a soak for dwell_cycles, from the TSC ticks of a trial soak
+unsigned long soak_loops(void (*soak)(void)) {
+  unsigned long t = 0;
+  unsigned long trial = 1UL << 20;
+
+  soak_count = trial;
+  t = __builtin_ia32_rdtsc();
+  soak();
+  t = __builtin_ia32_rdtsc() - t;
+  t = dwell_cycles * trial / (t ? t : 1);
+  return t ? t : 1;
+}
+
+//pick the widest vector registers the CPU has and time the loops
+void soak_plan(void) {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    soak_vec = soak_avx512;
+    vec_name = "avx512";
+    vec_prefix = "zmm";
+    vec_regs = 32;
+    vec_bytes = 64;
+    vec_masks = soak_masks;
+    vec_mask_bits = 16;
+    //kmovq needs AVX512BW
+    if (__builtin_cpu_supports("avx512bw")) {
+      soak_vec = soak_avx512bw;
+      vec_mask_bits = 64;
+    }
+  }
+  else if (__builtin_cpu_supports("avx2")) {
+    soak_vec = soak_avx2;
+    vec_name = "avx2";
+    vec_prefix = "ymm";
+    vec_regs = 16;
+    vec_bytes = 32;
+  }
+  else {
+    soak_vec = soak_sse2;
+    vec_name = "sse2";
+    vec_prefix = "xmm";
+    vec_regs = 16;
+    vec_bytes = 16;
+  }
+  gpr_loops = soak_loops(soak_gpr);
+  vec_loops = soak_loops(soak_vec);
+}
+
+#elif defined(__aarch64__)
+
+const char *gpr_names[soak_gprs] = {
+  "x1", "x2", "x3", "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11", "x12", "x13", "x14", "x15",
+  "x16", "x17", "x19", "x20", "x21", "x22", "x23", "x24", "x25", "x26", "x27", "x28", "x29", "x30"
+};
+
+#define A64_GPRS(op)	"	" op "	x1, x2, [x0, #0]\n" \
+			"	" op "	x3, x4, [x0, #16]\n" \
+			"	" op "	x5, x6, [x0, #32]\n" \
+			"	" op "	x7, x8, [x0, #48]\n" \
+			"	" op "	x9, x10, [x0, #64]\n" \
+			"	" op "	x11, x12, [x0, #80]\n" \
+			"	" op "	x13, x14, [x0, #96]\n" \
+			"	" op "	x15, x16, [x0, #112]\n" \
+			"	" op "	x17, x19, [x0, #128]\n" \
+			"	" op "	x20, x21, [x0, #144]\n" \
+			"	" op "	x22, x23, [x0, #160]\n" \
+			"	" op "	x24, x25, [x0, #176]\n" \
+			"	" op "	x26, x27, [x0, #192]\n" \
+			"	" op "	x28, x29, [x0, #208]\n"
+#define A64_V32(m)	m(0, 0) m(1, 64) m(2, 128) m(3, 192) m(4, 256) m(5, 320) m(6, 384) m(7, 448) \
+			m(8, 512) m(9, 576) m(10, 640) m(11, 704) m(12, 768) m(13, 832) m(14, 896) m(15, 960) \
+			m(16, 1024) m(17, 1088) m(18, 1152) m(19, 1216) m(20, 1280) m(21, 1344) m(22, 1408) m(23, 1472) \
+			m(24, 1536) m(25, 1600) m(26, 1664) m(27, 1728) m(28, 1792) m(29, 1856) m(30, 1920) m(31, 1984)
+#define A64_VIN(n, off)		"	ldr	q" #n ", [x0, #" #off "]\n"
+#define A64_VOUT(n, off)	"	str	q" #n ", [x0, #" #off "]\n"
+#define A64_ADDR(reg, sym)	"	adrp	" #reg ", " #sym "\n	add	" #reg ", " #reg ", :lo12:" #sym "\n"
+#define A64_FUNC(name)	"	.text\n	.p2align	2\n	.globl	" #name "\n	.type	" #name ", %function\n" #name ":\n"
+#define A64_END(name)	"	ret\n	.size	" #name ", .-" #name "\n"
+
+//x0 holds the buffer addresses and then counts the loops; x19-x30 and the
+//low halves of v8-v15 belong to the caller
+__asm__(
+  A64_FUNC(soak_gpr)
+  "	stp	x19, x20, [sp, #-96]!\n"
+  "	stp	x21, x22, [sp, #16]\n"
+  "	stp	x23, x24, [sp, #32]\n"
+  "	stp	x25, x26, [sp, #48]\n"
+  "	stp	x27, x28, [sp, #64]\n"
+  "	stp	x29, x30, [sp, #80]\n"
+  A64_ADDR(x0, soak_in)
+  A64_GPRS("ldp")
+  "	ldr	x30, [x0, #224]\n"
+  "	adrp	x0, soak_count\n"
+  "	ldr	x0, [x0, :lo12:soak_count]\n"
+  "1:	subs	x0, x0, #1\n"
+  "	b.ne	1b\n"
+  A64_ADDR(x0, soak_out)
+  A64_GPRS("stp")
+  "	str	x30, [x0, #224]\n"
+  "	ldp	x29, x30, [sp, #80]\n"
+  "	ldp	x27, x28, [sp, #64]\n"
+  "	ldp	x25, x26, [sp, #48]\n"
+  "	ldp	x23, x24, [sp, #32]\n"
+  "	ldp	x21, x22, [sp, #16]\n"
+  "	ldp	x19, x20, [sp], #96\n"
+  A64_END(soak_gpr)
+
+  A64_FUNC(soak_neon)
+  "	stp	d8, d9, [sp, #-64]!\n"
+  "	stp	d10, d11, [sp, #16]\n"
+  "	stp	d12, d13, [sp, #32]\n"
+  "	stp	d14, d15, [sp, #48]\n"
+  A64_ADDR(x0, soak_vin)
+  A64_V32(A64_VIN)
+  "	adrp	x1, soak_count\n"
+  "	ldr	x1, [x1, :lo12:soak_count]\n"
+  "1:	subs	x1, x1, #1\n"
+  "	b.ne	1b\n"
+  A64_ADDR(x0, soak_vout)
+  A64_V32(A64_VOUT)
+  "	ldp	d14, d15, [sp, #48]\n"
+  "	ldp	d12, d13, [sp, #32]\n"
+  "	ldp	d10, d11, [sp, #16]\n"
+  "	ldp	d8, d9, [sp], #64\n"
+  A64_END(soak_neon)
+);
+
+void soak_neon(void);
+
+void soak_plan(void) {
+  soak_vec = soak_neon;
+  vec_name = "neon";
+  vec_prefix = "v";
+  vec_regs = 32;
+  vec_bytes = 16;
+  gpr_loops = dwell_cycles / loop_cycles;
+  vec_loops = dwell_cycles / loop_cycles;
+}
+
+#endif
+
+//print one bad register by the bits that flipped in its words, all in one
+//entry; first opens the list
+void soak_report(int vector, int reg, const reg_word *flipped, int words, int *first) {
+  reg_word left = 0;
+  int bits = 0;
+  int many = 0;
+  int bit = 0;
+  int w = 0;
+
+  for (w = 0; w < words; w++) {
+    for (left = flipped[w]; left; left &= left - 1) {
+      bits++;
+    }
+  }
+
+  if (!in_block) {
+    printf(" - i: %n\r\n", ind);
+    printf("   p: %i\r\n", (int)(ind % soak_patterns));
+    in_block = 1;
+  }
+  if (!*first) {
+    printf(vector ? "   V: {" : "   G: {");
+    *first = 1;
+  }
+#if soak_vectors
+  if (vector == 1) {
+    printf("%s%i", vec_prefix, reg);
+  }
+  else if (vector == 2) {
+    printf("k%i", reg);
+  }
+  else
+#endif
+  printf("%s", gpr_names[reg]);
+  many = bits > 1;
+  printf(many ? ": [" : ": ");
+  for (w = 0; w < words; w++) {
+    for (bit = 0, left = flipped[w]; left; bit++, left >>= 1) {
+      if (left & 1) {
+	printf(--bits ? "%i, " : "%i", w * (int)reg_bits + bit);
+      }
+    }
+  }
+  printf(many ? "]," : ",");
+}
+
+//compare the stored registers with the pattern, return the bad registers
+int soak_verify(int pattern, int vector) {
+  int first = 0;
+  int errors = 0;
+  int reg = 0;
+  reg_word flipped = 0;
+#if soak_vectors
+  reg_word words[slot_words];
+  int w = 0;
+  int bad = 0;
+#endif
+
+  if (!vector) {
+    for (reg = 0; reg < soak_gprs; reg++) {
+      flipped = soak_out[reg] ^ soak_value(pattern, reg);
+      if (flipped) {
+	if (robust_printing) {
+	  soak_report(0, reg, &flipped, 1, &first);
+	}
+	errors++;
+      }
+    }
+  }
+#if soak_vectors
+  else {
+    for (reg = 0; reg < vec_regs; reg++) {
+      bad = 0;
+      for (w = 0; w < vec_bytes / (int)sizeof(reg_word); w++) {
+	words[w] = soak_vout[reg * slot_words + w] ^ soak_value(pattern, reg * slot_words + w);
+	bad |= words[w] != 0;
+      }
+      if (bad) {
+	if (robust_printing) {
+	  soak_report(1, reg, words, w, &first);
+	}
+	errors++;
+      }
+    }
+#if soak_masks
+    for (reg = 0; reg < vec_masks; reg++) {
+      flipped = soak_kout[reg] ^ soak_value(pattern, soak_max_vregs * slot_words + reg);
+      if (vec_mask_bits < (int)reg_bits) {
+	flipped &= ((reg_word)1 << vec_mask_bits) - 1;
+      }
+      if (flipped) {
+	if (robust_printing) {
+	  soak_report(2, reg, &flipped, 1, &first);
+	}
+	errors++;
+      }
+    }
+#endif
+  }
+#endif
+
+  if (first) {
+    printf("}\r\n");
+  }
+  if (!robust_printing && errors > 0) {
+    if (!in_block) {
+      printf(" - i: %n\r\n", ind);
+      printf("   p: %i\r\n", pattern);
+      in_block = 1;
+    }
+    printf(vector ? "   V: %i\r\n" : "   G: %i\r\n", errors);
+  }
+  return errors;
+}
+
+//load the pattern, and the complement where the registers are stored back
+//so a store that never happens shows up
+void soak_fill(int pattern) {
+  int k = 0;
+
+  for (k = 0; k < soak_gprs; k++) {
+    soak_in[k] = soak_value(pattern, k);
+    soak_out[k] = ~soak_in[k];
+  }
+#if soak_vectors
+  for (k = 0; k < soak_max_vregs * (int)slot_words; k++) {
+    soak_vin[k] = soak_value(pattern, k);
+    soak_vout[k] = ~soak_vin[k];
+  }
+#if soak_masks
+  for (k = 0; k < soak_masks; k++) {
+    soak_kin[k] = soak_value(pattern, soak_max_vregs * slot_words + k);
+    soak_kout[k] = ~soak_kin[k];
+  }
+#endif
+#endif
+}
+
+void register_test(void) {
+  int total_errors = 0;
+  int pattern = 0;
+
+  while (1) {
+    pattern = ind % soak_patterns;
+    soak_fill(pattern);
+
+    soak_count = gpr_loops;
+    soak_gpr();
+    local_errors += soak_verify(pattern, 0);
+
+#if soak_vectors
+    soak_count = vec_loops;
+    soak_vec();
+    local_errors += soak_verify(pattern, 1);
+#endif
+
+    //acking every few seconds to make certain the program is still alive
+    if (ind % report_every == 0 && ind != 0) {
+      printf("# %n, %i\r\n", ind, total_errors);
+    }
+
+    ind++;
+    total_errors += local_errors;
+    local_errors = 0;
+    in_block = 0;
+  }
+}
+
+int main(void)
+{
+  //init part
+  initMSP430();
+  soak_plan();
+
+  //print YAML header
+  printf("\r\n---\r\n");
+  printf("hw: %s\r\n", hw_name);
+  printf("test: register\r\n");
+  printf("mit: none\r\n");
+  printf("printing: %i\r\n", robust_printing);
+  printf("dwell: %n\r\n", dwell_cycles);
+  printf("gprs: %i\r\n", soak_gprs);
+#if soak_vectors
+  printf("vector: %s\r\n", vec_name);
+  printf("vregs: %i\r\n", vec_regs);
+#if soak_masks
+  if (vec_masks) {
+    printf("kbits: %i\r\n", vec_mask_bits);
+  }
+#endif
+#endif
+  printf("ver: 0.1\r\n");
+  printf("fac: LANSCE Nov 2015\r\n");
+  printf("d:\r\n");
+
+  //start test
+  register_test();
+
+  return 0;
+}
+
+#ifdef __MSP430__
+
+void initMSP430() {
+  //MSP430F2619 initialization code
+  WDTCTL = WDTPW + WDTHOLD;                 // Stop WDT
+  if (CALBC1_1MHZ==0xFF)		    // If calibration constant erased
+  {
+    while(1);                               // do not load, trap CPU!!
+  }
+  DCOCTL = 0;                               // Select lowest DCOx and MODx settings
+  BCSCTL1 = CALBC1_1MHZ;                    // Set DCO
+  DCOCTL = CALDCO_1MHZ;
+  
+  initUART();
+}
+
+/**
+ * Initializes the UART for 9600 baud with a RX interrupt
+ **/
+void initUART(void) {
+  P3SEL = 0x30;                             // P3.4,5 = USCI_A0 TXD/RXD
+  UCA0CTL1 |= UCSSEL_2;                     // SMCLK
+  UCA0BR0 = 104;                            // 1MHz 9600; (104)decimal = 0x068h
+  UCA0BR1 = 0;                              // 1MHz 9600
+  UCA0MCTL = UCBRS0;                        // Modulation UCBRSx = 1
+  UCA0CTL1 &= ~UCSWRST;                     // **Initialize USCI state machine**
+}
+
+#else
+
+void initMSP430() {
+  //nothing to set up on a host, the output goes to stdout
+}
+
+#endif
+
+/**
+ * puts() is used by printf() to display or send a string.. This function
+ * determines where printf prints to. For this case it sends a string
+ * out over UART, another option could be to display the string on an
+ * LCD display.
+ **/
+void puts(char *s) {
+  char c;
+  
+  // Loops through each character in string 's'
+  while (c = *s++) {
+    sendByte(c);
+  }
+}
+
+/**
+ * puts() is used by printf() to display or send a character. This function
+ * determines where printf prints to. For this case it sends a character
+ * out over UART.
+ **/
+void putc(char b) {
+  sendByte(b);
+}
+
+#ifdef __MSP430__
+
+/**
+ * Sends a single byte out through UART
+ **/
+void sendByte(char byte )
+{
+	while (!(IFG2&UCA0TXIFG)); // USCI_A0 TX buffer ready?
+	UCA0TXBUF = byte; // TX -> RXed character
+}
+
+//  Echo back RXed character, confirm TX buffer is ready first
+#pragma vector=USCIAB0RX_VECTOR
+__interrupt void USCI0RX_ISR(void)
+{
+
+	while (!(IFG2&UCA0TXIFG));                // USCI_A0 TX buffer ready?
+	UCA0TXBUF = UCA0RXBUF;                    // TX -> RXed character
+}
+
+#else
+
+/**
+ * Host stand-in for the UART: sends a single byte to stdout
+ **/
+void sendByte(char byte)
+{
+  write(1, &byte, 1);
+}
+
+#endif